@@ -0,0 +1,72 @@
+#include "barretenberg/crypto/generators/generator_data.hpp"
+#include "barretenberg/crypto/generators/points_file.hpp"
+#include "barretenberg/crypto/pedersen_hash/pedersen_lookup.hpp"
+#include "barretenberg/proof_system/work_queue/remote_worker.hpp"
+#include "barretenberg/srs/reference_string/file_reference_string.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace {
+void print_usage(const char* name)
+{
+    std::cerr << "usage: " << name
+              << " <socket path> [--crs <directory>] [--num-points <n>] [--precomputed-dir <directory>]" << std::endl;
+}
+
+void load_precomputed_tables(const std::string& dir)
+{
+    const std::string generator_points_path = dir + "/" + crypto::generators::GENERATOR_POINTS_FILE_NAME;
+    if (!crypto::generators::load_generator_points(generator_points_path)) {
+        std::cerr << "could not load " << generator_points_path << ", deriving the generator points" << std::endl;
+    }
+    const std::string pedersen_tables_path = dir + "/" + crypto::generators::PEDERSEN_TABLES_FILE_NAME;
+    if (!crypto::pedersen_hash::lookup::load_tables(pedersen_tables_path)) {
+        std::cerr << "could not load " << pedersen_tables_path << ", computing the pedersen tables" << std::endl;
+    }
+}
+} // namespace
+
+/**
+ * Serves work queue items to a prover (see proof_system/work_queue/remote_worker.hpp) on the given Unix socket until
+ * the prover sends a shutdown request. The worker loads `--num-points` points (default 2^20) of the SRS in `--crs`
+ * (default ../srs_db/ignition), which must be the SRS the prover commits with and at least as large as its circuits.
+ * `--precomputed-dir` names a directory written by precompute_tables: the generator points and pedersen tables are
+ * loaded from it at startup, and derived on first use if it does not hold them (as when BB_PRECOMPUTED_DIR is set).
+ *
+ * Run one per NUMA node to spread a proof over the sockets, e.g.
+ *
+ *     numactl --cpunodebind=1 --membind=1 bb_worker /tmp/bb_worker_1.sock
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    const std::string socket_path = argv[1];
+    std::string crs_path = "../srs_db/ignition";
+    size_t num_points = 1 << 20;
+    std::string precomputed_dir;
+    for (int i = 2; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--crs" && i + 1 < argc) {
+            crs_path = argv[++i];
+        } else if (arg == "--num-points" && i + 1 < argc) {
+            num_points = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--precomputed-dir" && i + 1 < argc) {
+            precomputed_dir = argv[++i];
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (!precomputed_dir.empty()) {
+        load_precomputed_tables(precomputed_dir);
+    }
+    auto reference_string = std::make_shared<proof_system::FileReferenceString>(num_points, crs_path);
+    return proof_system::plonk::remote::run_worker(socket_path, reference_string) ? 0 : 1;
+}
@@ -1,10 +1,19 @@
 #include <chrono>
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/numa.hpp"
 #include <cstdlib>
+#include <cstring>
+#include <sched.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/srs/reference_string/file_reference_string.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
+#ifndef NO_MULTITHREADING
+#include <omp.h>
+#endif
+
 // #include <valgrind/callgrind.h>
 //  CALLGRIND_START_INSTRUMENTATION;
 //  CALLGRIND_STOP_INSTRUMENTATION;
@@ -41,9 +50,11 @@ constexpr size_t NUM_POINTS = 1 << 16;
 std::vector<fr> scalars;
 static barretenberg::evaluation_domain small_domain;
 static barretenberg::evaluation_domain large_domain;
-auto reference_string = std::make_shared<proof_system::FileReferenceString>(NUM_POINTS, "../srs_db/ignition");
+// Loaded by init() rather than at static initialisation, so that --per-socket can fork before any threads exist.
+std::shared_ptr<proof_system::FileReferenceString> reference_string;
 
 const auto init = []() {
+    reference_string = std::make_shared<proof_system::FileReferenceString>(NUM_POINTS, "../srs_db/ignition");
     small_domain = barretenberg::evaluation_domain(NUM_POINTS);
     large_domain = barretenberg::evaluation_domain(NUM_POINTS * 4);
 
@@ -61,7 +72,7 @@ const auto init = []() {
 };
 // constexpr double add_to_mixed_add_complexity = 1.36;
 
-int pippenger()
+int64_t pippenger()
 {
     scalar_multiplication::pippenger_runtime_state state(NUM_POINTS);
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -71,6 +82,64 @@ int pippenger()
     std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
     std::cout << "run time: " << diff.count() << "us" << std::endl;
     std::cout << result.x << std::endl;
+    return diff.count();
+}
+
+/**
+ * Time pippenger on the first 1, 2, ..., n NUMA nodes. Each configuration runs in a child process restricted to those
+ * nodes with numa::restrict_to_nodes, so that the thread pool, the point table interleaving and the runtime state
+ * placement are all set up for exactly that many sockets.
+ */
+int pippenger_per_socket()
+{
+    const size_t num_nodes = numa::num_nodes();
+    std::cout << "numa nodes: " << num_nodes << std::endl;
+    int64_t single_socket_time = 0;
+    for (size_t used_nodes = 1; used_nodes <= num_nodes; ++used_nodes) {
+        int pipe_fds[2];
+        if (pipe(pipe_fds) != 0) {
+            std::cerr << "pipe failed: " << std::strerror(errno) << std::endl;
+            return 1;
+        }
+        const pid_t pid = fork();
+        if (pid == 0) {
+            close(pipe_fds[0]);
+            // The child inherits the parent's topology of every node, so restrict it before anything else runs.
+            numa::restrict_to_nodes(used_nodes);
+#ifndef NO_MULTITHREADING
+            size_t num_cpus = 0;
+            for (size_t node = 0; node < numa::num_nodes(); ++node) {
+                num_cpus += numa::cpus_of_node(node).size();
+            }
+            if (num_cpus > 0) {
+                omp_set_num_threads(static_cast<int>(num_cpus));
+            }
+#endif
+            init();
+            pippenger();
+            int64_t best = pippenger();
+            for (size_t i = 0; i < 3; ++i) {
+                best = std::min(best, pippenger());
+            }
+            const ssize_t written = write(pipe_fds[1], &best, sizeof(best));
+            _exit(written == sizeof(best) ? 0 : 1);
+        }
+        close(pipe_fds[1]);
+        int64_t best = 0;
+        const bool received = read(pipe_fds[0], &best, sizeof(best)) == sizeof(best);
+        close(pipe_fds[0]);
+        int status = 0;
+        waitpid(pid, &status, 0);
+        if (!received || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            std::cerr << "benchmark on " << used_nodes << " node(s) failed" << std::endl;
+            return 1;
+        }
+        if (used_nodes == 1) {
+            single_socket_time = best;
+        }
+        std::cout << used_nodes << " node(s): best run time " << best << "us, speedup "
+                  << static_cast<double>(single_socket_time) / static_cast<double>(best) << "x" << std::endl;
+    }
     return 0;
 }
 
@@ -94,8 +163,11 @@ int coset_fft_regular()
     return 0;
 }
 
-int main()
+int main(int argc, char** argv)
 {
+    if (argc > 1 && std::string(argv[1]) == "--per-socket") {
+        return pippenger_per_socket();
+    }
     std::cout << "initializing" << std::endl;
     init();
     std::cout << "executing normal fft" << std::endl;
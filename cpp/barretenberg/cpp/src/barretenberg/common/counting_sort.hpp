@@ -0,0 +1,64 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace barretenberg {
+
+/**
+ * @brief Stable sort of `items` by `key(item)`, which should lie in [0, num_keys).
+ *
+ * @details Runs in O(items.size() + num_keys) time, so it beats a comparison sort whenever the keys come from a small
+ * domain (indices into an array, timestamps, bounded range values). Sorting by a second key and then by a first key
+ * sorts lexicographically by (first, second).
+ *
+ * Keys come from circuit data (e.g. a ROM index the circuit writer got wrong), so they are checked in release builds
+ * too: if any key is out of range the items are sorted with std::stable_sort instead, with the same result.
+ */
+template <typename T, typename KeyFn> void counting_sort(std::vector<T>& items, const size_t num_keys, KeyFn&& key)
+{
+    // offsets[k + 1] counts the items with key k; the prefix sum turns that into the position of the first such item.
+    std::vector<size_t> offsets(num_keys + 1, 0);
+    for (const auto& item : items) {
+        const auto item_key = static_cast<size_t>(key(item));
+        if (item_key >= num_keys) {
+            std::stable_sort(items.begin(), items.end(), [&key](const T& a, const T& b) {
+                return static_cast<size_t>(key(a)) < static_cast<size_t>(key(b));
+            });
+            return;
+        }
+        ++offsets[item_key + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<T> sorted(items.size());
+    for (auto& item : items) {
+        sorted[offsets[static_cast<size_t>(key(item))]++] = std::move(item);
+    }
+    items = std::move(sorted);
+}
+
+/**
+ * @brief Sort integers that should all be at most `max_value`, in O(values.size() + max_value) time.
+ *
+ * @details As above, falls back to std::sort if some value exceeds `max_value`.
+ */
+inline void counting_sort(std::vector<uint64_t>& values, const uint64_t max_value)
+{
+    std::vector<size_t> counts(static_cast<size_t>(max_value) + 1, 0);
+    for (const auto value : values) {
+        if (value > max_value) {
+            std::sort(values.begin(), values.end());
+            return;
+        }
+        ++counts[static_cast<size_t>(value)];
+    }
+    auto it = values.begin();
+    for (size_t value = 0; value < counts.size(); ++value) {
+        it = std::fill_n(it, counts[value], static_cast<uint64_t>(value));
+    }
+}
+
+} // namespace barretenberg
@@ -0,0 +1,61 @@
+#include "counting_sort.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <utility>
+#include <vector>
+
+TEST(counting_sort, sorts_bounded_values)
+{
+    std::mt19937_64 engine(1);
+    std::vector<uint64_t> values(1000);
+    for (auto& value : values) {
+        value = engine() % 300;
+    }
+    std::vector<uint64_t> expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    barretenberg::counting_sort(values, 299);
+    EXPECT_EQ(values, expected);
+}
+
+TEST(counting_sort, two_passes_sort_lexicographically)
+{
+    std::mt19937_64 engine(2);
+    std::vector<std::pair<size_t, size_t>> items(1000);
+    for (auto& item : items) {
+        item = { engine() % 17, engine() % 100 };
+    }
+    std::vector<std::pair<size_t, size_t>> expected = items;
+    std::sort(expected.begin(), expected.end());
+
+    barretenberg::counting_sort(items, 100, [](const auto& item) { return item.second; });
+    barretenberg::counting_sort(items, 17, [](const auto& item) { return item.first; });
+    EXPECT_EQ(items, expected);
+}
+
+TEST(counting_sort, is_stable)
+{
+    // Items are created in increasing order of their second field, which must survive sorting on the first.
+    std::vector<std::pair<size_t, size_t>> items;
+    for (size_t i = 0; i < 100; ++i) {
+        items.emplace_back((i * 7) % 5, i);
+    }
+    barretenberg::counting_sort(items, 5, [](const auto& item) { return item.first; });
+    for (size_t i = 1; i < items.size(); ++i) {
+        EXPECT_TRUE(items[i - 1].first < items[i].first ||
+                    (items[i - 1].first == items[i].first && items[i - 1].second < items[i].second));
+    }
+}
+
+TEST(counting_sort, out_of_range_keys_fall_back_to_comparison_sort)
+{
+    std::vector<std::pair<size_t, size_t>> items = { { 3, 0 }, { 1000, 1 }, { 0, 2 }, { 3, 3 }, { 7, 4 } };
+    barretenberg::counting_sort(items, 5, [](const auto& item) { return item.first; });
+    const std::vector<std::pair<size_t, size_t>> expected = { { 0, 2 }, { 3, 0 }, { 3, 3 }, { 7, 4 }, { 1000, 1 } };
+    EXPECT_EQ(items, expected);
+
+    std::vector<uint64_t> values = { 5, 1 << 20, 2, 9 };
+    barretenberg::counting_sort(values, 9);
+    EXPECT_EQ(values, std::vector<uint64_t>({ 2, 5, 9, 1 << 20 }));
+}
@@ -25,4 +25,16 @@ inline size_t compute_num_threads()
     num_threads = static_cast<size_t>(1ULL << numeric::get_msb(num_threads));
     return num_threads;
 }
+
+//
+// The number of threads available to barretenberg, without rounding. This sizes the shared thread pool
+// (see thread_pool.hpp), whose parallel_for does not require a power of two number of chunks.
+inline size_t compute_num_cpus()
+{
+#ifndef NO_MULTITHREADING
+    return static_cast<size_t>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
 } // namespace max_threads
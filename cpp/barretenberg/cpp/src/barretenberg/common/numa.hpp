@@ -0,0 +1,312 @@
+#pragma once
+#include "mem.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__linux__) && !defined(__wasm__)
+#include <fstream>
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <string>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define BB_NUMA_LINUX
+#endif
+
+/**
+ * @brief Best-effort NUMA placement helpers.
+ *
+ * @details Nodes are numbered densely from 0 and only include nodes that have a cpu in the process's affinity mask, so
+ * running under `numactl --cpunodebind` or `taskset` shrinks the topology accordingly. Placement is a hint: if the
+ * kernel rejects a policy (e.g. inside a container without CAP_SYS_NICE) memory falls back to first-touch placement.
+ * On non-Linux and WASM builds there is a single node and every helper degrades to plain allocation.
+ */
+namespace barretenberg::numa {
+
+#ifdef BB_NUMA_LINUX
+namespace detail {
+
+inline std::vector<int> parse_cpu_list(const std::string& list)
+{
+    // The kernel's list format, e.g. "0-3,8,10-11".
+    std::vector<int> result;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t end = list.find(',', pos);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        const std::string range = list.substr(pos, end - pos);
+        const size_t dash = range.find('-');
+        if (!range.empty() && range[0] >= '0' && range[0] <= '9') {
+            const int first = std::stoi(range.substr(0, dash));
+            const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int i = first; i <= last; ++i) {
+                result.push_back(i);
+            }
+        }
+        pos = end + 1;
+    }
+    return result;
+}
+
+inline std::string read_line(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+struct Topology {
+    std::vector<int> node_ids;             // dense index -> kernel node id
+    std::vector<std::vector<int>> cpus;    // dense index -> allowed cpus on that node
+    std::vector<size_t> node_of_cpu;       // cpu -> dense index
+
+    Topology()
+    {
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        const bool have_mask = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+        for (const int node : parse_cpu_list(read_line("/sys/devices/system/node/online"))) {
+            std::vector<int> node_cpus;
+            for (const int cpu : parse_cpu_list(
+                     read_line("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"))) {
+                if (cpu < CPU_SETSIZE && (!have_mask || CPU_ISSET(static_cast<size_t>(cpu), &allowed))) {
+                    node_cpus.push_back(cpu);
+                }
+            }
+            if (node_cpus.empty()) {
+                continue;
+            }
+            for (const int cpu : node_cpus) {
+                if (node_of_cpu.size() <= static_cast<size_t>(cpu)) {
+                    node_of_cpu.resize(static_cast<size_t>(cpu) + 1, 0);
+                }
+                node_of_cpu[static_cast<size_t>(cpu)] = node_ids.size();
+            }
+            node_ids.push_back(node);
+            cpus.push_back(std::move(node_cpus));
+        }
+        if (node_ids.empty()) {
+            node_ids.push_back(0);
+            cpus.emplace_back();
+        }
+    }
+};
+
+inline Topology& mutable_topology()
+{
+    static Topology instance;
+    return instance;
+}
+
+inline const Topology& topology()
+{
+    return mutable_topology();
+}
+
+inline size_t page_size()
+{
+    static const auto size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+inline void set_policy(void* ptr, const size_t num_bytes, const int mode, const std::vector<size_t>& nodes)
+{
+    constexpr size_t bits_per_word = 8 * sizeof(unsigned long);
+    const auto& ids = topology().node_ids;
+    std::vector<unsigned long> mask;
+    for (const size_t node : nodes) {
+        const auto id = static_cast<size_t>(ids[node]);
+        if (mask.size() <= id / bits_per_word) {
+            mask.resize(id / bits_per_word + 1, 0);
+        }
+        mask[id / bits_per_word] |= 1UL << (id % bits_per_word);
+    }
+    // The policy only applies to whole pages, so shrink the range to the pages it fully covers.
+    const size_t page = page_size();
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + page - 1) & ~(page - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + num_bytes) & ~(page - 1);
+    if (end <= begin) {
+        return;
+    }
+    // Failure is not an error: the memory is still usable, it just isn't placed.
+    syscall(SYS_mbind,
+            begin,
+            end - begin,
+            mode,
+            mask.data(),
+            mask.size() * bits_per_word + 1,
+            static_cast<unsigned>(MPOL_MF_MOVE));
+}
+
+} // namespace detail
+#endif
+
+/**
+ * @brief The number of NUMA nodes this process may run on. Always at least 1.
+ */
+inline size_t num_nodes()
+{
+#ifdef BB_NUMA_LINUX
+    return detail::topology().node_ids.size();
+#else
+    return 1;
+#endif
+}
+
+/**
+ * @brief The cpus of `node` that this process may run on.
+ */
+inline std::vector<int> cpus_of_node(const size_t node)
+{
+#ifdef BB_NUMA_LINUX
+    return node < num_nodes() ? detail::topology().cpus[node] : std::vector<int>();
+#else
+    static_cast<void>(node);
+    return {};
+#endif
+}
+
+/**
+ * @brief The node of the cpu the calling thread is currently running on.
+ */
+inline size_t current_node()
+{
+#ifdef BB_NUMA_LINUX
+    const int cpu = sched_getcpu();
+    const auto& node_of_cpu = detail::topology().node_of_cpu;
+    if (cpu < 0 || static_cast<size_t>(cpu) >= node_of_cpu.size()) {
+        return 0;
+    }
+    return node_of_cpu[static_cast<size_t>(cpu)];
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief The node responsible for chunk `index` when `num_chunks` chunks are spread evenly, in order, over the nodes.
+ *
+ * @details Work that is split into per-thread chunks uses this to decide where both the chunk's memory and the thread
+ * that processes it should live.
+ */
+inline size_t node_of_chunk(const size_t index, const size_t num_chunks)
+{
+    return num_chunks == 0 ? 0 : (index * num_nodes()) / num_chunks;
+}
+
+/**
+ * @brief Restrict the calling thread to the cpus of `node`.
+ */
+inline void bind_current_thread_to_node(const size_t node)
+{
+#ifdef BB_NUMA_LINUX
+    if (num_nodes() < 2 || node >= num_nodes()) {
+        return;
+    }
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (const int cpu : detail::topology().cpus[node]) {
+        CPU_SET(static_cast<size_t>(cpu), &mask);
+    }
+    sched_setaffinity(0, sizeof(mask), &mask);
+#else
+    static_cast<void>(node);
+#endif
+}
+
+/**
+ * @brief Restrict this process to the cpus of its first `count` nodes, and the topology to those nodes.
+ *
+ * @details Afterwards num_nodes() returns `count` (or fewer, if there are fewer nodes) and the other helpers only use
+ * those nodes, so a thread pool created afterwards only spans them. The topology is read once and cached, which a
+ * forked child inherits from its parent; this is how such a child measures a subset of the sockets. It must be called
+ * before any other thread uses these helpers.
+ */
+inline void restrict_to_nodes(const size_t count)
+{
+#ifdef BB_NUMA_LINUX
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    bool any_cpu = false;
+    for (size_t node = 0; node < count && node < num_nodes(); ++node) {
+        for (const int cpu : detail::topology().cpus[node]) {
+            CPU_SET(static_cast<size_t>(cpu), &mask);
+            any_cpu = true;
+        }
+    }
+    if (any_cpu) {
+        sched_setaffinity(0, sizeof(mask), &mask);
+    }
+    detail::mutable_topology() = detail::Topology();
+#else
+    static_cast<void>(count);
+#endif
+}
+
+/**
+ * @brief Prefer to place the pages that lie entirely within [ptr, ptr + num_bytes) on `node`.
+ *
+ * @details Call this before the memory is first written to avoid migrating pages. The range is usually heap memory,
+ * and the policy stays with its pages after they are freed and handed out again, so it is a preference
+ * (MPOL_PREFERRED) rather than a binding: later users of the pages fall back to other nodes when `node` is full.
+ */
+inline void bind_range(void* ptr, const size_t num_bytes, const size_t node)
+{
+#ifdef BB_NUMA_LINUX
+    if (num_nodes() < 2 || node >= num_nodes()) {
+        return;
+    }
+    detail::set_policy(ptr, num_bytes, MPOL_PREFERRED, { node });
+#else
+    static_cast<void>(ptr);
+    static_cast<void>(num_bytes);
+    static_cast<void>(node);
+#endif
+}
+
+/**
+ * @brief Spread the pages within [ptr, ptr + num_bytes) round-robin over every node.
+ */
+inline void interleave_range(void* ptr, const size_t num_bytes)
+{
+#ifdef BB_NUMA_LINUX
+    if (num_nodes() < 2) {
+        return;
+    }
+    std::vector<size_t> nodes(num_nodes());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        nodes[i] = i;
+    }
+    detail::set_policy(ptr, num_bytes, MPOL_INTERLEAVE, nodes);
+#else
+    static_cast<void>(ptr);
+    static_cast<void>(num_bytes);
+#endif
+}
+
+/**
+ * @brief Allocate `num_bytes` with its pages interleaved over every node. Release with aligned_free.
+ *
+ * @details Suited to large tables that every thread reads at random, such as the Pippenger point table: interleaving
+ * splits the memory bandwidth evenly between the sockets instead of saturating the one that happened to touch the
+ * table first.
+ */
+inline void* aligned_alloc_interleaved(const size_t num_bytes)
+{
+#ifdef BB_NUMA_LINUX
+    if (num_nodes() > 1) {
+        // Page aligned and padded so that the policy covers the whole allocation and nothing else.
+        const size_t page = detail::page_size();
+        void* ptr = aligned_alloc(page, pad(num_bytes, page));
+        interleave_range(ptr, pad(num_bytes, page));
+        return ptr;
+    }
+#endif
+    return aligned_alloc(64, num_bytes);
+}
+
+} // namespace barretenberg::numa
@@ -0,0 +1,63 @@
+#include "numa.hpp"
+#include "thread_pool.hpp"
+#include <atomic>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(numa, topology_is_consistent)
+{
+    const size_t num_nodes = barretenberg::numa::num_nodes();
+    EXPECT_GE(num_nodes, 1UL);
+    EXPECT_LT(barretenberg::numa::current_node(), num_nodes);
+}
+
+TEST(numa, chunks_are_spread_in_order_over_every_node)
+{
+    const size_t num_nodes = barretenberg::numa::num_nodes();
+    constexpr size_t num_chunks = 37;
+    size_t previous = 0;
+    for (size_t i = 0; i < num_chunks; ++i) {
+        const size_t node = barretenberg::numa::node_of_chunk(i, num_chunks);
+        EXPECT_LT(node, num_nodes);
+        EXPECT_GE(node, previous);
+        previous = node;
+    }
+    EXPECT_EQ(barretenberg::numa::node_of_chunk(0, num_chunks), 0UL);
+}
+
+// Restricting changes the affinity of the whole process, so it runs in a forked child as a forked benchmark would.
+TEST(numa, restricting_a_forked_child_shrinks_its_topology)
+{
+    EXPECT_EXIT(
+        {
+            barretenberg::numa::restrict_to_nodes(1);
+            const bool restricted =
+                barretenberg::numa::num_nodes() == 1 && barretenberg::numa::current_node() == 0 &&
+                barretenberg::numa::node_of_chunk(5, 6) == 0;
+            exit(restricted ? 0 : 1);
+        },
+        ::testing::ExitedWithCode(0),
+        "");
+}
+
+TEST(numa, placed_memory_is_usable)
+{
+    constexpr size_t num_bytes = (1UL << 20) + 123;
+    auto* interleaved = static_cast<uint8_t*>(barretenberg::numa::aligned_alloc_interleaved(num_bytes));
+    memset(interleaved, 0xab, num_bytes);
+    barretenberg::numa::bind_range(interleaved + 1000, num_bytes / 2, 0);
+    EXPECT_EQ(interleaved[num_bytes - 1], 0xab);
+    EXPECT_EQ(interleaved[1000], 0xab);
+    aligned_free(interleaved);
+}
+
+TEST(numa, parallel_for_numa_visits_every_index_once)
+{
+    constexpr size_t num_iterations = 67;
+    std::vector<std::atomic<size_t>> counts(num_iterations);
+    barretenberg::parallel_for_numa(num_iterations, [&](size_t i) { counts[i]++; });
+    for (auto& count : counts) {
+        EXPECT_EQ(count.load(), 1UL);
+    }
+}
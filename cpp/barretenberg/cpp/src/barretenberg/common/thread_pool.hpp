@@ -0,0 +1,499 @@
+#pragma once
+#include <cstddef>
+#include <exception>
+#include <functional>
+
+#ifndef NO_MULTITHREADING
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "max_threads.hpp"
+#include "numa.hpp"
+#endif
+
+namespace barretenberg {
+
+#ifndef NO_MULTITHREADING
+
+/**
+ * @brief A persistent work-stealing thread pool shared by every module.
+ *
+ * @details Each worker owns a task deque. A worker pops from the back of its own deque (so that recently spawned,
+ * cache-hot work runs first) and steals from the front of the other deques when it runs dry. Tasks submitted from
+ * threads outside of the pool are placed in a shared injection deque that every worker steals from.
+ *
+ * A thread waiting on a TaskGroup does not block: it keeps executing pending tasks until the group completes. This
+ * makes nested parallelism (a parallel_for issued from inside a task) safe, and means the calling thread contributes
+ * to the computation rather than idling. The pool therefore spawns one fewer worker than the number of available
+ * cpus.
+ *
+ * On multi-socket machines the workers are spread evenly over the NUMA nodes and pinned there, and each node has a
+ * queue of tasks that may only run on that node (see TaskGroup::run(task, node) and parallel_for_numa). Pinned
+ * workers make the placement of chunked per-thread memory, placed with numa::bind_range, meaningful.
+ */
+class ThreadPool {
+  public:
+    using Task = std::function<void()>;
+
+    /**
+     * @brief A set of tasks that can be waited on as a unit.
+     *
+     * @details The first exception thrown by a task in the group is rethrown by wait().
+     */
+    class TaskGroup {
+      public:
+        explicit TaskGroup(ThreadPool& pool = ThreadPool::get())
+            : pool(pool)
+        {}
+        TaskGroup(const TaskGroup& other) = delete;
+        TaskGroup(TaskGroup&& other) = delete;
+        TaskGroup& operator=(const TaskGroup& other) = delete;
+        TaskGroup& operator=(TaskGroup&& other) = delete;
+        ~TaskGroup()
+        {
+            // Tasks reference this group, so it must outlive them. Any exception is dropped here.
+            while (outstanding.load(std::memory_order_acquire) != 0) {
+                help();
+            }
+        }
+
+        void run(Task task) { pool.push(track(std::move(task))); }
+
+        /**
+         * @brief Run `task` on a thread of NUMA node `node`. Falls back to run(task) if the node has no workers.
+         */
+        void run(Task task, const size_t node)
+        {
+            if (!pool.node_has_workers(node)) {
+                run(std::move(task));
+                return;
+            }
+            pool.push_to_node(track(std::move(task)), node);
+        }
+
+        void wait()
+        {
+            while (outstanding.load(std::memory_order_acquire) != 0) {
+                help();
+            }
+            if (exception) {
+                std::exception_ptr to_rethrow = exception;
+                exception = nullptr;
+                std::rethrow_exception(to_rethrow);
+            }
+        }
+
+      private:
+        Task track(Task task)
+        {
+            outstanding.fetch_add(1, std::memory_order_relaxed);
+            return [this, task = std::move(task)]() {
+                try {
+                    task();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(exception_mutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                }
+                outstanding.fetch_sub(1, std::memory_order_acq_rel);
+            };
+        }
+
+        void help()
+        {
+            if (!pool.try_run_one()) {
+                std::this_thread::yield();
+            }
+        }
+
+        ThreadPool& pool;
+        std::atomic<size_t> outstanding = 0;
+        std::mutex exception_mutex;
+        std::exception_ptr exception;
+    };
+
+    /**
+     * @brief Construct a pool that runs work on `num_cpus` threads, including the thread that waits on the work.
+     */
+    explicit ThreadPool(const size_t num_cpus)
+        : queues(std::max(num_cpus, size_t(1)))
+    {
+        for (auto& queue : queues) {
+            queue = std::make_unique<Queue>();
+        }
+        // The last queue is the injection queue for threads that do not belong to the pool.
+        const size_t num_workers = queues.size() - 1;
+        const size_t num_nodes = numa::num_nodes();
+        if (num_nodes > 1) {
+            node_queues.resize(num_nodes);
+            for (auto& queue : node_queues) {
+                queue = std::make_unique<Queue>();
+            }
+            node_pending = std::make_unique<std::atomic<size_t>[]>(num_nodes);
+            node_worker_counts.resize(num_nodes, 0);
+            for (size_t i = 0; i < num_workers; ++i) {
+                node_worker_counts[numa::node_of_chunk(i, num_workers)]++;
+            }
+        }
+        workers.reserve(num_workers);
+        for (size_t i = 0; i < num_workers; ++i) {
+            workers.emplace_back([this, i, num_workers]() {
+                numa::bind_current_thread_to_node(numa::node_of_chunk(i, num_workers));
+                worker_loop(i);
+            });
+        }
+    }
+
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool(ThreadPool&& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    ThreadPool& operator=(ThreadPool&& other) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            stopping = true;
+        }
+        sleep_condition.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief The process-wide pool. Sized by max_threads::compute_num_cpus(), which is not rounded to a power of two.
+     */
+    static ThreadPool& get()
+    {
+        static ThreadPool pool(max_threads::compute_num_cpus());
+        return pool;
+    }
+
+    /**
+     * @brief The number of threads that execute work: the workers plus the waiting thread.
+     */
+    [[nodiscard]] size_t num_threads() const { return queues.size(); }
+
+    /**
+     * @brief Enqueue a task. Prefer TaskGroup::run, which allows the caller to wait on completion.
+     */
+    void push(Task task) { push_to_queue(*queues[current_queue_index()], pending, std::move(task), false); }
+
+    /**
+     * @brief Whether tasks bound to `node` can be run: multi-node pools only accept node-bound tasks for nodes that
+     * have at least one worker.
+     */
+    [[nodiscard]] bool node_has_workers(const size_t node) const
+    {
+        return node < node_worker_counts.size() && node_worker_counts[node] != 0;
+    }
+
+    /**
+     * @brief Run a single pending task on the calling thread, if there is one.
+     *
+     * @return true if a task was executed.
+     */
+    bool try_run_one()
+    {
+        Task task;
+        if (!try_pop(task)) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+  private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    struct ThreadIdentity {
+        ThreadPool* pool = nullptr;
+        size_t index = 0;
+        size_t node = 0;
+    };
+
+    void push_to_node(Task task, const size_t node)
+    {
+        // Wake everybody: notify_one could pick a worker on another node, which would go straight back to sleep.
+        push_to_queue(*node_queues[node], node_pending[node], std::move(task), true);
+    }
+
+    void push_to_queue(Queue& queue, std::atomic<size_t>& counter, Task task, const bool wake_all)
+    {
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            counter.fetch_add(1, std::memory_order_release);
+            queue.tasks.emplace_back(std::move(task));
+        }
+        {
+            // Taking the lock prevents a lost wakeup between a worker checking for work and going to sleep.
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+        }
+        if (wake_all) {
+            sleep_condition.notify_all();
+        } else {
+            sleep_condition.notify_one();
+        }
+    }
+
+    static ThreadIdentity& thread_identity()
+    {
+        static thread_local ThreadIdentity identity;
+        return identity;
+    }
+
+    size_t current_queue_index()
+    {
+        const ThreadIdentity& identity = thread_identity();
+        return identity.pool == this ? identity.index : queues.size() - 1;
+    }
+
+    size_t current_node()
+    {
+        const ThreadIdentity& identity = thread_identity();
+        // Workers are pinned; anybody else may migrate, so ask where we are now.
+        return identity.pool == this ? identity.node : numa::current_node();
+    }
+
+    /**
+     * @brief Whether there may be a task that the calling thread is allowed to run.
+     */
+    bool has_work(const size_t node)
+    {
+        return pending.load(std::memory_order_acquire) != 0 ||
+               (node_pending && node_pending[node].load(std::memory_order_acquire) != 0);
+    }
+
+    bool try_pop(Task& task)
+    {
+        const size_t node = current_node();
+        if (!has_work(node)) {
+            return false;
+        }
+        const size_t home = current_queue_index();
+        {
+            // Our own work is taken LIFO.
+            Queue& queue = *queues[home];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                pending.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        if (!node_queues.empty()) {
+            // Tasks bound to our node come next. Tasks bound to other nodes are never stolen.
+            Queue& queue = *node_queues[node];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                node_pending[node].fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        // Everybody else's work is stolen FIFO, so that the oldest (and typically largest) tasks migrate.
+        for (size_t offset = 1; offset < queues.size(); ++offset) {
+            Queue& queue = *queues[(home + offset) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                pending.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void worker_loop(const size_t index)
+    {
+        const size_t node = numa::node_of_chunk(index, workers_size());
+        thread_identity() = { this, index, node };
+        while (true) {
+            if (try_run_one()) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            sleep_condition.wait(lock, [this, node]() { return stopping || has_work(node); });
+            if (stopping) {
+                return;
+            }
+        }
+    }
+
+    size_t workers_size() const { return queues.size() - 1; }
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::unique_ptr<Queue>> node_queues;
+    std::vector<size_t> node_worker_counts;
+    std::vector<std::thread> workers;
+    // Tasks in `queues`, which any thread may run, and tasks in each of `node_queues`.
+    std::atomic<size_t> pending = 0;
+    std::unique_ptr<std::atomic<size_t>[]> node_pending;
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_condition;
+    bool stopping = false;
+};
+
+/**
+ * @brief Call `func(i)` for every i in [0, num_iterations), distributing the calls over the shared pool.
+ *
+ * @details Returns once every call has completed. May be called from within another parallel region.
+ */
+inline void parallel_for(const size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    if (num_iterations == 0) {
+        return;
+    }
+    ThreadPool& pool = ThreadPool::get();
+    if (num_iterations == 1 || pool.num_threads() == 1) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+    ThreadPool::TaskGroup group(pool);
+    for (size_t i = 1; i < num_iterations; ++i) {
+        group.run([&func, i]() { func(i); });
+    }
+    func(0);
+    group.wait();
+}
+
+/**
+ * @brief Split [0, num_points) into contiguous chunks and call `func(start, end)` on each in parallel.
+ *
+ * @details The number of chunks is the number of pool threads (which need not be a power of two), reduced so that
+ * no chunk is smaller than `min_iterations_per_chunk`. The chunks differ in size by at most one.
+ */
+inline void parallel_for_range(const size_t num_points,
+                               const std::function<void(size_t, size_t)>& func,
+                               const size_t min_iterations_per_chunk = 16)
+{
+    if (num_points == 0) {
+        return;
+    }
+    const size_t max_chunks = std::max(num_points / std::max(min_iterations_per_chunk, size_t(1)), size_t(1));
+    const size_t num_chunks = std::min(ThreadPool::get().num_threads(), max_chunks);
+    const size_t chunk_size = num_points / num_chunks;
+    const size_t leftovers = num_points % num_chunks;
+    parallel_for(num_chunks, [&](size_t chunk) {
+        // The first `leftovers` chunks take one extra point each.
+        const size_t start = chunk * chunk_size + std::min(chunk, leftovers);
+        const size_t end = start + chunk_size + (chunk < leftovers ? 1 : 0);
+        func(start, end);
+    });
+}
+
+/**
+ * @brief As parallel_for, but call `func(i)` on a thread of NUMA node numa::node_of_chunk(i, num_iterations).
+ *
+ * @details For per-thread chunked work whose memory was placed with numa::bind_range using the same chunk to node
+ * mapping. On single node machines this is parallel_for.
+ */
+inline void parallel_for_numa(const size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    ThreadPool& pool = ThreadPool::get();
+    if (numa::num_nodes() < 2 || num_iterations < 2 || pool.num_threads() == 1) {
+        parallel_for(num_iterations, func);
+        return;
+    }
+    ThreadPool::TaskGroup group(pool);
+    for (size_t i = 0; i < num_iterations; ++i) {
+        group.run([&func, i]() { func(i); }, numa::node_of_chunk(i, num_iterations));
+    }
+    group.wait();
+}
+
+#else
+
+/**
+ * @brief Single threaded stand-in for ThreadPool, with the same interface: a pool of one thread, on which a TaskGroup
+ * runs each task as soon as it is submitted.
+ */
+class ThreadPool {
+  public:
+    using Task = std::function<void()>;
+
+    class TaskGroup {
+      public:
+        explicit TaskGroup(ThreadPool& /*unused*/ = ThreadPool::get()) {}
+        TaskGroup(const TaskGroup& other) = delete;
+        TaskGroup(TaskGroup&& other) = delete;
+        TaskGroup& operator=(const TaskGroup& other) = delete;
+        TaskGroup& operator=(TaskGroup&& other) = delete;
+        ~TaskGroup() = default;
+
+        void run(const Task& task)
+        {
+            // As in the threaded pool, the first exception is held until wait().
+            try {
+                task();
+            } catch (...) {
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        void run(const Task& task, const size_t /*unused*/) { run(task); }
+
+        void wait()
+        {
+            if (exception) {
+                std::exception_ptr to_rethrow = exception;
+                exception = nullptr;
+                std::rethrow_exception(to_rethrow);
+            }
+        }
+
+      private:
+        std::exception_ptr exception;
+    };
+
+    explicit ThreadPool(const size_t /*unused*/ = 1) {}
+
+    static ThreadPool& get()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    [[nodiscard]] size_t num_threads() const { return 1; }
+};
+
+inline void parallel_for(const size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    for (size_t i = 0; i < num_iterations; ++i) {
+        func(i);
+    }
+}
+
+inline void parallel_for_range(const size_t num_points,
+                               const std::function<void(size_t, size_t)>& func,
+                               const size_t /*unused*/ = 16)
+{
+    func(0, num_points);
+}
+
+inline void parallel_for_numa(const size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    parallel_for(num_iterations, func);
+}
+
+#endif
+
+} // namespace barretenberg
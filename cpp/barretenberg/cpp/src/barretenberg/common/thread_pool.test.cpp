@@ -0,0 +1,96 @@
+#include "thread_pool.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST(thread_pool, parallel_for_visits_every_index_once)
+{
+    constexpr size_t num_iterations = 1031;
+    std::vector<std::atomic<size_t>> counts(num_iterations);
+    barretenberg::parallel_for(num_iterations, [&](size_t i) { counts[i]++; });
+    for (auto& count : counts) {
+        EXPECT_EQ(count.load(), 1UL);
+    }
+}
+
+TEST(thread_pool, parallel_for_range_covers_range_with_uneven_chunks)
+{
+    // Neither the range nor (in general) the number of chunks is a power of two.
+    constexpr size_t num_points = 12345;
+    std::vector<size_t> values(num_points, 0);
+    barretenberg::parallel_for_range(
+        num_points,
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                values[i] += i;
+            }
+        },
+        7);
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(values[i], i);
+    }
+}
+
+TEST(thread_pool, parallel_for_range_respects_minimum_chunk_size)
+{
+    std::atomic<size_t> num_chunks = 0;
+    barretenberg::parallel_for_range(
+        10, [&](size_t start, size_t end) {
+            num_chunks++;
+            EXPECT_EQ(start, 0UL);
+            EXPECT_EQ(end, 10UL);
+        },
+        16);
+    EXPECT_EQ(num_chunks.load(), 1UL);
+}
+
+TEST(thread_pool, nested_parallel_for)
+{
+    constexpr size_t outer = 17;
+    constexpr size_t inner = 129;
+    std::vector<size_t> sums(outer, 0);
+    barretenberg::parallel_for(outer, [&](size_t i) {
+        std::vector<size_t> values(inner, 0);
+        barretenberg::parallel_for(inner, [&](size_t j) { values[j] = i * j; });
+        sums[i] = std::accumulate(values.begin(), values.end(), size_t(0));
+    });
+    for (size_t i = 0; i < outer; ++i) {
+        EXPECT_EQ(sums[i], i * (inner * (inner - 1) / 2));
+    }
+}
+
+TEST(thread_pool, task_group_waits_for_all_tasks)
+{
+    std::atomic<size_t> total = 0;
+    barretenberg::ThreadPool::TaskGroup group;
+    for (size_t i = 0; i < 100; ++i) {
+        group.run([&total, i]() { total += i; });
+    }
+    group.wait();
+    EXPECT_EQ(total.load(), 4950UL);
+}
+
+TEST(thread_pool, task_group_rethrows_exception)
+{
+    barretenberg::ThreadPool::TaskGroup group;
+    group.run([]() { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(group.wait(), std::runtime_error);
+}
+
+#ifndef NO_MULTITHREADING
+
+TEST(thread_pool, independent_pools_do_not_share_work)
+{
+    barretenberg::ThreadPool pool(3);
+    EXPECT_EQ(pool.num_threads(), 3UL);
+    std::atomic<size_t> count = 0;
+    barretenberg::ThreadPool::TaskGroup group(pool);
+    for (size_t i = 0; i < 64; ++i) {
+        group.run([&count]() { count++; });
+    }
+    group.wait();
+    EXPECT_EQ(count.load(), 64UL);
+}
+#endif
@@ -0,0 +1,98 @@
+#include "aes128.hpp"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+using namespace benchmark;
+
+namespace {
+// Roughly the size of an encrypted note.
+constexpr size_t NOTE_LENGTH = 144;
+constexpr size_t NUM_NOTES = 1024;
+
+std::mt19937 engine(1234);
+
+std::vector<uint8_t> random_bytes(size_t length)
+{
+    std::vector<uint8_t> bytes(length);
+    for (auto& byte : bytes) {
+        byte = static_cast<uint8_t>(engine());
+    }
+    return bytes;
+}
+
+struct notes {
+    std::vector<uint8_t> keys = random_bytes(16 * NUM_NOTES);
+    std::vector<uint8_t> ivs = random_bytes(16 * NUM_NOTES);
+    std::vector<uint8_t> buffers = random_bytes(NOTE_LENGTH * NUM_NOTES);
+
+    std::vector<crypto::aes128::cbc_message> messages()
+    {
+        std::vector<crypto::aes128::cbc_message> result;
+        for (size_t i = 0; i < NUM_NOTES; ++i) {
+            result.push_back({ &buffers[i * NOTE_LENGTH], &ivs[i * 16], &keys[i * 16], NOTE_LENGTH });
+        }
+        return result;
+    }
+};
+} // namespace
+
+void decrypt_bench(State& state) noexcept
+{
+    const auto length = static_cast<size_t>(state.range(0));
+    auto key = random_bytes(16);
+    auto iv = random_bytes(16);
+    auto buffer = random_bytes(length);
+    for (auto _ : state) {
+        crypto::aes128::decrypt_buffer_cbc(buffer.data(), iv.data(), key.data(), length);
+        DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(length));
+}
+BENCHMARK(decrypt_bench)->Arg(NOTE_LENGTH)->Arg(1 << 16);
+
+// The block functions on their own, as decrypt_buffer_cbc runs without AES-NI.
+void decrypt_software_bench(State& state) noexcept
+{
+    const auto length = static_cast<size_t>(state.range(0));
+    auto key = random_bytes(16);
+    auto buffer = random_bytes(length);
+    uint8_t round_key[176];
+    for (auto _ : state) {
+        crypto::aes128::expand_key(key.data(), round_key);
+        for (size_t offset = 0; offset + 16 <= length; offset += 16) {
+            crypto::aes128::aes128_inverse_cipher(&buffer[offset], round_key);
+        }
+        DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(length));
+}
+BENCHMARK(decrypt_software_bench)->Arg(NOTE_LENGTH)->Arg(1 << 16);
+
+void decrypt_notes_one_at_a_time_bench(State& state) noexcept
+{
+    notes data;
+    const auto messages = data.messages();
+    for (auto _ : state) {
+        for (const auto& message : messages) {
+            crypto::aes128::decrypt_buffer_cbc(message.buffer, message.iv, message.key, message.length);
+        }
+        DoNotOptimize(data.buffers.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_NOTES));
+}
+BENCHMARK(decrypt_notes_one_at_a_time_bench)->Unit(kMicrosecond);
+
+void decrypt_notes_batch_bench(State& state) noexcept
+{
+    notes data;
+    const auto messages = data.messages();
+    for (auto _ : state) {
+        crypto::aes128::decrypt_buffers_cbc(messages);
+        DoNotOptimize(data.buffers.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_NOTES));
+}
+BENCHMARK(decrypt_notes_batch_bench)->Unit(kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -1,4 +1,6 @@
 #include "aes128.hpp"
+#include "aes128_simd.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 
 #include <cstddef>
 #include <cstdint>
@@ -226,6 +228,10 @@ void aes128_cipher(uint8_t* state, const uint8_t* round_key)
 
 void encrypt_buffer_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length)
 {
+    if (simd::aes_ni_supported()) {
+        simd::encrypt_buffer_cbc_aes_ni(buffer, iv, key, length);
+        return;
+    }
     uint8_t round_key[176];
     expand_key(key, round_key);
 
@@ -246,6 +252,10 @@ void encrypt_buffer_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const
 
 void decrypt_buffer_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length)
 {
+    if (simd::aes_ni_supported()) {
+        simd::decrypt_buffer_cbc_aes_ni(buffer, iv, key, length);
+        return;
+    }
     uint8_t round_key[176];
     expand_key(key, round_key);
     uint8_t block_state[16]{};
@@ -262,5 +272,24 @@ void decrypt_buffer_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const
     }
 }
 
+void decrypt_buffers_cbc(std::span<const cbc_message> messages)
+{
+    // Each chunk gets at least a few full groups of messages.
+    constexpr size_t min_messages_per_chunk = 4 * simd::AES_NI_LANES;
+    barretenberg::parallel_for_range(
+        messages.size(),
+        [messages](size_t start, size_t end) {
+            const auto chunk = messages.subspan(start, end - start);
+            if (simd::aes_ni_supported()) {
+                simd::decrypt_buffers_cbc_aes_ni(chunk);
+                return;
+            }
+            for (const cbc_message& message : chunk) {
+                decrypt_buffer_cbc(message.buffer, message.iv, message.key, message.length);
+            }
+        },
+        min_messages_per_chunk);
+}
+
 } // namespace aes128
 } // namespace crypto
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <array>
+#include <span>
 #include "memory.h"
 
 #include <iostream>
@@ -25,6 +26,24 @@ void aes128_cipher(uint8_t* state, const uint8_t* round_key);
 void encrypt_buffer_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length);
 void decrypt_buffer_cbc(uint8_t* buf, uint8_t* iv, const uint8_t* key, const size_t length);
 
+/**
+ * One message for decrypt_buffers_cbc: `length` bytes at `buffer`, decrypted in place with `key`, updating `iv`.
+ */
+struct cbc_message {
+    uint8_t* buffer;
+    uint8_t* iv;
+    const uint8_t* key;
+    size_t length;
+};
+
+/**
+ * @brief Decrypt many independent messages, each as decrypt_buffer_cbc would.
+ *
+ * @details Suited to trial-decrypting every note in a block. Messages are split across threads and, with AES-NI,
+ * each thread expands the keys of several messages at once. Messages must not share buffers or IVs.
+ */
+void decrypt_buffers_cbc(std::span<const cbc_message> messages);
+
 constexpr uint64_t sparse_base = 9;
 static constexpr uint8_t sbox[256] = {
     // 0     1    2      3     4    5     6     7      8    9     A      B    C     D     E     F
@@ -1,6 +1,9 @@
 #include "aes128.hpp"
+#include "aes128_simd.hpp"
 
 #include <gtest/gtest.h>
+#include <random>
+#include <vector>
 
 TEST(aes128, verify_cipher)
 {
@@ -58,4 +61,95 @@ TEST(aes128, decrypt_buffer_cbc)
     for (size_t i = 0; i < 64; ++i) {
         EXPECT_EQ(in[i], out[i]);
     }
-}
\ No newline at end of file
+}
+namespace {
+std::mt19937 engine(1234);
+
+std::vector<uint8_t> random_bytes(size_t length)
+{
+    std::vector<uint8_t> bytes(length);
+    for (auto& byte : bytes) {
+        byte = static_cast<uint8_t>(engine());
+    }
+    return bytes;
+}
+
+// CBC on top of the software block functions, whichever implementation the buffer functions pick.
+void software_cbc(uint8_t* buffer, uint8_t* iv, const uint8_t* key, const size_t length, const bool encrypt)
+{
+    uint8_t round_key[176];
+    crypto::aes128::expand_key(key, round_key);
+    for (size_t offset = 0; offset + 16 <= length; offset += 16) {
+        uint8_t* block = buffer + offset;
+        if (encrypt) {
+            for (size_t i = 0; i < 16; ++i) {
+                block[i] ^= iv[i];
+            }
+            crypto::aes128::aes128_cipher(block, round_key);
+            memcpy(iv, block, 16);
+        } else {
+            uint8_t ciphertext[16];
+            memcpy(ciphertext, block, 16);
+            crypto::aes128::aes128_inverse_cipher(block, round_key);
+            for (size_t i = 0; i < 16; ++i) {
+                block[i] ^= iv[i];
+            }
+            memcpy(iv, ciphertext, 16);
+        }
+    }
+}
+} // namespace
+
+TEST(aes128, aes_ni_matches_software)
+{
+    if (!crypto::aes128::simd::aes_ni_supported()) {
+        GTEST_SKIP() << "no AES-NI";
+    }
+    // Lengths either side of the 8 blocks decrypted at a time, including partial trailing blocks.
+    for (size_t length = 0; length < 16 * 20; length += 7) {
+        const auto key = random_bytes(16);
+        const auto iv = random_bytes(16);
+        const auto message = random_bytes(length);
+        for (const bool encrypt : { true, false }) {
+            auto expected = message;
+            auto expected_iv = iv;
+            software_cbc(expected.data(), expected_iv.data(), key.data(), length, encrypt);
+            auto result = message;
+            auto result_iv = iv;
+            if (encrypt) {
+                crypto::aes128::simd::encrypt_buffer_cbc_aes_ni(result.data(), result_iv.data(), key.data(), length);
+            } else {
+                crypto::aes128::simd::decrypt_buffer_cbc_aes_ni(result.data(), result_iv.data(), key.data(), length);
+            }
+            EXPECT_EQ(result, expected);
+            EXPECT_EQ(result_iv, expected_iv);
+        }
+    }
+}
+
+TEST(aes128, decrypt_buffers_cbc_matches_single)
+{
+    // Messages of different lengths, some with no whole block, and a last group of fewer than AES_NI_LANES.
+    constexpr size_t num_messages = 173;
+    std::vector<std::vector<uint8_t>> keys;
+    std::vector<std::vector<uint8_t>> ivs;
+    std::vector<std::vector<uint8_t>> buffers;
+    for (size_t i = 0; i < num_messages; ++i) {
+        keys.push_back(random_bytes(16));
+        ivs.push_back(random_bytes(16));
+        buffers.push_back(random_bytes((i * 37) % 300));
+    }
+    auto expected = buffers;
+    auto expected_ivs = ivs;
+    std::vector<crypto::aes128::cbc_message> messages;
+    for (size_t i = 0; i < num_messages; ++i) {
+        crypto::aes128::decrypt_buffer_cbc(
+            expected[i].data(), expected_ivs[i].data(), keys[i].data(), expected[i].size());
+        messages.push_back({ buffers[i].data(), ivs[i].data(), keys[i].data(), buffers[i].size() });
+    }
+
+    crypto::aes128::decrypt_buffers_cbc(messages);
+
+    EXPECT_EQ(buffers, expected);
+    EXPECT_EQ(ivs, expected_ivs);
+}
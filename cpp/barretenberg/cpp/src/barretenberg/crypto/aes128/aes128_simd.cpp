@@ -0,0 +1,215 @@
+#include "./aes128_simd.hpp"
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#include <algorithm>
+#include <array>
+#include <immintrin.h>
+#include <utility>
+
+namespace crypto::aes128::simd {
+
+namespace {
+constexpr size_t NUM_ROUND_KEYS = 11;
+constexpr uint8_t round_constants[NUM_ROUND_KEYS] = {
+    0x8d, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36
+};
+// A struct rather than a std::array, which would drop the alignment attributes of __m128i.
+struct round_keys {
+    __m128i key[NUM_ROUND_KEYS];
+};
+
+// One step of the key schedule. SubWord(RotWord(w3)) ^ rcon comes from aesenclast on w3 rotated into every column (its
+// ShiftRows is then a no-op) rather than from aeskeygenassist, which is microcoded and much slower on some cpus.
+__attribute__((target("aes,ssse3"))) inline __m128i next_round_key(__m128i key, const __m128i round_constant)
+{
+    const __m128i rotate_last_word = _mm_set1_epi32(0x0c0f0e0d);
+    const __m128i assist = _mm_aesenclast_si128(_mm_shuffle_epi8(key, rotate_last_word), round_constant);
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+// The same round keys as expand_key, in the same order, for each of `num_keys` keys. Expanding several keys together
+// hides the latency of each step, which would otherwise dominate the decryption of short messages.
+__attribute__((target("aes,ssse3"))) void expand_encryption_keys(const uint8_t* const* key,
+                                                                 round_keys* const* keys,
+                                                                 const size_t num_keys)
+{
+    for (size_t i = 0; i < num_keys; ++i) {
+        keys[i]->key[0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key[i]));
+    }
+    for (size_t round = 1; round < NUM_ROUND_KEYS; ++round) {
+        const __m128i round_constant = _mm_set1_epi32(round_constants[round]);
+        for (size_t i = 0; i < num_keys; ++i) {
+            keys[i]->key[round] = next_round_key(keys[i]->key[round - 1], round_constant);
+        }
+    }
+}
+
+// Round keys for the equivalent inverse cipher used by aesdec: reversed, with InvMixColumns applied to the inner ones.
+__attribute__((target("aes,ssse3"))) void expand_decryption_keys(const uint8_t* const* key,
+                                                                 round_keys* const* keys,
+                                                                 const size_t num_keys)
+{
+    expand_encryption_keys(key, keys, num_keys);
+    for (size_t i = 0; i < num_keys; ++i) {
+        __m128i* round_key = keys[i]->key;
+        for (size_t round = 1; round < 5; ++round) {
+            const __m128i swapped = _mm_aesimc_si128(round_key[10 - round]);
+            round_key[10 - round] = _mm_aesimc_si128(round_key[round]);
+            round_key[round] = swapped;
+        }
+        round_key[5] = _mm_aesimc_si128(round_key[5]);
+        std::swap(round_key[0], round_key[10]);
+    }
+}
+
+__attribute__((target("aes,ssse3"))) inline __m128i decrypt_block(__m128i block, const round_keys& keys)
+{
+    block = _mm_xor_si128(block, keys.key[0]);
+    for (size_t round = 1; round < 10; ++round) {
+        block = _mm_aesdec_si128(block, keys.key[round]);
+    }
+    return _mm_aesdeclast_si128(block, keys.key[10]);
+}
+
+__m128i load(const uint8_t* data)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+void store(uint8_t* data, const __m128i value)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), value);
+}
+
+// The blocks of a CBC message decrypt independently, so they are decrypted AES_NI_LANES at a time.
+__attribute__((target("aes,ssse3"))) void decrypt_cbc(uint8_t* buffer,
+                                                      uint8_t* iv,
+                                                      const round_keys& keys,
+                                                      const size_t length)
+{
+    const size_t num_blocks = length / 16;
+    __m128i previous = load(iv);
+
+    size_t block = 0;
+    for (; block + AES_NI_LANES <= num_blocks; block += AES_NI_LANES) {
+        uint8_t* blocks = buffer + block * 16;
+        __m128i ciphertexts[AES_NI_LANES];
+        __m128i states[AES_NI_LANES];
+        for (size_t i = 0; i < AES_NI_LANES; ++i) {
+            ciphertexts[i] = load(blocks + i * 16);
+            states[i] = _mm_xor_si128(ciphertexts[i], keys.key[0]);
+        }
+        for (size_t round = 1; round < 10; ++round) {
+            for (size_t i = 0; i < AES_NI_LANES; ++i) {
+                states[i] = _mm_aesdec_si128(states[i], keys.key[round]);
+            }
+        }
+        for (size_t i = 0; i < AES_NI_LANES; ++i) {
+            states[i] = _mm_aesdeclast_si128(states[i], keys.key[10]);
+            store(blocks + i * 16, _mm_xor_si128(states[i], i == 0 ? previous : ciphertexts[i - 1]));
+        }
+        previous = ciphertexts[AES_NI_LANES - 1];
+    }
+    for (; block < num_blocks; ++block) {
+        const __m128i ciphertext = load(buffer + block * 16);
+        store(buffer + block * 16, _mm_xor_si128(decrypt_block(ciphertext, keys), previous));
+        previous = ciphertext;
+    }
+    store(iv, previous);
+}
+
+} // namespace
+
+bool aes_ni_supported()
+{
+    // The key schedule also uses pshufb (SSSE3), which every cpu with AES-NI has.
+    static const bool supported = __builtin_cpu_supports("aes") && __builtin_cpu_supports("ssse3");
+    return supported;
+}
+
+__attribute__((target("aes,ssse3"))) void encrypt_buffer_cbc_aes_ni(uint8_t* buffer,
+                                                                     uint8_t* iv,
+                                                                     const uint8_t* key,
+                                                                     size_t length)
+{
+    round_keys keys;
+    round_keys* const keys_pointer = &keys;
+    expand_encryption_keys(&key, &keys_pointer, 1);
+    __m128i state = load(iv);
+    for (size_t offset = 0; offset + 16 <= length; offset += 16) {
+        state = _mm_xor_si128(_mm_xor_si128(state, load(buffer + offset)), keys.key[0]);
+        for (size_t round = 1; round < 10; ++round) {
+            state = _mm_aesenc_si128(state, keys.key[round]);
+        }
+        state = _mm_aesenclast_si128(state, keys.key[10]);
+        store(buffer + offset, state);
+    }
+    store(iv, state);
+}
+
+__attribute__((target("aes,ssse3"))) void decrypt_buffer_cbc_aes_ni(uint8_t* buffer,
+                                                                     uint8_t* iv,
+                                                                     const uint8_t* key,
+                                                                     size_t length)
+{
+    round_keys keys;
+    round_keys* const keys_pointer = &keys;
+    expand_decryption_keys(&key, &keys_pointer, 1);
+    decrypt_cbc(buffer, iv, keys, length);
+}
+
+__attribute__((target("aes,ssse3"))) void decrypt_buffers_cbc_aes_ni(std::span<const cbc_message> messages)
+{
+    round_keys keys[AES_NI_LANES];
+    std::array<round_keys*, AES_NI_LANES> keys_pointers;
+    std::array<const uint8_t*, AES_NI_LANES> message_keys;
+    for (size_t lane = 0; lane < AES_NI_LANES; ++lane) {
+        keys_pointers[lane] = &keys[lane];
+    }
+    for (size_t start = 0; start < messages.size(); start += AES_NI_LANES) {
+        const size_t num_lanes = std::min(AES_NI_LANES, messages.size() - start);
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            message_keys[lane] = messages[start + lane].key;
+        }
+        expand_decryption_keys(message_keys.data(), keys_pointers.data(), num_lanes);
+        for (size_t lane = 0; lane < num_lanes; ++lane) {
+            const cbc_message& message = messages[start + lane];
+            decrypt_cbc(message.buffer, message.iv, keys[lane], message.length);
+        }
+    }
+}
+
+} // namespace crypto::aes128::simd
+
+#else
+
+#include "barretenberg/common/throw_or_abort.hpp"
+
+namespace crypto::aes128::simd {
+
+bool aes_ni_supported()
+{
+    return false;
+}
+
+void encrypt_buffer_cbc_aes_ni(uint8_t*, uint8_t*, const uint8_t*, size_t)
+{
+    throw_or_abort("AES-NI is not available on this platform");
+}
+
+void decrypt_buffer_cbc_aes_ni(uint8_t*, uint8_t*, const uint8_t*, size_t)
+{
+    throw_or_abort("AES-NI is not available on this platform");
+}
+
+void decrypt_buffers_cbc_aes_ni(std::span<const cbc_message>)
+{
+    throw_or_abort("AES-NI is not available on this platform");
+}
+
+} // namespace crypto::aes128::simd
+
+#endif
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "./aes128.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/**
+ * AES-128 with the AES-NI instructions, used by aes128.cpp when the cpu supports them.
+ *
+ * Keys, IVs and buffers are as for the software functions in aes128.hpp, and the IV is updated in the same way.
+ * On anything but x86_64 aes_ni_supported() returns false and the other functions must not be called.
+ */
+namespace crypto::aes128::simd {
+
+/**
+ * @brief Whether the cpu implements the AES-NI instructions.
+ */
+bool aes_ni_supported();
+
+void encrypt_buffer_cbc_aes_ni(uint8_t* buffer, uint8_t* iv, const uint8_t* key, size_t length);
+
+/**
+ * @brief Decrypt one message. The blocks of a CBC message decrypt independently, so 8 are decrypted at a time.
+ */
+void decrypt_buffer_cbc_aes_ni(uint8_t* buffer, uint8_t* iv, const uint8_t* key, size_t length);
+
+constexpr size_t AES_NI_LANES = 8;
+
+/**
+ * @brief Decrypt many messages, AES_NI_LANES at a time.
+ *
+ * @details The key schedules of a group of messages are expanded together, so that each hides the latency of the
+ * others; for short messages they cost more than the decryption itself. The messages of a group are then decrypted
+ * one after another, and being independent, the cpu overlaps the decryption of one with the next.
+ */
+void decrypt_buffers_cbc_aes_ni(std::span<const cbc_message> messages);
+
+} // namespace crypto::aes128::simd
@@ -267,14 +267,18 @@ void blake3_hasher_finalize(const blake3_hasher* self, uint8_t* out)
     return;
 }
 
-std::vector<uint8_t> blake3s(std::vector<uint8_t> const& input)
+void blake3s(std::span<const uint8_t> input, std::span<uint8_t, BLAKE3_OUT_LEN> output)
 {
     blake3_hasher hasher;
     blake3_hasher_init(&hasher);
-    blake3_hasher_update(&hasher, (const uint8_t*)input.data(), input.size());
+    blake3_hasher_update(&hasher, input.data(), input.size());
+    blake3_hasher_finalize(&hasher, output.data());
+}
 
+std::vector<uint8_t> blake3s(std::vector<uint8_t> const& input)
+{
     std::vector<uint8_t> output(BLAKE3_OUT_LEN);
-    blake3_hasher_finalize(&hasher, &output[0]);
+    blake3s(input, std::span<uint8_t, BLAKE3_OUT_LEN>(output.data(), BLAKE3_OUT_LEN));
     return output;
 }
 
@@ -29,6 +29,7 @@
 */
 #pragma once
 #include <stddef.h>
+#include <span>
 #include <stdint.h>
 #include <vector>
 
@@ -92,5 +93,11 @@ void blake3_compress_in_place(uint32_t cv[8], const uint8_t block[BLAKE3_BLOCK_L
 void blake3_compress_xof(
     const uint32_t cv[8], const uint8_t block[BLAKE3_BLOCK_LEN], uint8_t block_len, uint8_t flags, uint8_t out[64]);
 
+/**
+ * Hash `input` into `output` without allocating. Subject to the single chunk limit above: inputs of more than
+ * BLAKE3_CHUNK_LEN bytes should use blake3_full::blake3s, which also hashes large inputs in parallel.
+ */
+void blake3s(std::span<const uint8_t> input, std::span<uint8_t, BLAKE3_OUT_LEN> output);
+
 std::vector<uint8_t> blake3s(std::vector<uint8_t> const& input);
 } // namespace blake3
@@ -3,6 +3,7 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <iostream>
 #include <memory>
 #include <vector>
@@ -396,3 +397,13 @@ TEST(misc_blake3s, test_vectors)
         EXPECT_EQ(blake3::blake3s(input), v.output);
     }
 }
+
+TEST(misc_blake3s, span_output_matches_vector_output)
+{
+    for (auto v : test_vectors) {
+        std::vector<uint8_t> input(v.input.begin(), v.input.end());
+        std::array<uint8_t, blake3::BLAKE3_OUT_LEN> output;
+        blake3::blake3s(input, output);
+        EXPECT_EQ(std::vector<uint8_t>(output.begin(), output.end()), v.output);
+    }
+}
@@ -1,5 +1,6 @@
 #include "blake3s.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <array>
 
 #define WASM_EXPORT __attribute__((visibility("default")))
 
@@ -7,8 +8,8 @@ extern "C" {
 
 WASM_EXPORT void blake3s_to_field(uint8_t const* data, size_t length, uint8_t* r)
 {
-    std::vector<uint8_t> inputv(data, data + length);
-    std::vector<uint8_t> output = blake3::blake3s(inputv);
+    std::array<uint8_t, blake3::BLAKE3_OUT_LEN> output;
+    blake3::blake3s(std::span<const uint8_t>(data, length), output);
     auto result = barretenberg::fr::serialize_from_buffer(output.data());
     barretenberg::fr::serialize_to_buffer(result, r);
 }
@@ -28,8 +28,6 @@
 
 #include "blake3s.hpp"
 
-namespace blake3_full {
-
 // This C implementation tries to support recent versions of GCC, Clang, and
 // MSVC.
 #if defined(_MSC_VER)
@@ -55,117 +53,24 @@ namespace blake3_full {
 #include <immintrin.h>
 #endif
 
-// #if defined(IS_X86)
-// #define MAX_SIMD_DEGREE 16
-// #elif defined(BLAKE3_USE_NEON)
-// #define MAX_SIMD_DEGREE 4
-// #else
-#define MAX_SIMD_DEGREE 1
-// #endif
+namespace blake3_full {
+
+// The widest blake3_hash_many implementation (16 lanes, with AVX-512F).
+#define MAX_SIMD_DEGREE 16
 
 // There are some places where we want a static size that's equal to the
 // MAX_SIMD_DEGREE, but also at least 2.
 #define MAX_SIMD_DEGREE_OR_2 (MAX_SIMD_DEGREE > 2 ? MAX_SIMD_DEGREE : 2)
 
-// The dynamically detected SIMD degree of the current platform.
-/*
- * Commenting out unnecessary parts as we currently don't need SIMD fo
- * different hardwares. To be revisited later.
- *
- */
-size_t blake3_simd_degree(void)
-{
-    return 1;
-    // #if defined(IS_X86)
-    //   const enum cpu_feature features = get_cpu_features();
-    //   MAYBE_UNUSED(features);
-    // #if !defined(BLAKE3_NO_AVX512)
-    //   if ((features & (AVX512F|AVX512VL)) == (AVX512F|AVX512VL)) {
-    //     return 16;
-    //   }
-    // #endif
-    // #if !defined(BLAKE3_NO_AVX2)
-    //   if (features & AVX2) {
-    //     return 8;
-    //   }
-    // #endif
-    // #if !defined(BLAKE3_NO_SSE41)
-    //   if (features & SSE41) {
-    //     return 4;
-    //   }
-    // #endif
-    // #if !defined(BLAKE3_NO_SSE2)
-    //   if (features & SSE2) {
-    //     return 4;
-    //   }
-    // #endif
-    // #endif
-    // #if defined(BLAKE3_USE_NEON)
-    //   return 4;
-    // #endif
-    //   return 1;
-}
-
-/*----------------------------------------------------------------
- *
- * Commenting out as we currently don't need SIMD for different hardwares.
- * To be revisited later.
- *
-
-enum cpu_feature get_cpu_features() {
-  if (g_cpu_features != UNDEFINED) {
-    return g_cpu_features;
-  } else {
-#if defined(IS_X86)
-    uint32_t regs[4] = {0};
-    uint32_t *eax = &regs[0], *ebx = &regs[1], *ecx = &regs[2], *edx = &regs[3];
-    (void)edx;
-    enum cpu_feature features = 0;
-    cpuid(regs, 0);
-    const int max_id = *eax;
-    cpuid(regs, 1);
-#if defined(__amd64__) || defined(_M_X64)
-    features |= SSE2;
-#else
-    if (*edx & (1UL << 26))
-      features |= SSE2;
-#endif
-    if (*ecx & (1UL << 0))
-      features |= SSSE3;
-    if (*ecx & (1UL << 19))
-      features |= SSE41;
-
-    if (*ecx & (1UL << 27)) { // OSXSAVE
-      const uint64_t mask = xgetbv();
-      if ((mask & 6) == 6) { // SSE and AVX states
-        if (*ecx & (1UL << 28))
-          features |= AVX;
-        if (max_id >= 7) {
-          cpuidex(regs, 7, 0);
-          if (*ebx & (1UL << 5))
-            features |= AVX2;
-          if ((mask & 224) == 224) { // Opmask, ZMM_Hi256, Hi16_Zmm
-            if (*ebx & (1UL << 31))
-              features |= AVX512VL;
-            if (*ebx & (1UL << 16))
-              features |= AVX512F;
-          }
-        }
-      }
-    }
-    g_cpu_features = features;
-    return features;
-#else
-    // How to detect NEON?
-    return 0;
-#endif
-  }
-}
-----------------------------------------------------------------*/
+// The dynamically detected SIMD degree of the current platform: the number of
+// chunks (or parents) blake3_hash_many compresses at once. 16 with AVX-512F, 8
+// with AVX2 and 4 otherwise (SSE2 on x86_64, plain scalar code elsewhere).
+// Implemented in blake3s_simd.cpp.
+size_t blake3_simd_degree(void);
 
 /* Find index of the highest set bit */
 /* x is assumed to be nonzero.       */
-static unsigned int highest_one(uint64_t x)
+INLINE unsigned int highest_one(uint64_t x)
 {
 #if defined(__GNUC__) || defined(__clang__)
     return uint32_t(63) ^ uint32_t(__builtin_clzll(x));
@@ -0,0 +1,50 @@
+#include "blake3s.hpp"
+#include <array>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace benchmark;
+
+namespace {
+std::vector<uint8_t> make_input(size_t length)
+{
+    std::vector<uint8_t> input(length);
+    for (size_t i = 0; i < length; ++i) {
+        input[i] = static_cast<uint8_t>(i % 251);
+    }
+    return input;
+}
+} // namespace
+
+// The whole input in one call: chunks are compressed blake3_simd_degree() at a time, large subtrees on many threads.
+void blake3s_one_shot(State& state) noexcept
+{
+    const std::vector<uint8_t> input = make_input(static_cast<size_t>(state.range(0)));
+    std::array<uint8_t, blake3_full::BLAKE3_OUT_LEN> output;
+    for (auto _ : state) {
+        blake3_full::blake3s(input, output);
+        DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(blake3s_one_shot)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+
+// One chunk per update, which forces the hasher to compress a single chunk at a time on one thread.
+void blake3s_chunk_at_a_time(State& state) noexcept
+{
+    const std::vector<uint8_t> input = make_input(static_cast<size_t>(state.range(0)));
+    std::array<uint8_t, blake3_full::BLAKE3_OUT_LEN> output;
+    for (auto _ : state) {
+        blake3_full::blake3_hasher hasher;
+        blake3_full::blake3_hasher_init(&hasher);
+        for (size_t offset = 0; offset < input.size(); offset += blake3_full::BLAKE3_CHUNK_LEN) {
+            blake3_full::blake3_hasher_update(&hasher, &input[offset], blake3_full::BLAKE3_CHUNK_LEN);
+        }
+        blake3_full::blake3_hasher_finalize(&hasher, output.data(), output.size());
+        DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(blake3s_chunk_at_a_time)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+
+BENCHMARK_MAIN();
@@ -23,6 +23,7 @@
 #include <iostream>
 
 #include "blake3-impl.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 
 namespace blake3_full {
 
@@ -305,6 +306,10 @@ INLINE size_t compress_parents_parallel(const uint8_t* child_chaining_values,
     }
 }
 
+// Subtrees at least this long are split between threads. Below that, the
+// task overhead outweighs hashing the subtree on one thread.
+constexpr size_t BLAKE3_PARALLEL_MIN_LEN = 128 * BLAKE3_CHUNK_LEN;
+
 // The wide helper function returns (writes out) an array of chaining values
 // and returns the length of that array. The number of chaining values returned
 // is the dyanmically detected SIMD degree, at most MAX_SIMD_DEGREE. Or fewer,
@@ -356,11 +361,23 @@ static size_t blake3_compress_subtree_wide(
     }
     uint8_t* right_cvs = &cv_array[degree * BLAKE3_OUT_LEN];
 
-    // Recurse! If this implementation adds multi-threading support in the
-    // future, this is where it will go.
-    size_t left_n = blake3_compress_subtree_wide(input, left_input_len, key, chunk_counter, flags, cv_array);
-    size_t right_n =
-        blake3_compress_subtree_wide(right_input, right_input_len, key, right_chunk_counter, flags, right_cvs);
+    // Recurse! Large subtrees hash their left half on another thread of the
+    // shared pool while this thread hashes the right half.
+    size_t left_n = 0;
+    size_t right_n = 0;
+    if (input_len >= BLAKE3_PARALLEL_MIN_LEN) {
+        barretenberg::ThreadPool::TaskGroup group;
+        group.run([&]() {
+            left_n = blake3_compress_subtree_wide(input, left_input_len, key, chunk_counter, flags, cv_array);
+        });
+        right_n =
+            blake3_compress_subtree_wide(right_input, right_input_len, key, right_chunk_counter, flags, right_cvs);
+        group.wait();
+    } else {
+        left_n = blake3_compress_subtree_wide(input, left_input_len, key, chunk_counter, flags, cv_array);
+        right_n =
+            blake3_compress_subtree_wide(right_input, right_input_len, key, right_chunk_counter, flags, right_cvs);
+    }
 
     // The special case again. If simd_degree=1, then we'll have left_n=1 and
     // right_n=1. Rather than compressing them into a single output, return
@@ -829,37 +846,13 @@ void blake3s_hash_one(const uint8_t* input,
     store_cv_words(out, cv);
 }
 
-void blake3_hash_many(const uint8_t* const* inputs,
-                      size_t num_inputs,
-                      size_t blocks,
-                      const uint32_t key[8],
-                      uint64_t counter,
-                      bool increment_counter,
-                      uint8_t flags,
-                      uint8_t flags_start,
-                      uint8_t flags_end,
-                      uint8_t* out)
+void blake3s(std::span<const uint8_t> input,
+             std::span<uint8_t, BLAKE3_OUT_LEN> output,
+             const mode mode_id,
+             const uint8_t key[BLAKE3_KEY_LEN],
+             const char* context)
 {
-    while (num_inputs > 0) {
-        blake3s_hash_one(inputs[0], blocks, key, counter, flags, flags_start, flags_end, out);
-        if (increment_counter) {
-            counter += 1;
-        }
-        inputs += 1;
-        num_inputs -= 1;
-        out = &out[BLAKE3_OUT_LEN];
-    }
-}
-
-std::vector<uint8_t> blake3s(std::vector<uint8_t> const& input,
-                             const mode mode_id,
-                             const uint8_t key[BLAKE3_KEY_LEN],
-                             const char* context)
-{
-    // Initialize the hasher.
     blake3_hasher hasher;
-    blake3_hasher_init(&hasher);
-
     switch (mode_id) {
     case HASH_MODE:
         blake3_hasher_init(&hasher);
@@ -874,10 +867,17 @@ std::vector<uint8_t> blake3s(std::vector<uint8_t> const& input,
         abort();
     }
 
-    blake3_hasher_update(&hasher, (const uint8_t*)input.data(), input.size());
+    blake3_hasher_update(&hasher, input.data(), input.size());
+    blake3_hasher_finalize(&hasher, output.data(), BLAKE3_OUT_LEN);
+}
 
+std::vector<uint8_t> blake3s(std::vector<uint8_t> const& input,
+                             const mode mode_id,
+                             const uint8_t key[BLAKE3_KEY_LEN],
+                             const char* context)
+{
     std::vector<uint8_t> output(BLAKE3_OUT_LEN);
-    blake3_hasher_finalize(&hasher, &output[0], BLAKE3_OUT_LEN);
+    blake3s(input, std::span<uint8_t, BLAKE3_OUT_LEN>(output.data(), BLAKE3_OUT_LEN), mode_id, key, context);
     return output;
 }
 
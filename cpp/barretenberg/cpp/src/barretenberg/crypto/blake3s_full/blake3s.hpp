@@ -18,6 +18,7 @@
 */
 
 #include <stddef.h>
+#include <span>
 #include <stdint.h>
 #include <vector>
 
@@ -112,15 +113,19 @@ void blake3_compress_xof(const uint32_t cv[8],
                          uint8_t flags,
                          uint8_t out[64]);
 
-void blak3s_hash_one(const uint8_t* input,
-                     size_t blocks,
-                     const uint32_t key[8],
-                     uint64_t counter,
-                     uint8_t flags,
-                     uint8_t flags_start,
-                     uint8_t flags_end,
-                     uint8_t out[BLAKE3_OUT_LEN]);
+void blake3s_hash_one(const uint8_t* input,
+                      size_t blocks,
+                      const uint32_t key[8],
+                      uint64_t counter,
+                      uint8_t flags,
+                      uint8_t flags_start,
+                      uint8_t flags_end,
+                      uint8_t out[BLAKE3_OUT_LEN]);
 
+/**
+ * Compress `num_inputs` inputs of `blocks` blocks each into their chaining values, blake3_simd_degree() inputs at a
+ * time. Used for both the chunks and the parent nodes of the hash tree.
+ */
 void blake3_hash_many(const uint8_t* const* inputs,
                       size_t num_inputs,
                       size_t blocks,
@@ -132,6 +137,16 @@ void blake3_hash_many(const uint8_t* const* inputs,
                       uint8_t flags_end,
                       uint8_t* out);
 
+/**
+ * Hash `input` into `output` without allocating. Inputs of many chunks are hashed as a tree: several chunks at a time
+ * with SIMD, and large subtrees on several threads.
+ */
+void blake3s(std::span<const uint8_t> input,
+             std::span<uint8_t, BLAKE3_OUT_LEN> output,
+             const mode mode_id = HASH_MODE,
+             const uint8_t key[BLAKE3_KEY_LEN] = nullptr,
+             const char* context = nullptr);
+
 std::vector<uint8_t> blake3s(std::vector<uint8_t> const& input,
                              const mode mode_id = HASH_MODE,
                              const uint8_t key[BLAKE3_KEY_LEN] = nullptr,
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <iostream>
 #include <memory>
 #include <vector>
@@ -894,3 +895,59 @@ TEST(misc_blake3s_full, test_full_vectors)
         EXPECT_EQ(blake3_full::blake3s(input, blake3_full::DERIVE_KEY_MODE, nullptr, context), v.derive_key);
     }
 }
+
+TEST(misc_blake3s_full, hash_many_matches_hash_one)
+{
+    constexpr size_t blocks = blake3_full::BLAKE3_CHUNK_LEN / blake3_full::BLAKE3_BLOCK_LEN;
+    std::vector<uint8_t> input = test_input(35 * blake3_full::BLAKE3_CHUNK_LEN);
+    // Every partial group size, so that each lane width and the scalar tail are used.
+    for (size_t num_inputs = 1; num_inputs <= 35; ++num_inputs) {
+        std::vector<const uint8_t*> inputs;
+        for (size_t i = 0; i < num_inputs; ++i) {
+            inputs.push_back(&input[i * blake3_full::BLAKE3_CHUNK_LEN]);
+        }
+        std::vector<uint8_t> expected(num_inputs * blake3_full::BLAKE3_OUT_LEN);
+        for (size_t i = 0; i < num_inputs; ++i) {
+            blake3_full::blake3s_hash_one(inputs[i],
+                                          blocks,
+                                          blake3_full::IV,
+                                          7 + i,
+                                          0,
+                                          blake3_full::CHUNK_START,
+                                          blake3_full::CHUNK_END,
+                                          &expected[i * blake3_full::BLAKE3_OUT_LEN]);
+        }
+        std::vector<uint8_t> result(num_inputs * blake3_full::BLAKE3_OUT_LEN);
+        blake3_full::blake3_hash_many(inputs.data(),
+                                      num_inputs,
+                                      blocks,
+                                      blake3_full::IV,
+                                      7,
+                                      true,
+                                      0,
+                                      blake3_full::CHUNK_START,
+                                      blake3_full::CHUNK_END,
+                                      result.data());
+        EXPECT_EQ(result, expected);
+    }
+}
+
+TEST(misc_blake3s_full, large_input_matches_incremental_updates)
+{
+    // Large enough to be split between threads. Feeding it less than a chunk at a time instead takes the serial
+    // one-chunk-at-a-time path through the hasher.
+    std::vector<uint8_t> input = test_input((3 << 20) + 123);
+
+    std::array<uint8_t, blake3_full::BLAKE3_OUT_LEN> one_shot;
+    blake3_full::blake3s(input, one_shot);
+
+    blake3_full::blake3_hasher hasher;
+    blake3_full::blake3_hasher_init(&hasher);
+    for (size_t offset = 0; offset < input.size(); offset += 1000) {
+        blake3_full::blake3_hasher_update(&hasher, &input[offset], std::min<size_t>(1000, input.size() - offset));
+    }
+    std::array<uint8_t, blake3_full::BLAKE3_OUT_LEN> incremental;
+    blake3_full::blake3_hasher_finalize(&hasher, incremental.data(), incremental.size());
+
+    EXPECT_EQ(one_shot, incremental);
+}
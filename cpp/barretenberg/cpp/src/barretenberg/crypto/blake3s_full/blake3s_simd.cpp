@@ -0,0 +1,269 @@
+/**
+ * blake3_hash_many: compress several equal-length inputs (whole chunks, or parent nodes) at once.
+ *
+ * The inputs are transposed so that vector lane i holds the state of input i, and every step of the compression
+ * function runs on all lanes together using GCC vector extensions. The same source is compiled for 16 lanes with
+ * AVX-512F, 8 lanes with AVX2 and a 4 lane baseline that is SSE2 on x86_64 and scalar code elsewhere.
+ */
+#include "blake3-impl.hpp"
+
+namespace blake3_full {
+
+namespace {
+
+typedef uint32_t words4 __attribute__((vector_size(16)));
+typedef uint32_t words8 __attribute__((vector_size(32)));
+typedef uint32_t words16 __attribute__((vector_size(64)));
+
+// Vectors are passed by reference: passing them by value would depend on the ISA the caller was compiled for.
+template <typename V> __attribute__((always_inline)) inline void rotr_lanes(V& x, const unsigned c)
+{
+    x = (x >> c) | (x << (32 - c));
+}
+
+template <typename V>
+__attribute__((always_inline)) inline void g_lanes(
+    V* state, size_t a, size_t b, size_t c, size_t d, const V& x, const V& y)
+{
+    state[a] = state[a] + state[b] + x;
+    state[d] ^= state[a];
+    rotr_lanes(state[d], 16);
+    state[c] = state[c] + state[d];
+    state[b] ^= state[c];
+    rotr_lanes(state[b], 12);
+    state[a] = state[a] + state[b] + y;
+    state[d] ^= state[a];
+    rotr_lanes(state[d], 8);
+    state[c] = state[c] + state[d];
+    state[b] ^= state[c];
+    rotr_lanes(state[b], 7);
+}
+
+/**
+ * Hash exactly `W` inputs of `blocks` blocks each, writing W chaining values to `out`. Lane i uses counters[i].
+ */
+template <size_t W, typename V>
+__attribute__((always_inline)) inline void hash_lanes(const uint8_t* const* inputs,
+                                                      const size_t blocks,
+                                                      const uint32_t key[8],
+                                                      const uint64_t* counters,
+                                                      const uint8_t flags,
+                                                      const uint8_t flags_start,
+                                                      const uint8_t flags_end,
+                                                      uint8_t* out)
+{
+    V cv[8];
+    for (size_t i = 0; i < 8; ++i) {
+        cv[i] = V{} + key[i];
+    }
+    V counter_lo{};
+    V counter_hi{};
+    for (size_t lane = 0; lane < W; ++lane) {
+        counter_lo[lane] = counter_low(counters[lane]);
+        counter_hi[lane] = counter_high(counters[lane]);
+    }
+
+    for (size_t block = 0; block < blocks; ++block) {
+        uint8_t block_flags = flags;
+        if (block == 0) {
+            block_flags |= flags_start;
+        }
+        if (block + 1 == blocks) {
+            block_flags |= flags_end;
+        }
+
+        V msg[16] = {};
+        for (size_t lane = 0; lane < W; ++lane) {
+            const uint8_t* data = inputs[lane] + block * BLAKE3_BLOCK_LEN;
+            for (size_t i = 0; i < 16; ++i) {
+                msg[i][lane] = load32(data + 4 * i);
+            }
+        }
+
+        V state[16] = { cv[0],
+                        cv[1],
+                        cv[2],
+                        cv[3],
+                        cv[4],
+                        cv[5],
+                        cv[6],
+                        cv[7],
+                        V{} + IV[0],
+                        V{} + IV[1],
+                        V{} + IV[2],
+                        V{} + IV[3],
+                        counter_lo,
+                        counter_hi,
+                        V{} + static_cast<uint32_t>(BLAKE3_BLOCK_LEN),
+                        V{} + static_cast<uint32_t>(block_flags) };
+
+        // Fully unrolled, so that the message schedule below indexes `msg` with compile time constants.
+#pragma GCC unroll 7
+        for (size_t round = 0; round < 7; ++round) {
+            const uint8_t* schedule = MSG_SCHEDULE[round];
+            g_lanes(state, 0, 4, 8, 12, msg[schedule[0]], msg[schedule[1]]);
+            g_lanes(state, 1, 5, 9, 13, msg[schedule[2]], msg[schedule[3]]);
+            g_lanes(state, 2, 6, 10, 14, msg[schedule[4]], msg[schedule[5]]);
+            g_lanes(state, 3, 7, 11, 15, msg[schedule[6]], msg[schedule[7]]);
+            g_lanes(state, 0, 5, 10, 15, msg[schedule[8]], msg[schedule[9]]);
+            g_lanes(state, 1, 6, 11, 12, msg[schedule[10]], msg[schedule[11]]);
+            g_lanes(state, 2, 7, 8, 13, msg[schedule[12]], msg[schedule[13]]);
+            g_lanes(state, 3, 4, 9, 14, msg[schedule[14]], msg[schedule[15]]);
+        }
+        for (size_t i = 0; i < 8; ++i) {
+            cv[i] = state[i] ^ state[i + 8];
+        }
+    }
+
+    for (size_t lane = 0; lane < W; ++lane) {
+        for (size_t i = 0; i < 8; ++i) {
+            store32(&out[lane * BLAKE3_OUT_LEN + 4 * i], cv[i][lane]);
+        }
+    }
+}
+
+void hash_x4(const uint8_t* const* inputs,
+             size_t blocks,
+             const uint32_t key[8],
+             const uint64_t* counters,
+             uint8_t flags,
+             uint8_t flags_start,
+             uint8_t flags_end,
+             uint8_t* out)
+{
+    hash_lanes<4, words4>(inputs, blocks, key, counters, flags, flags_start, flags_end, out);
+}
+
+#if defined(__x86_64__) && !defined(__wasm__)
+__attribute__((target("avx2"))) void hash_x8(const uint8_t* const* inputs,
+                                             size_t blocks,
+                                             const uint32_t key[8],
+                                             const uint64_t* counters,
+                                             uint8_t flags,
+                                             uint8_t flags_start,
+                                             uint8_t flags_end,
+                                             uint8_t* out)
+{
+    hash_lanes<8, words8>(inputs, blocks, key, counters, flags, flags_start, flags_end, out);
+}
+
+__attribute__((target("avx512f"))) void hash_x16(const uint8_t* const* inputs,
+                                                 size_t blocks,
+                                                 const uint32_t key[8],
+                                                 const uint64_t* counters,
+                                                 uint8_t flags,
+                                                 uint8_t flags_start,
+                                                 uint8_t flags_end,
+                                                 uint8_t* out)
+{
+    hash_lanes<16, words16>(inputs, blocks, key, counters, flags, flags_start, flags_end, out);
+}
+
+bool has_avx2()
+{
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+bool has_avx512()
+{
+    static const bool supported = __builtin_cpu_supports("avx512f");
+    return supported;
+}
+#else
+void hash_x8(const uint8_t* const* inputs,
+             size_t blocks,
+             const uint32_t key[8],
+             const uint64_t* counters,
+             uint8_t flags,
+             uint8_t flags_start,
+             uint8_t flags_end,
+             uint8_t* out)
+{
+    hash_lanes<8, words8>(inputs, blocks, key, counters, flags, flags_start, flags_end, out);
+}
+
+void hash_x16(const uint8_t* const* inputs,
+              size_t blocks,
+              const uint32_t key[8],
+              const uint64_t* counters,
+              uint8_t flags,
+              uint8_t flags_start,
+              uint8_t flags_end,
+              uint8_t* out)
+{
+    hash_lanes<16, words16>(inputs, blocks, key, counters, flags, flags_start, flags_end, out);
+}
+
+bool has_avx2()
+{
+    return false;
+}
+
+bool has_avx512()
+{
+    return false;
+}
+#endif
+
+} // namespace
+
+size_t blake3_simd_degree(void)
+{
+    if (has_avx512()) {
+        return 16;
+    }
+    if (has_avx2()) {
+        return 8;
+    }
+    return 4;
+}
+
+void blake3_hash_many(const uint8_t* const* inputs,
+                      size_t num_inputs,
+                      size_t blocks,
+                      const uint32_t key[8],
+                      uint64_t counter,
+                      bool increment_counter,
+                      uint8_t flags,
+                      uint8_t flags_start,
+                      uint8_t flags_end,
+                      uint8_t* out)
+{
+    const size_t degree = blake3_simd_degree();
+    uint64_t counters[MAX_SIMD_DEGREE];
+    while (num_inputs > 0) {
+        // Use the widest kernel that the remaining inputs fill; fewer than 4 inputs are hashed one at a time.
+        size_t width = degree;
+        while (width > num_inputs && width > 4) {
+            width /= 2;
+        }
+        if (width > num_inputs) {
+            blake3s_hash_one(inputs[0], blocks, key, counter, flags, flags_start, flags_end, out);
+            width = 1;
+        } else {
+            for (size_t lane = 0; lane < width; ++lane) {
+                counters[lane] = increment_counter ? counter + lane : counter;
+            }
+            switch (width) {
+            case 16:
+                hash_x16(inputs, blocks, key, counters, flags, flags_start, flags_end, out);
+                break;
+            case 8:
+                hash_x8(inputs, blocks, key, counters, flags, flags_start, flags_end, out);
+                break;
+            default:
+                hash_x4(inputs, blocks, key, counters, flags, flags_start, flags_end, out);
+                break;
+            }
+        }
+        if (increment_counter) {
+            counter += width;
+        }
+        inputs += width;
+        num_inputs -= width;
+        out = &out[width * BLAKE3_OUT_LEN];
+    }
+}
+
+} // namespace blake3_full
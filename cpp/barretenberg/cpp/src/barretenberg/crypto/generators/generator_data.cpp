@@ -1,4 +1,7 @@
 #include "./generator_data.hpp"
+#include "./points_file.hpp"
+
+#include <mutex>
 
 namespace crypto {
 namespace generators {
@@ -21,9 +24,8 @@ constexpr size_t hash_indices_generator_offset = 2048;
 constexpr size_t num_indexed_generators = num_hash_indices * num_generators_per_hash_index;
 constexpr size_t size_of_generator_data_array = hash_indices_generator_offset + num_indexed_generators;
 constexpr size_t num_generator_types = 3;
+constexpr size_t num_generator_points = size_of_generator_data_array * num_generator_types;
 
-ladder_t g1_ladder;
-bool inited = false;
 
 void compute_fixed_base_ladder(const grumpkin::g1::affine_element& generator, ladder_t& ladder)
 {
@@ -83,6 +85,7 @@ void compute_fixed_base_ladder(const grumpkin::g1::affine_element& generator, la
     }
     free(ladder_temp);
 }
+} // namespace
 
 /**
  * We need to derive three kinds of generators:
@@ -91,21 +94,60 @@ void compute_fixed_base_ladder(const grumpkin::g1::affine_element& generator, la
  *    3. skew_generators (P_skew[])
  * We use three generators to hash a single field element in the hash_single method:
  * H(f) = lambda * P[i]  +  gamma * P_aux[i]  -  skew * P_skew[i]
+ *
+ * The points are stored as derived: generator i is followed by aux generator i and skew generator i.
  */
-template <size_t N> inline auto derive_generators()
+std::vector<grumpkin::g1::affine_element> derive_generator_points()
 {
-    ASSERT((N % num_generator_types) == 0);
-    std::vector<grumpkin::g1::affine_element> generators;
-    std::vector<grumpkin::g1::affine_element> aux_generators;
-    std::vector<grumpkin::g1::affine_element> skew_generators;
-    auto res = grumpkin::g1::derive_generators<N>();
-    for (size_t i = 0; i < N; i += num_generator_types) {
-        generators.push_back(res[i]);
-        aux_generators.push_back(res[i + 1]);
-        skew_generators.push_back(res[i + 2]);
+    // As grumpkin::g1::derive_generators<num_generator_points>(), without the 1.2MB array on the stack of whichever
+    // thread uses a generator first.
+    std::vector<grumpkin::g1::affine_element> points;
+    points.reserve(num_generator_points);
+    size_t seed = 0;
+    while (points.size() < num_generator_points) {
+        ++seed;
+        auto candidate = grumpkin::g1::affine_element::hash_to_curve(seed);
+        if (candidate.on_curve() && !candidate.is_point_at_infinity()) {
+            points.push_back(candidate);
+        }
     }
+    return points;
+}
 
-    return std::make_tuple(generators, aux_generators, skew_generators);
+namespace {
+/**
+ * The generator points, with the generator data of each generator and the ladder of the group generator.
+ *
+ * Each of them is computed on first use, once, whichever thread gets there first. Deriving the points is most of the
+ * cost of starting up, so they are read from BB_PRECOMPUTED_DIR when it holds them (see read_precomputed_points), or
+ * from the file given to load_generator_points before first use. The ladders of a generator are only
+ * computed when the generator is used, rather than those of all 6144 generators at once.
+ */
+struct generator_tables {
+    std::once_flag points_flag;
+    std::vector<grumpkin::g1::affine_element> points;
+    std::array<std::once_flag, size_of_generator_data_array> data_flags;
+    std::vector<std::unique_ptr<generator_data>> data = std::vector<std::unique_ptr<generator_data>>(
+        size_of_generator_data_array);
+    std::once_flag g1_ladder_flag;
+    ladder_t g1_ladder;
+};
+
+generator_tables& get_generator_tables()
+{
+    static generator_tables tables;
+    return tables;
+}
+
+std::vector<grumpkin::g1::affine_element> const& get_generator_points()
+{
+    auto& tables = get_generator_tables();
+    std::call_once(tables.points_flag, [&tables]() {
+        auto points = read_precomputed_points(
+            GENERATOR_POINTS_FILE_NAME, GENERATOR_POINTS_FILE_TAG, num_generator_points, GENERATOR_POINTS_CHECKSUM);
+        tables.points = points.has_value() ? std::move(*points) : derive_generator_points();
+    });
+    return tables.points;
 }
 
 auto compute_generator_data(grumpkin::g1::affine_element const& generator,
@@ -151,6 +193,18 @@ const fixed_base_ladder* get_ladder_internal(std::array<fixed_base_ladder, quad_
     return result;
 }
 
+generator_data const& get_generator_data_internal(const size_t i)
+{
+    auto& tables = get_generator_tables();
+    std::call_once(tables.data_flags[i], [&tables, i]() {
+        const auto& points = get_generator_points();
+        tables.data[i] = compute_generator_data(points[i * num_generator_types],
+                                                points[i * num_generator_types + 1],
+                                                points[i * num_generator_types + 2]);
+    });
+    return *tables.data[i];
+}
+
 } // namespace
 
 /**
@@ -204,36 +258,42 @@ const fixed_base_ladder* get_ladder_internal(std::array<fixed_base_ladder, quad_
  **/
 std::vector<std::unique_ptr<generator_data>> const& init_generator_data()
 {
-    static std::vector<std::unique_ptr<generator_data>> global_generator_data;
-    if (inited && (global_generator_data.size() == size_of_generator_data_array)) {
-        return global_generator_data;
-    }
-    std::vector<grumpkin::g1::affine_element> generators;
-    std::vector<grumpkin::g1::affine_element> aux_generators;
-    std::vector<grumpkin::g1::affine_element> skew_generators;
-    std::tie(generators, aux_generators, skew_generators) =
-        derive_generators<size_of_generator_data_array * num_generator_types>();
-
-    global_generator_data.resize(size_of_generator_data_array);
-
     for (size_t i = 0; i < num_default_generators; i++) {
-        global_generator_data[i] = compute_generator_data(generators[i], aux_generators[i], skew_generators[i]);
+        get_generator_data_internal(i);
     }
-
     for (size_t i = hash_indices_generator_offset; i < size_of_generator_data_array; i++) {
-        global_generator_data[i] = compute_generator_data(generators[i], aux_generators[i], skew_generators[i]);
+        get_generator_data_internal(i);
     }
+    get_g1_ladder(0);
+    return get_generator_tables().data;
+};
 
-    compute_fixed_base_ladder(grumpkin::g1::one, g1_ladder);
+bool load_generator_points(std::string const& path)
+{
+    auto points = read_points_file(path, GENERATOR_POINTS_FILE_TAG, num_generator_points, GENERATOR_POINTS_CHECKSUM);
+    if (!points.has_value()) {
+        return false;
+    }
+    bool loaded = false;
+    auto& tables = get_generator_tables();
+    std::call_once(tables.points_flag, [&]() {
+        tables.points = std::move(*points);
+        loaded = true;
+    });
+    return loaded;
+}
 
-    inited = true;
-    return global_generator_data;
-};
+void write_generator_points(std::string const& path)
+{
+    write_points_file(path, GENERATOR_POINTS_FILE_TAG, get_generator_points());
+}
 
 const fixed_base_ladder* get_g1_ladder(const size_t num_bits)
 {
-    init_generator_data();
-    return get_ladder_internal(g1_ladder, num_bits);
+    auto& tables = get_generator_tables();
+    std::call_once(tables.g1_ladder_flag,
+                   [&tables]() { compute_fixed_base_ladder(grumpkin::g1::one, tables.g1_ladder); });
+    return get_ladder_internal(tables.g1_ladder, num_bits);
 }
 
 /**
@@ -262,26 +322,23 @@ const fixed_base_ladder* get_g1_ladder(const size_t num_bits)
  */
 generator_data const& get_generator_data(generator_index_t index)
 {
-    auto& global_generator_data = init_generator_data();
     if (index.index == 0) {
         ASSERT(index.sub_index < num_default_generators);
-        return *global_generator_data[index.sub_index];
+        return get_generator_data_internal(index.sub_index);
     }
     ASSERT(index.index <= num_hash_indices);
     ASSERT(index.sub_index < num_generators_per_hash_index);
-    return *global_generator_data[hash_indices_generator_offset + ((index.index - 1) * num_generators_per_hash_index) +
-                                  index.sub_index];
+    return get_generator_data_internal(hash_indices_generator_offset +
+                                       ((index.index - 1) * num_generators_per_hash_index) + index.sub_index);
 }
 
 const fixed_base_ladder* generator_data::get_ladder(size_t num_bits) const
 {
-    init_generator_data();
     return get_ladder_internal(ladder, num_bits);
 }
 
 const fixed_base_ladder* generator_data::get_hash_ladder(size_t num_bits) const
 {
-    init_generator_data();
     return get_ladder_internal(hash_ladder, num_bits);
 }
 
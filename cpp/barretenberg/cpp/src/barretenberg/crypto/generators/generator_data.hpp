@@ -1,7 +1,11 @@
 #pragma once
 #include <array>
+#include <memory>
+#include <string>
 #include <tuple>
+#include <vector>
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "./points_file.hpp"
 
 namespace crypto {
 namespace generators {
@@ -54,7 +58,31 @@ struct generator_data {
     const fixed_base_ladder* get_hash_ladder(size_t num_bits) const;
 };
 
+// Tags the points file of the generator points (see points_file.hpp).
+constexpr uint64_t GENERATOR_POINTS_FILE_TAG = 0x47454e4552415452; // "GENERATR"
+// The checksum of derive_generator_points() as a little-endian native build lays them out. Generator points files
+// holding any other points are ignored. It must be updated if the derivation or the number of generators changes.
+constexpr points_checksum GENERATOR_POINTS_CHECKSUM = {
+    0x878639e471aa5a3b, 0xb998890ae836d556, 0x79c055bfae5a3efc, 0x9fe2c060788a89c6
+};
+
 std::vector<std::unique_ptr<generator_data>> const& init_generator_data();
+
+/**
+ * Derive all the generator points (generator, aux generator and skew generator of each generator index, in that order)
+ * from their seeds. This is what a process does on first use of a generator when it does not load the points.
+ */
+std::vector<grumpkin::g1::affine_element> derive_generator_points();
+
+/**
+ * Use the generator points in the file at `path`, written by write_generator_points, instead of deriving them when a
+ * generator is first used. Without a call to this, first use reads generator_points.dat from BB_PRECOMPUTED_DIR if it
+ * is set. Returns false, leaving the points to be derived, if the file cannot be read or does not
+ * hold the derived points (see GENERATOR_POINTS_CHECKSUM), or if the points are already in use.
+ */
+bool load_generator_points(std::string const& path);
+void write_generator_points(std::string const& path);
+
 const fixed_base_ladder* get_g1_ladder(const size_t num_bits);
 generator_data const& get_generator_data(generator_index_t index);
 
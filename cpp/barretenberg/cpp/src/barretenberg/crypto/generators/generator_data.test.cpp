@@ -2,6 +2,10 @@
 #include "barretenberg/common/streams.hpp"
 #include "./fixed_base_scalar_mul.hpp"
 #include "./generator_data.hpp"
+#include "./points_file.hpp"
+#include <filesystem>
+#include <fstream>
+#include <thread>
 
 using namespace crypto::generators;
 
@@ -85,3 +89,137 @@ TEST(generators, fixed_base_scalar_mul)
         EXPECT_EQ(result.y, pub_key.y);
     }
 }
+
+TEST(generators, concurrent_first_use)
+{
+    // Generator 17 of hash index 3 is not used by any other test: the threads race to compute its ladders.
+    const generator_index_t index = { 3, 17 };
+    std::vector<const generator_data*> results(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&results, i, index]() { results[i] = &get_generator_data(index); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto* result : results) {
+        EXPECT_EQ(result, results[0]);
+    }
+    EXPECT_EQ(grumpkin::g1::element(results[0]->ladder[quad_length - 1].one),
+              grumpkin::g1::element(results[0]->generator));
+}
+
+TEST(generators, points_file)
+{
+    const std::string path = std::filesystem::temp_directory_path() / "generators_points_file_test.dat";
+    std::vector<grumpkin::g1::affine_element> points;
+    for (size_t i = 0; i < 8; ++i) {
+        points.push_back(get_generator_data({ 0, i }).generator);
+    }
+    const points_checksum checksum = compute_points_checksum(points);
+    write_points_file(path, 42, points);
+
+    EXPECT_EQ(read_points_file(path, 42, points.size(), checksum), points);
+    EXPECT_EQ(read_points_file(path, 43, points.size(), checksum), std::nullopt);
+    EXPECT_EQ(read_points_file(path, 42, points.size() - 1, checksum), std::nullopt);
+    EXPECT_EQ(read_points_file(path + ".missing", 42, points.size(), checksum), std::nullopt);
+
+    // A well-formed file of other points, whose header checksum matches its own points, is not the expected file.
+    {
+        std::vector<grumpkin::g1::affine_element> other_points(points.rbegin(), points.rend());
+        write_points_file(path, 42, other_points);
+        EXPECT_EQ(read_points_file(path, 42, points.size(), compute_points_checksum(other_points)), other_points);
+        EXPECT_EQ(read_points_file(path, 42, points.size(), checksum), std::nullopt);
+        write_points_file(path, 42, points);
+    }
+
+    // Flip a bit of the last point.
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(-1, std::ios::end);
+        const char last = static_cast<char>(file.get());
+        file.seekp(-1, std::ios::end);
+        file.put(static_cast<char>(last ^ 1));
+    }
+    EXPECT_EQ(read_points_file(path, 42, points.size(), checksum), std::nullopt);
+    std::filesystem::remove(path);
+}
+
+TEST(generators, load_generator_points)
+{
+    const std::string path = std::filesystem::temp_directory_path() / "generators_generator_points_test.dat";
+    write_generator_points(path);
+
+    // The points are in use, so they cannot be replaced.
+    EXPECT_FALSE(load_generator_points(path));
+    std::filesystem::remove(path);
+}
+
+#ifndef __wasm__
+namespace {
+// Whether the first and last default generators and the first and last generators of the hash indices are `expected`.
+bool sample_generators_match(std::vector<grumpkin::g1::affine_element> const& expected)
+{
+    const std::array<std::pair<generator_index_t, size_t>, 4> samples{ {
+        { { 0, 0 }, 0 },
+        { { 0, 2047 }, 2047 },
+        { { 1, 0 }, 2048 },
+        { { 32, 127 }, 6143 },
+    } };
+    bool matches = true;
+    for (const auto& [index, i] : samples) {
+        const auto& data = get_generator_data(index);
+        matches &= data.generator == expected[3 * i] && data.aux_generator == expected[3 * i + 1] &&
+                   data.skew_generator == expected[3 * i + 2];
+    }
+    return matches;
+}
+
+/**
+ * Write `points` as the generator points file of BB_PRECOMPUTED_DIR and check, in a fresh process, that the first
+ * use of a generator finds `expected`. Threadsafe death tests re-execute the test binary, so the child has not derived
+ * or loaded the points whatever ran before; it re-runs the test up to EXPECT_EXIT, writing the same file.
+ */
+void expect_generator_points_in_fresh_process(std::vector<grumpkin::g1::affine_element> const& points,
+                                              std::vector<grumpkin::g1::affine_element> const& expected)
+{
+    const auto dir = std::filesystem::temp_directory_path() / "generators_precomputed_test";
+    std::filesystem::create_directories(dir);
+    write_points_file(dir / GENERATOR_POINTS_FILE_NAME, GENERATOR_POINTS_FILE_TAG, points);
+    setenv(PRECOMPUTED_DIR_ENV, dir.c_str(), 1);
+
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    EXPECT_EXIT(exit(sample_generators_match(expected) ? 0 : 1), ::testing::ExitedWithCode(0), "");
+
+    unsetenv(PRECOMPUTED_DIR_ENV);
+    std::filesystem::remove_all(dir);
+}
+} // namespace
+
+TEST(generators, precomputed_points_match_derived_points)
+{
+    const auto derived = derive_generator_points();
+    expect_generator_points_in_fresh_process(derived, derived);
+}
+
+TEST(generators, derived_points_match_checksum)
+{
+    EXPECT_EQ(compute_points_checksum(derive_generator_points()), GENERATOR_POINTS_CHECKSUM);
+}
+
+TEST(generators, precomputed_points_must_be_the_derived_points)
+{
+    // The file is well formed and its header checksum matches its points, but they are not the generators: it is
+    // ignored and the generators are derived.
+    const auto derived = derive_generator_points();
+    const std::vector<grumpkin::g1::affine_element> reversed(derived.rbegin(), derived.rend());
+    expect_generator_points_in_fresh_process(reversed, derived);
+}
+
+TEST(generators, mismatched_precomputed_points_are_derived)
+{
+    const auto derived = derive_generator_points();
+    const std::vector<grumpkin::g1::affine_element> truncated(derived.rbegin(), derived.rend() - 1);
+    expect_generator_points_in_fresh_process(truncated, derived);
+}
+#endif
@@ -0,0 +1,114 @@
+#include "points_file.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/crypto/keccak/keccak.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace crypto {
+namespace generators {
+
+namespace {
+points_checksum hash_points(const uint8_t* data, const size_t num_points)
+{
+    const keccak256 hash = ethash_keccak256(data, num_points * sizeof(grumpkin::g1::affine_element));
+    return { hash.word64s[0], hash.word64s[1], hash.word64s[2], hash.word64s[3] };
+}
+} // namespace
+
+points_checksum compute_points_checksum(std::vector<grumpkin::g1::affine_element> const& points)
+{
+    return hash_points(reinterpret_cast<const uint8_t*>(points.data()), points.size());
+}
+
+void write_points_file(std::string const& path,
+                       const uint64_t tag,
+                       std::vector<grumpkin::g1::affine_element> const& points)
+{
+    const auto* data = reinterpret_cast<const uint8_t*>(points.data());
+    const points_checksum checksum = hash_points(data, points.size());
+    points_file_header header{ POINTS_FILE_MAGIC, POINTS_FILE_VERSION, tag, points.size(), 0, {} };
+    std::memcpy(header.checksum, checksum.data(), sizeof(header.checksum));
+
+    std::ofstream os(path, std::ios::binary);
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    os.write(reinterpret_cast<const char*>(data),
+             static_cast<std::streamsize>(points.size() * sizeof(grumpkin::g1::affine_element)));
+    if (!os.good()) {
+        throw_or_abort("Failed to write points file: " + path);
+    }
+}
+
+std::optional<std::vector<grumpkin::g1::affine_element>> read_points_file(std::string const& path,
+                                                                          const uint64_t tag,
+                                                                          const size_t num_points,
+                                                                          points_checksum const& expected_checksum)
+{
+#ifdef __wasm__
+    static_cast<void>(path);
+    static_cast<void>(tag);
+    static_cast<void>(num_points);
+    static_cast<void>(expected_checksum);
+    return std::nullopt;
+#else
+    const size_t file_size = sizeof(points_file_header) + num_points * sizeof(grumpkin::g1::affine_element);
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return std::nullopt;
+    }
+    struct stat file_stat;
+    if (::fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) != file_size) {
+        ::close(fd);
+        info("Ignoring points file ", path, ": not ", num_points, " points");
+        return std::nullopt;
+    }
+    void* mapped = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        info("Ignoring points file ", path, ": cannot be mapped");
+        return std::nullopt;
+    }
+
+    // The header is checked first so that a file of other points is rejected without hashing it. The points are then
+    // hashed, rather than trusting the header, to reject a file that was damaged or edited after it was written.
+    std::optional<std::vector<grumpkin::g1::affine_element>> points;
+    points_file_header header;
+    std::memcpy(&header, mapped, sizeof(header));
+    const auto* data = static_cast<const uint8_t*>(mapped) + sizeof(header);
+    if (header.magic == POINTS_FILE_MAGIC && header.version == POINTS_FILE_VERSION && header.tag == tag &&
+        header.num_points == num_points &&
+        std::memcmp(header.checksum, expected_checksum.data(), sizeof(header.checksum)) == 0 &&
+        hash_points(data, num_points) == expected_checksum) {
+        points.emplace(num_points);
+        std::memcpy(static_cast<void*>(points->data()), data, num_points * sizeof(grumpkin::g1::affine_element));
+    } else {
+        info("Ignoring points file ", path, ": it does not hold the expected points");
+    }
+    ::munmap(mapped, file_size);
+    return points;
+#endif
+}
+
+std::optional<std::vector<grumpkin::g1::affine_element>> read_precomputed_points(
+    std::string const& file_name,
+    const uint64_t tag,
+    const size_t num_points,
+    points_checksum const& expected_checksum)
+{
+    const char* dir = std::getenv(PRECOMPUTED_DIR_ENV);
+    if (dir == nullptr || *dir == '\0') {
+        return std::nullopt;
+    }
+    return read_points_file(std::string(dir) + "/" + file_name, tag, num_points, expected_checksum);
+}
+
+} // namespace generators
+} // namespace crypto
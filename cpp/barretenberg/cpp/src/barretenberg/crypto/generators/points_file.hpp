@@ -0,0 +1,74 @@
+#pragma once
+#include <array>
+#include <optional>
+#include <string>
+#include <vector>
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+
+/**
+ * Files of precomputed grumpkin points, written at build time by precompute_tables, so that a process can load the
+ * generator points and lookup tables it needs instead of deriving them on first use.
+ *
+ * Layout:
+ *   - a fixed 64 byte header (points_file_header): magic, format version, a tag naming the table the points belong to,
+ *     the number of points and the keccak256 of the points;
+ *   - the points, as laid out in memory (x then y, each as four 64 bit limbs in Montgomery form, in the byte order of
+ *     the host that wrote them), so that they can be copied out of the mapped file as they are.
+ *
+ * The checksum in the header only detects a damaged file. Which points a file must hold is fixed by the reader: it
+ * passes the checksum of the canonical points, compiled into the binary, and files holding any other points are
+ * ignored.
+ */
+namespace crypto {
+namespace generators {
+
+constexpr uint32_t POINTS_FILE_MAGIC = 0x50545342; // "PTSB"
+constexpr uint32_t POINTS_FILE_VERSION = 1;
+
+// The environment variable naming the directory precompute_tables wrote its files to, and the names of the files.
+constexpr const char* PRECOMPUTED_DIR_ENV = "BB_PRECOMPUTED_DIR";
+constexpr const char* GENERATOR_POINTS_FILE_NAME = "generator_points.dat";
+constexpr const char* PEDERSEN_TABLES_FILE_NAME = "pedersen_tables.dat";
+
+struct points_file_header {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t tag;
+    uint64_t num_points;
+    uint64_t reserved;
+    uint64_t checksum[4];
+};
+static_assert(sizeof(points_file_header) == 64);
+
+// The keccak256 of the points of a file, as four 64 bit words.
+using points_checksum = std::array<uint64_t, 4>;
+
+points_checksum compute_points_checksum(std::vector<grumpkin::g1::affine_element> const& points);
+
+void write_points_file(std::string const& path,
+                       const uint64_t tag,
+                       std::vector<grumpkin::g1::affine_element> const& points);
+
+/**
+ * Maps the points file at `path` and returns its points, or std::nullopt if there is no such file, or if it is not a
+ * points file of this format holding `num_points` points tagged `tag` whose keccak256 is `expected_checksum`. A file
+ * that exists but does not match is logged as ignored.
+ */
+std::optional<std::vector<grumpkin::g1::affine_element>> read_points_file(std::string const& path,
+                                                                          const uint64_t tag,
+                                                                          const size_t num_points,
+                                                                          points_checksum const& expected_checksum);
+
+/**
+ * Reads the points file `file_name` in the directory named by BB_PRECOMPUTED_DIR, as read_points_file. Returns
+ * std::nullopt if the variable is not set. The generator points and lookup tables are read this way when first used,
+ * and derived if there is no matching file.
+ */
+std::optional<std::vector<grumpkin::g1::affine_element>> read_precomputed_points(
+    std::string const& file_name,
+    const uint64_t tag,
+    const size_t num_points,
+    points_checksum const& expected_checksum);
+
+} // namespace generators
+} // namespace crypto
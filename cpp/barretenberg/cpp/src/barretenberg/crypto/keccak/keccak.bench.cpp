@@ -0,0 +1,53 @@
+#include "keccak.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace benchmark;
+
+namespace {
+constexpr size_t NUM_INPUTS = 1024;
+
+// Short inputs, like the challenges of a keccak transcript: state.range(0) bytes each.
+struct Inputs {
+    std::vector<std::vector<uint8_t>> messages;
+    std::vector<const uint8_t*> data;
+    std::vector<size_t> sizes;
+    std::vector<keccak256> hashes;
+
+    explicit Inputs(size_t length)
+        : messages(NUM_INPUTS, std::vector<uint8_t>(length, 0xab))
+        , hashes(NUM_INPUTS)
+    {
+        for (const auto& message : messages) {
+            data.push_back(message.data());
+            sizes.push_back(message.size());
+        }
+    }
+};
+} // namespace
+
+void keccak256_one_at_a_time(State& state) noexcept
+{
+    Inputs inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_INPUTS; ++i) {
+            inputs.hashes[i] = ethash_keccak256(inputs.data[i], inputs.sizes[i]);
+        }
+        DoNotOptimize(inputs.hashes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_INPUTS));
+}
+BENCHMARK(keccak256_one_at_a_time)->Arg(32)->Arg(64)->Arg(128)->Arg(512);
+
+void keccak256_batch(State& state) noexcept
+{
+    Inputs inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        ethash_keccak256_batch(inputs.data.data(), inputs.sizes.data(), NUM_INPUTS, inputs.hashes.data());
+        DoNotOptimize(inputs.hashes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_INPUTS));
+}
+BENCHMARK(keccak256_batch)->Arg(32)->Arg(64)->Arg(128)->Arg(512);
+
+BENCHMARK_MAIN();
@@ -29,12 +29,35 @@ extern "C" {
  */
 void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT;
 
+/**
+ * Keccak-f[1600] applied to 4 independent states at once, using AVX2 when the cpu supports it.
+ */
+void ethash_keccakf1600_x4(uint64_t states[4][25]) NOEXCEPT;
+
 struct keccak256 ethash_keccak256(const uint8_t* data, size_t size) NOEXCEPT;
 
+/**
+ * keccak256 of many independent inputs: out[i] = ethash_keccak256(data[i], sizes[i]).
+ *
+ * Inputs are absorbed 8 at a time with AVX-512F, or 4 at a time with AVX2, and one at a time otherwise.
+ */
+void ethash_keccak256_batch(const uint8_t* const* data,
+                            const size_t* sizes,
+                            size_t num_inputs,
+                            struct keccak256* out) NOEXCEPT;
+
 struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements);
 
 struct keccak256 hash_field_element(const uint64_t* limb);
 
+/**
+ * out[i] = hash_field_elements(limbs[i], num_elements[i]), computed with ethash_keccak256_batch.
+ */
+void hash_field_elements_batch(const uint64_t* const* limbs,
+                               const size_t* num_elements,
+                               size_t num_inputs,
+                               struct keccak256* out);
+
 #ifdef __cplusplus
 }
 #endif
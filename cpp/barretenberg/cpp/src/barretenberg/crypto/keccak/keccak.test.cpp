@@ -0,0 +1,93 @@
+#include "keccak.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace {
+std::mt19937_64 engine(42);
+
+std::vector<uint8_t> random_bytes(size_t length)
+{
+    std::vector<uint8_t> bytes(length);
+    for (auto& byte : bytes) {
+        byte = static_cast<uint8_t>(engine());
+    }
+    return bytes;
+}
+
+bool operator==(const keccak256& lhs, const keccak256& rhs)
+{
+    return std::equal(std::begin(lhs.word64s), std::end(lhs.word64s), std::begin(rhs.word64s));
+}
+} // namespace
+
+TEST(keccak, known_answer)
+{
+    // keccak256("") = c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470
+    const keccak256 hash = ethash_keccak256(nullptr, 0);
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(hash.word64s);
+    EXPECT_EQ(bytes[0], 0xc5);
+    EXPECT_EQ(bytes[1], 0xd2);
+    EXPECT_EQ(bytes[31], 0x70);
+}
+
+TEST(keccak, keccakf1600_x4_matches_single)
+{
+    uint64_t states[4][25];
+    uint64_t expected[4][25];
+    for (size_t lane = 0; lane < 4; ++lane) {
+        for (size_t i = 0; i < 25; ++i) {
+            states[lane][i] = expected[lane][i] = engine();
+        }
+        ethash_keccakf1600(expected[lane]);
+    }
+    ethash_keccakf1600_x4(states);
+    for (size_t lane = 0; lane < 4; ++lane) {
+        for (size_t i = 0; i < 25; ++i) {
+            EXPECT_EQ(states[lane][i], expected[lane][i]);
+        }
+    }
+}
+
+TEST(keccak, batch_matches_single)
+{
+    // Lengths either side of the 136 byte rate, so lanes finish at different times and pick up new inputs.
+    std::vector<std::vector<uint8_t>> messages;
+    for (size_t i = 0; i < 45; ++i) {
+        messages.push_back(random_bytes((i * 37) % 450));
+    }
+    std::vector<const uint8_t*> data;
+    std::vector<size_t> sizes;
+    for (const auto& message : messages) {
+        data.push_back(message.data());
+        sizes.push_back(message.size());
+    }
+    std::vector<keccak256> hashes(messages.size());
+    ethash_keccak256_batch(data.data(), sizes.data(), messages.size(), hashes.data());
+    for (size_t i = 0; i < messages.size(); ++i) {
+        EXPECT_TRUE(hashes[i] == ethash_keccak256(messages[i].data(), messages[i].size()));
+    }
+}
+
+TEST(keccak, field_elements_batch_matches_single)
+{
+    std::vector<std::vector<uint64_t>> inputs;
+    for (size_t i = 0; i < 11; ++i) {
+        std::vector<uint64_t> limbs((i + 1) * 4);
+        for (auto& limb : limbs) {
+            limb = engine();
+        }
+        inputs.push_back(limbs);
+    }
+    std::vector<const uint64_t*> limbs;
+    std::vector<size_t> num_elements;
+    for (const auto& input : inputs) {
+        limbs.push_back(input.data());
+        num_elements.push_back(input.size() / 4);
+    }
+    std::vector<keccak256> hashes(inputs.size());
+    hash_field_elements_batch(limbs.data(), num_elements.data(), inputs.size(), hashes.data());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_TRUE(hashes[i] == hash_field_elements(inputs[i].data(), inputs[i].size() / 4));
+    }
+}
@@ -0,0 +1,302 @@
+/**
+ * Keccak-f[1600] over several independent states at once, and keccak256 over many independent inputs.
+ *
+ * The states are interleaved word by word (word i of every state is contiguous) and permuted with GCC vector
+ * extensions, one 64-bit state word per vector lane. The same source is compiled for 8 lanes with AVX-512F, 4 lanes
+ * with AVX2, and a portable 4 lane build that the compiler lowers to scalar code.
+ */
+#include "keccak.hpp"
+
+#include <string.h>
+#include <vector>
+
+namespace {
+
+constexpr uint64_t round_constants[24] = {
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000, 0x000000000000808b,
+    0x0000000080000001, 0x8000000080008081, 0x8000000000008009, 0x000000000000008a, 0x0000000000000088,
+    0x0000000080008009, 0x000000008000000a, 0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+    0x8000000000008003, 0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+};
+
+// Rotation offsets for the rho step, indexed by x + 5 * y.
+constexpr unsigned rho_offsets[25] = { 0,  1,  62, 28, 27, 36, 44, 6,  55, 20, 3,  10, 43,
+                                       25, 39, 41, 45, 15, 21, 8,  18, 2,  61, 56, 14 };
+
+// The pi step moves word x + 5 * y to y + 5 * ((2x + 3y) mod 5).
+constexpr size_t pi_destination(size_t index)
+{
+    const size_t x = index % 5;
+    const size_t y = index / 5;
+    return y + 5 * ((2 * x + 3 * y) % 5);
+}
+
+typedef uint64_t lanes4 __attribute__((vector_size(32)));
+typedef uint64_t lanes8 __attribute__((vector_size(64)));
+
+// Vectors are passed by reference: passing them by value would depend on the ISA the caller was compiled for.
+template <typename V> __attribute__((always_inline)) inline void rol(V& out, const V& x, const unsigned s)
+{
+    out = s == 0 ? x : (x << s) | (x >> (64 - s));
+}
+
+template <typename V> __attribute__((always_inline)) inline void permute(V* A)
+{
+    // The steps within a round are unrolled, so that every index and rotation in them is a compile time constant. The
+    // 24 rounds stay a loop: only the round constant differs between them.
+    for (size_t round = 0; round < 24; ++round) {
+        // theta
+        V C[5];
+#pragma GCC unroll 5
+        for (size_t x = 0; x < 5; ++x) {
+            C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+        }
+#pragma GCC unroll 5
+        for (size_t x = 0; x < 5; ++x) {
+            V D;
+            rol(D, C[(x + 1) % 5], 1);
+            D ^= C[(x + 4) % 5];
+#pragma GCC unroll 5
+            for (size_t y = 0; y < 25; y += 5) {
+                A[x + y] ^= D;
+            }
+        }
+        // rho and pi
+        V B[25];
+#pragma GCC unroll 25
+        for (size_t i = 0; i < 25; ++i) {
+            rol(B[pi_destination(i)], A[i], rho_offsets[i]);
+        }
+        // chi
+#pragma GCC unroll 5
+        for (size_t y = 0; y < 25; y += 5) {
+#pragma GCC unroll 5
+            for (size_t x = 0; x < 5; ++x) {
+                A[x + y] = B[x + y] ^ (~B[(x + 1) % 5 + y] & B[(x + 2) % 5 + y]);
+            }
+        }
+        // iota
+        A[0] ^= round_constants[round];
+    }
+}
+
+void permute_x4_portable(lanes4* A)
+{
+    permute(A);
+}
+
+#if defined(__x86_64__) && !defined(__wasm__)
+__attribute__((target("avx2"))) void permute_x4_avx2(lanes4* A)
+{
+    permute(A);
+}
+
+__attribute__((target("avx512f"))) void permute_x8_avx512(lanes8* A)
+{
+    permute(A);
+}
+
+bool has_avx2()
+{
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+bool has_avx512()
+{
+    static const bool supported = __builtin_cpu_supports("avx512f");
+    return supported;
+}
+#else
+void permute_x4_avx2(lanes4* A)
+{
+    permute(A);
+}
+
+void permute_x8_avx512(lanes8*) {}
+
+bool has_avx2()
+{
+    return false;
+}
+
+bool has_avx512()
+{
+    return false;
+}
+#endif
+
+void permute_x4(lanes4* A)
+{
+    if (has_avx2()) {
+        permute_x4_avx2(A);
+    } else {
+        permute_x4_portable(A);
+    }
+}
+
+uint64_t load_le(const uint8_t* data)
+{
+    uint64_t word;
+    memcpy(&word, data, sizeof(word));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+/**
+ * A message being absorbed by one lane.
+ */
+struct LaneCursor {
+    size_t input_index;
+    const uint8_t* data;
+    size_t remaining;
+    bool finished;
+};
+
+constexpr size_t RATE = 136; // (1600 - 2 * 256) / 8 bytes per keccak256 block
+constexpr size_t RATE_WORDS = RATE / sizeof(uint64_t);
+
+/**
+ * keccak256 the inputs `W` at a time. A lane that finishes its input immediately starts on the next one, so inputs of
+ * different lengths keep every lane busy until the queue runs out. Matches ethash_keccak256 bit for bit.
+ */
+template <size_t W, typename V, void (*Permute)(V*)>
+void keccak256_lanes(const uint8_t* const* data, const size_t* sizes, size_t num_inputs, struct keccak256* out)
+{
+    V state[25];
+    LaneCursor lanes[W];
+    size_t next_input = 0;
+    size_t num_active = 0;
+
+    const auto start_next_input = [&](size_t lane) {
+        for (size_t i = 0; i < 25; ++i) {
+            state[i][lane] = 0;
+        }
+        if (next_input == num_inputs) {
+            lanes[lane].finished = true;
+            return;
+        }
+        lanes[lane] = { next_input, data[next_input], sizes[next_input], false };
+        ++next_input;
+        ++num_active;
+    };
+
+    for (size_t lane = 0; lane < W; ++lane) {
+        start_next_input(lane);
+    }
+
+    while (num_active > 0) {
+        // Absorb one block into every active lane. The last block of an input carries the padding.
+        bool absorbed_final[W] = {};
+        for (size_t lane = 0; lane < W; ++lane) {
+            LaneCursor& cursor = lanes[lane];
+            if (cursor.finished) {
+                continue;
+            }
+            if (cursor.remaining >= RATE) {
+                for (size_t i = 0; i < RATE_WORDS; ++i) {
+                    state[i][lane] ^= load_le(cursor.data + i * sizeof(uint64_t));
+                }
+                cursor.data += RATE;
+                cursor.remaining -= RATE;
+            } else {
+                uint8_t block[RATE] = {};
+                if (cursor.remaining > 0) {
+                    memcpy(block, cursor.data, cursor.remaining);
+                }
+                block[cursor.remaining] = 0x01;
+                block[RATE - 1] |= 0x80;
+                for (size_t i = 0; i < RATE_WORDS; ++i) {
+                    state[i][lane] ^= load_le(block + i * sizeof(uint64_t));
+                }
+                absorbed_final[lane] = true;
+            }
+        }
+
+        Permute(state);
+
+        for (size_t lane = 0; lane < W; ++lane) {
+            if (!absorbed_final[lane]) {
+                continue;
+            }
+            for (size_t i = 0; i < 4; ++i) {
+                uint64_t word = state[i][lane];
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                word = __builtin_bswap64(word);
+#endif
+                out[lanes[lane].input_index].word64s[i] = word;
+            }
+            --num_active;
+            start_next_input(lane);
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+void ethash_keccakf1600_x4(uint64_t states[4][25]) NOEXCEPT
+{
+    lanes4 interleaved[25];
+    for (size_t i = 0; i < 25; ++i) {
+        for (size_t lane = 0; lane < 4; ++lane) {
+            interleaved[i][lane] = states[lane][i];
+        }
+    }
+    permute_x4(interleaved);
+    for (size_t i = 0; i < 25; ++i) {
+        for (size_t lane = 0; lane < 4; ++lane) {
+            states[lane][i] = interleaved[i][lane];
+        }
+    }
+}
+
+void ethash_keccak256_batch(const uint8_t* const* data,
+                            const size_t* sizes,
+                            size_t num_inputs,
+                            struct keccak256* out) NOEXCEPT
+{
+    if (num_inputs == 1) {
+        out[0] = ethash_keccak256(data[0], sizes[0]);
+    } else if (has_avx512()) {
+        keccak256_lanes<8, lanes8, permute_x8_avx512>(data, sizes, num_inputs, out);
+    } else if (has_avx2()) {
+        keccak256_lanes<4, lanes4, permute_x4_avx2>(data, sizes, num_inputs, out);
+    } else {
+        for (size_t i = 0; i < num_inputs; ++i) {
+            out[i] = ethash_keccak256(data[i], sizes[i]);
+        }
+    }
+}
+
+void hash_field_elements_batch(const uint64_t* const* limbs,
+                               const size_t* num_elements,
+                               size_t num_inputs,
+                               struct keccak256* out)
+{
+    // Serialise every input as big-endian 32 byte words (as hash_field_elements does) into one buffer.
+    size_t total_bytes = 0;
+    for (size_t i = 0; i < num_inputs; ++i) {
+        total_bytes += num_elements[i] * 32;
+    }
+    std::vector<uint8_t> buffer(total_bytes);
+    std::vector<const uint8_t*> data(num_inputs);
+    std::vector<size_t> sizes(num_inputs);
+    uint8_t* ptr = buffer.data();
+    for (size_t i = 0; i < num_inputs; ++i) {
+        data[i] = ptr;
+        sizes[i] = num_elements[i] * 32;
+        for (size_t j = 0; j < num_elements[i] * 4; ++j) {
+            const uint64_t word = limbs[i][j];
+            for (size_t k = 0; k < 8; ++k) {
+                *ptr++ = static_cast<uint8_t>(word >> (56 - 8 * k));
+            }
+        }
+    }
+    ethash_keccak256_batch(data.data(), sizes.data(), num_inputs, out);
+}
+}
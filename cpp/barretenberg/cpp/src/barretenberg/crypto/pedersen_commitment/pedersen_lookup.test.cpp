@@ -4,6 +4,8 @@
 
 #include "./pedersen_lookup.hpp"
 #include "../pedersen_hash/pedersen_lookup.hpp"
+#include "barretenberg/crypto/generators/points_file.hpp"
+#include <filesystem>
 
 namespace {
 auto& engine = numeric::random::get_debug_engine();
@@ -251,3 +253,84 @@ TEST(pedersen_lookup, merkle_damgard_tree_compress)
                              compute_expected(fq(m), (crypto::pedersen_hash::lookup::NUM_PEDERSEN_TABLES / 2)))
                   .x);
 }
+
+TEST(pedersen_lookup, write_tables)
+{
+    const std::string path = std::filesystem::temp_directory_path() / "pedersen_lookup_tables_test.dat";
+    crypto::pedersen_hash::lookup::write_tables(path);
+
+    // The file holds the generators, then each table, then the iv table.
+    std::vector<grumpkin::g1::affine_element> expected;
+    for (size_t i = 0; i < crypto::pedersen_hash::lookup::NUM_PEDERSEN_TABLES; ++i) {
+        expected.push_back(crypto::pedersen_hash::lookup::get_table_generator(i));
+    }
+    for (size_t i = 0; i < crypto::pedersen_hash::lookup::NUM_PEDERSEN_TABLES; ++i) {
+        const auto& table = crypto::pedersen_hash::lookup::get_table(i);
+        EXPECT_EQ(table.back(), grumpkin::g1::affine_element(expected[i] * grumpkin::fr(table.size())));
+        expected.insert(expected.end(), table.begin(), table.end());
+    }
+    const auto& iv_table = crypto::pedersen_hash::lookup::get_iv_table();
+    expected.insert(expected.end(), iv_table.begin(), iv_table.end());
+
+    const auto read_tables_file = [&path, &expected]() {
+        return crypto::generators::read_points_file(path,
+                                                    crypto::pedersen_hash::lookup::PEDERSEN_TABLES_FILE_TAG,
+                                                    expected.size(),
+                                                    crypto::pedersen_hash::lookup::PEDERSEN_TABLES_CHECKSUM);
+    };
+    EXPECT_EQ(read_tables_file(), expected);
+
+    // A well-formed tables file holding other points is ignored.
+    {
+        auto tampered = expected;
+        std::swap(tampered.front(), tampered.back());
+        crypto::generators::write_points_file(path, crypto::pedersen_hash::lookup::PEDERSEN_TABLES_FILE_TAG, tampered);
+        EXPECT_EQ(read_tables_file(), std::nullopt);
+        crypto::pedersen_hash::lookup::write_tables(path);
+    }
+
+    // The tables are in use, so they cannot be replaced.
+    EXPECT_FALSE(crypto::pedersen_hash::lookup::load_tables(path));
+    std::filesystem::remove(path);
+}
+
+#ifndef __wasm__
+// The tables read from BB_PRECOMPUTED_DIR by a fresh process are the computed ones. Threadsafe death tests re-execute
+// the test binary, so the child has not computed or loaded the tables whatever ran before; it re-runs the test up to
+// EXPECT_EXIT with the environment set here, and so reads the file rather than writing it again.
+TEST(pedersen_lookup, precomputed_tables_match_computed_tables)
+{
+    namespace lookup = crypto::pedersen_hash::lookup;
+    const auto dir = std::filesystem::temp_directory_path() / "pedersen_lookup_precomputed_test";
+    const bool is_parent = std::getenv(crypto::generators::PRECOMPUTED_DIR_ENV) == nullptr;
+    if (is_parent) {
+        std::filesystem::create_directories(dir);
+        lookup::write_tables(dir / crypto::generators::PEDERSEN_TABLES_FILE_NAME);
+        setenv(crypto::generators::PRECOMPUTED_DIR_ENV, dir.c_str(), 1);
+    }
+
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    EXPECT_EXIT(
+        {
+            const auto generators = grumpkin::g1::derive_generators<lookup::NUM_PEDERSEN_TABLES>();
+            bool matches = true;
+            for (size_t i = 0; i < lookup::NUM_PEDERSEN_TABLES; ++i) {
+                const auto& table = lookup::get_table(i);
+                matches &= lookup::get_table_generator(i) == generators[i] && table.front() == generators[i] &&
+                           table.back() == grumpkin::g1::affine_element(generators[i] * grumpkin::fr(table.size()));
+            }
+            const auto& iv_table = lookup::get_iv_table();
+            matches &= iv_table.size() == lookup::PEDERSEN_IV_TABLE_SIZE &&
+                       iv_table.back() ==
+                           grumpkin::g1::affine_element(grumpkin::g1::one * grumpkin::fr(iv_table.size()));
+            exit(matches ? 0 : 1);
+        },
+        ::testing::ExitedWithCode(0),
+        "");
+
+    if (is_parent) {
+        unsetenv(crypto::generators::PRECOMPUTED_DIR_ENV);
+        std::filesystem::remove_all(dir);
+    }
+}
+#endif
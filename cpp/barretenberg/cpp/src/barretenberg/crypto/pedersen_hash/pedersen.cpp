@@ -1,9 +1,7 @@
 #include "./pedersen.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include <iostream>
-#ifndef NO_MULTITHREADING
-#include <omp.h>
-#endif
 
 namespace crypto {
 namespace pedersen_hash {
@@ -47,16 +45,10 @@ grumpkin::fq hash_multiple(const std::vector<grumpkin::fq>& inputs, const size_t
 {
     ASSERT((inputs.size() < (1 << 16)) && "too many inputs for 16 bit index");
     std::vector<grumpkin::g1::element> out(inputs.size());
-
-#ifndef NO_MULTITHREADING
-    // Ensure generator data is initialized before threading...
-    init_generator_data();
-#pragma omp parallel for num_threads(inputs.size())
-#endif
-    for (size_t i = 0; i < inputs.size(); ++i) {
+    barretenberg::parallel_for(inputs.size(), [&](size_t i) {
         generator_index_t index = { hash_index, i };
         out[i] = hash_single(inputs[i], index);
-    }
+    });
 
     grumpkin::g1::element r = out[0];
     for (size_t i = 1; i < inputs.size(); ++i) {
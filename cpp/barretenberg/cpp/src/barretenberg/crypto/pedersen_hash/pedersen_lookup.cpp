@@ -1,7 +1,10 @@
 #include "./pedersen_lookup.hpp"
 
+#include "barretenberg/crypto/generators/points_file.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 
+#include <mutex>
+
 namespace crypto {
 namespace pedersen_hash {
 namespace lookup {
@@ -10,67 +13,70 @@ std::array<std::vector<grumpkin::g1::affine_element>, NUM_PEDERSEN_TABLES> peder
 std::vector<grumpkin::g1::affine_element> pedersen_iv_table;
 std::array<grumpkin::g1::affine_element, NUM_PEDERSEN_TABLES> generators;
 
-static bool inited = false;
+namespace {
+std::once_flag tables_flag;
 
-void init_single_lookup_table(const size_t index)
+size_t get_table_size(const size_t index)
 {
-    std::vector<grumpkin::g1::element> temp;
-    temp.reserve(PEDERSEN_TABLE_SIZE);
-    pedersen_tables[index].reserve(PEDERSEN_TABLE_SIZE);
-
-    const auto& generator = generators[index];
-    for (size_t i = 0; i < PEDERSEN_TABLE_SIZE; ++i) {
-        temp.emplace_back(generator * grumpkin::fr(i + 1));
-    }
-    grumpkin::g1::element::batch_normalize(&temp[0], PEDERSEN_TABLE_SIZE);
+    const size_t first_half = (NUM_PEDERSEN_TABLES >> 1) - 1;
+    return (index == first_half || index == 2 * first_half + 1) ? PEDERSEN_SMALL_TABLE_SIZE : PEDERSEN_TABLE_SIZE;
+}
 
-    for (const auto& element : temp) {
-        pedersen_tables[index].emplace_back(element);
+// The generators, then every table, then the iv table.
+size_t get_num_table_points()
+{
+    size_t num_points = NUM_PEDERSEN_TABLES + PEDERSEN_IV_TABLE_SIZE;
+    for (size_t i = 0; i < NUM_PEDERSEN_TABLES; ++i) {
+        num_points += get_table_size(i);
     }
+    return num_points;
 }
 
-void init_small_lookup_table(const size_t index)
+/**
+ * Fill `table` with [1]P, [2]P, ..., [table_size]P, adding P at each step rather than multiplying P by each scalar.
+ */
+void init_multiples_table(std::vector<grumpkin::g1::affine_element>& table,
+                          const grumpkin::g1::affine_element& generator,
+                          const size_t table_size)
 {
     std::vector<grumpkin::g1::element> temp;
-    temp.reserve(PEDERSEN_SMALL_TABLE_SIZE);
-    pedersen_tables[index].reserve(PEDERSEN_SMALL_TABLE_SIZE);
-
-    const auto& generator = generators[index];
-    for (size_t i = 0; i < PEDERSEN_SMALL_TABLE_SIZE; ++i) {
-        temp.emplace_back(generator * grumpkin::fr(i + 1));
+    temp.reserve(table_size);
+    temp.emplace_back(generator);
+    for (size_t i = 1; i < table_size; ++i) {
+        temp.emplace_back(temp.back() + generator);
     }
-    grumpkin::g1::element::batch_normalize(&temp[0], PEDERSEN_SMALL_TABLE_SIZE);
+    grumpkin::g1::element::batch_normalize(&temp[0], table_size);
 
+    table.clear();
+    table.reserve(table_size);
     for (const auto& element : temp) {
-        pedersen_tables[index].emplace_back(element);
+        table.emplace_back(element);
     }
 }
 
-void init_iv_lookup_table()
+// Lay out the points of a tables file (see get_num_table_points) as the tables.
+void assign_tables(std::vector<grumpkin::g1::affine_element> const& points)
 {
-    std::vector<grumpkin::g1::element> temp;
-    temp.reserve(PEDERSEN_IV_TABLE_SIZE);
-    pedersen_iv_table.reserve(PEDERSEN_IV_TABLE_SIZE);
-
-    for (size_t i = 0; i < PEDERSEN_IV_TABLE_SIZE; ++i) {
-        temp.emplace_back(grumpkin::g1::affine_one * grumpkin::fr(i + 1));
-    }
-    grumpkin::g1::element::batch_normalize(&temp[0], PEDERSEN_IV_TABLE_SIZE);
-
-    for (const auto& element : temp) {
-        pedersen_iv_table.emplace_back(element);
+    auto it = points.begin();
+    std::copy(it, it + NUM_PEDERSEN_TABLES, generators.begin());
+    it += NUM_PEDERSEN_TABLES;
+    for (size_t i = 0; i < NUM_PEDERSEN_TABLES; ++i) {
+        const auto table_size = static_cast<std::ptrdiff_t>(get_table_size(i));
+        pedersen_tables[i].assign(it, it + table_size);
+        it += table_size;
     }
+    pedersen_iv_table.assign(it, points.end());
 }
 
-void init()
+void compute_tables()
 {
-    ASSERT(BITS_PER_TABLE < BITS_OF_BETA);
-    ASSERT(BITS_PER_TABLE + BITS_OF_BETA < BITS_ON_CURVE);
-    bool pedersen_tables_filled = pedersen_iv_table.size() > 0;
-    for (size_t i = 0; i < NUM_PEDERSEN_TABLES; i++) {
-        pedersen_tables_filled = (pedersen_tables_filled && (pedersen_tables[i].size() > 0));
-    }
-    if (inited && pedersen_tables_filled) {
+    // Read the tables from BB_PRECOMPUTED_DIR when it holds them (see crypto::generators::read_precomputed_points).
+    const auto points = crypto::generators::read_precomputed_points(crypto::generators::PEDERSEN_TABLES_FILE_NAME,
+                                                                    PEDERSEN_TABLES_FILE_TAG,
+                                                                    get_num_table_points(),
+                                                                    PEDERSEN_TABLES_CHECKSUM);
+    if (points.has_value()) {
+        assign_tables(*points);
         return;
     }
     generators = grumpkin::g1::derive_generators<NUM_PEDERSEN_TABLES>();
@@ -84,7 +90,55 @@ void init()
     }
     init_small_lookup_table(2 * first_half + 1);
     init_iv_lookup_table();
-    inited = true;
+}
+} // namespace
+
+void init_single_lookup_table(const size_t index)
+{
+    init_multiples_table(pedersen_tables[index], generators[index], PEDERSEN_TABLE_SIZE);
+}
+
+void init_small_lookup_table(const size_t index)
+{
+    init_multiples_table(pedersen_tables[index], generators[index], PEDERSEN_SMALL_TABLE_SIZE);
+}
+
+void init_iv_lookup_table()
+{
+    init_multiples_table(pedersen_iv_table, grumpkin::g1::affine_one, PEDERSEN_IV_TABLE_SIZE);
+}
+
+void init()
+{
+    ASSERT(BITS_PER_TABLE < BITS_OF_BETA);
+    ASSERT(BITS_PER_TABLE + BITS_OF_BETA < BITS_ON_CURVE);
+    std::call_once(tables_flag, compute_tables);
+}
+
+bool load_tables(std::string const& path)
+{
+    auto points = crypto::generators::read_points_file(
+        path, PEDERSEN_TABLES_FILE_TAG, get_num_table_points(), PEDERSEN_TABLES_CHECKSUM);
+    if (!points.has_value()) {
+        return false;
+    }
+    bool loaded = false;
+    std::call_once(tables_flag, [&]() {
+        assign_tables(*points);
+        loaded = true;
+    });
+    return loaded;
+}
+
+void write_tables(std::string const& path)
+{
+    init();
+    std::vector<grumpkin::g1::affine_element> points(generators.begin(), generators.end());
+    for (const auto& table : pedersen_tables) {
+        points.insert(points.end(), table.begin(), table.end());
+    }
+    points.insert(points.end(), pedersen_iv_table.begin(), pedersen_iv_table.end());
+    crypto::generators::write_points_file(path, PEDERSEN_TABLES_FILE_TAG, points);
 }
 
 grumpkin::g1::affine_element get_table_generator(const size_t table_index)
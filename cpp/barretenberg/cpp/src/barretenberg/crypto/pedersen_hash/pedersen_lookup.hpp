@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+#include "barretenberg/crypto/generators/points_file.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 
 namespace crypto {
@@ -18,6 +20,13 @@ constexpr size_t NUM_PEDERSEN_TABLES_RAW = (BITS_PER_HASH / (BITS_PER_TABLE * TA
 constexpr size_t NUM_PEDERSEN_TABLES = NUM_PEDERSEN_TABLES_RAW + (NUM_PEDERSEN_TABLES_RAW & 1);
 constexpr size_t PEDERSEN_IV_TABLE_SIZE = (1UL) << 10;
 constexpr size_t NUM_PEDERSEN_IV_TABLES = 4;
+// Tags the points file of the tables (see crypto/generators/points_file.hpp).
+constexpr uint64_t PEDERSEN_TABLES_FILE_TAG = 0x504544455253454e; // "PEDERSEN"
+// The checksum of the computed tables as laid out by write_tables on a little-endian host. Tables files holding any
+// other points are ignored. It must be updated if the tables change.
+constexpr crypto::generators::points_checksum PEDERSEN_TABLES_CHECKSUM = {
+    0x300820942fda0225, 0x26ff8f4bac41b0ff, 0xeb2855bb83ef868b, 0xaba71f9a0dc2ae81
+};
 
 extern std::array<std::vector<grumpkin::g1::affine_element>, NUM_PEDERSEN_TABLES> pedersen_tables;
 extern std::vector<grumpkin::g1::affine_element> pedersen_iv_table;
@@ -28,6 +37,15 @@ void init_small_lookup_table(const size_t index);
 void init_iv_lookup_table();
 void init();
 
+/**
+ * Use the tables in the file at `path`, written by write_tables, instead of computing them when they are first used.
+ * Without a call to this, first use reads pedersen_tables.dat from BB_PRECOMPUTED_DIR if it is set. Returns false,
+ * leaving the tables to be computed, if the file cannot be read or does not hold the computed tables (see
+ * PEDERSEN_TABLES_CHECKSUM), or if the tables are already in use.
+ */
+bool load_tables(std::string const& path);
+void write_tables(std::string const& path);
+
 grumpkin::g1::affine_element get_table_generator(const size_t table_index);
 const std::array<grumpkin::fq, 2>& get_endomorphism_scalars();
 const std::vector<grumpkin::g1::affine_element>& get_table(const size_t table_index);
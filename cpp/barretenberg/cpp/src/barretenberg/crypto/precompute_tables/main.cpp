@@ -0,0 +1,23 @@
+#include "barretenberg/crypto/generators/generator_data.hpp"
+#include "barretenberg/crypto/generators/points_file.hpp"
+#include "barretenberg/crypto/pedersen_hash/pedersen_lookup.hpp"
+
+#include <iostream>
+#include <string>
+
+/**
+ * Writes the generator points and the pedersen lookup tables into the given directory, as generator_points.dat and
+ * pedersen_tables.dat. Processes read them when BB_PRECOMPUTED_DIR names the directory, or through
+ * crypto::generators::load_generator_points and crypto::pedersen_hash::lookup::load_tables.
+ */
+int main(int argc, char** argv)
+{
+    if (argc != 2) {
+        std::cerr << "usage: " << argv[0] << " <output directory>" << std::endl;
+        return 1;
+    }
+    const std::string output_dir = argv[1];
+    crypto::generators::write_generator_points(output_dir + "/" + crypto::generators::GENERATOR_POINTS_FILE_NAME);
+    crypto::pedersen_hash::lookup::write_tables(output_dir + "/" + crypto::generators::PEDERSEN_TABLES_FILE_NAME);
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "./sha256.hpp"
+#include "./sha256_simd.hpp"
 #include <array>
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/net.hpp"
@@ -10,17 +11,6 @@ namespace {
 constexpr uint32_t init_constants[8]{ 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
                                       0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
 
-constexpr uint32_t round_constants[64]{
-    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-};
-
 constexpr uint32_t ror(uint32_t val, uint32_t shift)
 {
     return (val >> (shift & 31U)) | (val << (32U - (shift & 31U)));
@@ -108,73 +98,210 @@ std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, cons
     return output;
 }
 
-hash sha256_block(const std::vector<uint8_t>& input)
+namespace {
+
+void compress_blocks_portable(std::array<uint32_t, 8>& state, const uint8_t* blocks, const size_t num_blocks)
 {
-    ASSERT(input.size() == 64);
-    std::array<uint32_t, 8> result;
-    prepare_constants(result);
-    std::array<uint32_t, 16> hash_input;
-    memcpy((void*)&hash_input[0], (void*)&input[0], 64);
-    if (is_little_endian()) {
-        for (size_t j = 0; j < hash_input.size(); ++j) {
-            hash_input[j] = __builtin_bswap32(hash_input[j]);
+    for (size_t i = 0; i < num_blocks; ++i) {
+        std::array<uint32_t, 16> hash_input;
+        memcpy((void*)&hash_input[0], (void*)&blocks[i * 64], 64);
+        if (is_little_endian()) {
+            for (size_t j = 0; j < hash_input.size(); ++j) {
+                hash_input[j] = __builtin_bswap32(hash_input[j]);
+            }
         }
+        state = sha256_block(state, hash_input);
     }
-    result = sha256_block(result, hash_input);
+}
 
-    hash output;
-    memcpy((void*)&output[0], (void*)&result[0], 32);
-    if (is_little_endian()) {
-        uint32_t* output_uint32 = (uint32_t*)&output[0];
-        for (size_t j = 0; j < 8; ++j) {
-            output_uint32[j] = __builtin_bswap32(output_uint32[j]);
-        }
+/**
+ * Compress whole 64 byte blocks, with the SHA extensions if the cpu has them.
+ */
+void compress_blocks(std::array<uint32_t, 8>& state, const uint8_t* blocks, const size_t num_blocks)
+{
+    if (simd::sha_ni_supported()) {
+        simd::compress_sha_ni(state, blocks, num_blocks);
+    } else {
+        compress_blocks_portable(state, blocks, num_blocks);
+    }
+}
+
+/**
+ * Write the final block(s) of the padded message: the bytes after the last whole block, 0x80, zeroes, and the message
+ * length in bits. Returns the number of blocks written (1 or 2).
+ */
+size_t pad_final_blocks(std::span<const uint8_t> input, std::array<uint8_t, 128>& blocks)
+{
+    const size_t remainder = input.size() % 64;
+    const size_t num_blocks = remainder + 9 > 64 ? 2 : 1;
+    blocks.fill(0);
+    if (remainder > 0) {
+        memcpy((void*)&blocks[0], (const void*)&input[input.size() - remainder], remainder);
+    }
+    blocks[remainder] = 0x80;
+    const uint64_t num_bits = static_cast<uint64_t>(input.size()) * 8;
+    for (size_t i = 0; i < 8; ++i) {
+        blocks[num_blocks * 64 - 1 - i] = static_cast<uint8_t>(num_bits >> (i * 8));
     }
+    return num_blocks;
+}
 
+hash to_hash(const std::array<uint32_t, 8>& state)
+{
+    hash output;
+    for (size_t i = 0; i < 8; ++i) {
+        output[i * 4] = static_cast<uint8_t>(state[i] >> 24);
+        output[i * 4 + 1] = static_cast<uint8_t>(state[i] >> 16);
+        output[i * 4 + 2] = static_cast<uint8_t>(state[i] >> 8);
+        output[i * 4 + 3] = static_cast<uint8_t>(state[i]);
+    }
     return output;
 }
 
-template <typename ByteContainer> hash sha256(const ByteContainer& input)
+/**
+ * Hash a whole message, compressing its blocks with `compress`. Whole blocks are read straight out of the input; only
+ * the padded tail is copied.
+ */
+template <void (*compress)(std::array<uint32_t, 8>&, const uint8_t*, size_t)>
+hash hash_message(std::span<const uint8_t> input)
 {
-    std::vector<uint8_t> message_schedule;
+    std::array<uint32_t, 8> rolling_hash;
+    prepare_constants(rolling_hash);
+    const size_t num_whole_blocks = input.size() / 64;
+    if (num_whole_blocks > 0) {
+        compress(rolling_hash, input.data(), num_whole_blocks);
+    }
+    std::array<uint8_t, 128> final_blocks;
+    const size_t num_final_blocks = pad_final_blocks(input, final_blocks);
+    compress(rolling_hash, &final_blocks[0], num_final_blocks);
+    return to_hash(rolling_hash);
+}
 
-    std::copy(input.begin(), input.end(), std::back_inserter(message_schedule));
-    uint64_t l = message_schedule.size() * 8;
-    message_schedule.push_back(0x80);
+/**
+ * A message being hashed by one lane of the multi-buffer hasher.
+ */
+struct LaneCursor {
+    size_t message_index = 0;
+    const uint8_t* message = nullptr;
+    size_t num_whole_blocks = 0;
+    size_t num_blocks = 0;
+    size_t next_block = 0;
+    std::array<uint8_t, 128> final_blocks;
 
-    uint32_t num_zero_bytes = ((448U - (message_schedule.size() << 3U)) & 511U) >> 3U;
+    void reset(size_t index, std::span<const uint8_t> input)
+    {
+        message_index = index;
+        message = input.data();
+        num_whole_blocks = input.size() / 64;
+        num_blocks = num_whole_blocks + pad_final_blocks(input, final_blocks);
+        next_block = 0;
+    }
 
-    for (size_t i = 0; i < num_zero_bytes; ++i) {
-        message_schedule.push_back(0x00);
+    const uint8_t* block() const
+    {
+        return next_block < num_whole_blocks ? message + next_block * 64
+                                             : &final_blocks[(next_block - num_whole_blocks) * 64];
     }
-    for (size_t i = 0; i < 8; ++i) {
-        uint8_t byte = static_cast<uint8_t>(l >> (uint64_t)(56 - (i * 8)));
-        message_schedule.push_back(byte);
+};
+
+} // namespace
+
+hash sha256_block(const std::vector<uint8_t>& input)
+{
+    ASSERT(input.size() == 64);
+    std::array<uint32_t, 8> result;
+    prepare_constants(result);
+    compress_blocks(result, &input[0], 1);
+    return to_hash(result);
+}
+
+hash sha256(std::span<const uint8_t> input)
+{
+    return hash_message<compress_blocks>(input);
+}
+
+template <typename ByteContainer> hash sha256(const ByteContainer& input)
+{
+    return sha256(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(input.data()), input.size()));
+}
+
+void sha256_many_portable(std::span<const std::span<const uint8_t>> inputs, std::span<hash> outputs)
+{
+    ASSERT(inputs.size() == outputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        outputs[i] = hash_message<compress_blocks_portable>(inputs[i]);
     }
-    std::array<uint32_t, 8> rolling_hash;
-    prepare_constants(rolling_hash);
-    const size_t num_blocks = message_schedule.size() / 64;
-    for (size_t i = 0; i < num_blocks; ++i) {
-        std::array<uint32_t, 16> hash_input;
-        memcpy((void*)&hash_input[0], (void*)&message_schedule[i * 64], 64);
-        if (is_little_endian()) {
-            for (size_t j = 0; j < hash_input.size(); ++j) {
-                hash_input[j] = __builtin_bswap32(hash_input[j]);
+}
+
+void simd::sha256_many_sha_ni(std::span<const std::span<const uint8_t>> inputs, std::span<hash> outputs)
+{
+    ASSERT(inputs.size() == outputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        outputs[i] = hash_message<simd::compress_sha_ni>(inputs[i]);
+    }
+}
+
+// A lane that finishes its message immediately picks up the next unstarted one, so messages of different lengths keep
+// every lane busy until the queue runs out.
+void simd::sha256_many_avx2(std::span<const std::span<const uint8_t>> inputs, std::span<hash> outputs)
+{
+    std::array<LaneCursor, simd::AVX2_LANES> lanes;
+    std::array<std::array<uint32_t, 8>, simd::AVX2_LANES> states;
+    std::array<const uint8_t*, simd::AVX2_LANES> blocks{};
+    uint32_t active_lanes = 0;
+    size_t next_message = 0;
+
+    const auto start_next_message = [&](size_t lane) {
+        if (next_message == inputs.size()) {
+            active_lanes &= ~(1U << lane);
+            return;
+        }
+        lanes[lane].reset(next_message, inputs[next_message]);
+        prepare_constants(states[lane]);
+        active_lanes |= 1U << lane;
+        ++next_message;
+    };
+
+    for (size_t lane = 0; lane < simd::AVX2_LANES; ++lane) {
+        start_next_message(lane);
+    }
+    while (active_lanes != 0) {
+        for (size_t lane = 0; lane < simd::AVX2_LANES; ++lane) {
+            if (((active_lanes >> lane) & 1U) != 0) {
+                blocks[lane] = lanes[lane].block();
+            }
+        }
+        simd::compress_avx2_x8(states, blocks, active_lanes);
+        for (size_t lane = 0; lane < simd::AVX2_LANES; ++lane) {
+            if (((active_lanes >> lane) & 1U) == 0) {
+                continue;
+            }
+            if (++lanes[lane].next_block == lanes[lane].num_blocks) {
+                outputs[lanes[lane].message_index] = to_hash(states[lane]);
+                start_next_message(lane);
             }
         }
-        rolling_hash = sha256_block(rolling_hash, hash_input);
     }
+}
 
-    hash output;
-    memcpy((void*)&output[0], (void*)&rolling_hash[0], 32);
-    if (is_little_endian()) {
-        uint32_t* output_uint32 = (uint32_t*)&output[0];
-        for (size_t j = 0; j < 8; ++j) {
-            output_uint32[j] = __builtin_bswap32(output_uint32[j]);
-        }
+void sha256_many(std::span<const std::span<const uint8_t>> inputs, std::span<hash> outputs)
+{
+    ASSERT(inputs.size() == outputs.size());
+    // One message at a time with the SHA extensions beats eight AVX2 lanes, so the lanes are only used without them.
+    if (!simd::sha_ni_supported() && simd::avx2_supported() && inputs.size() > 1) {
+        simd::sha256_many_avx2(inputs, outputs);
+        return;
+    }
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        outputs[i] = sha256(inputs[i]);
     }
+}
 
-    return output;
+std::vector<hash> sha256_many(std::span<const std::span<const uint8_t>> inputs)
+{
+    std::vector<hash> outputs(inputs.size());
+    sha256_many(inputs, outputs);
+    return outputs;
 }
 
 template hash sha256<std::vector<uint8_t>>(const std::vector<uint8_t>& input);
@@ -3,6 +3,7 @@
 #include "stdint.h"
 #include <vector>
 #include <array>
+#include <span>
 #include <iomanip>
 #include <ostream>
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
@@ -13,13 +14,27 @@ using hash = std::array<uint8_t, 32>;
 
 hash sha256_block(const std::vector<uint8_t>& input);
 
+/**
+ * @brief Hash a message without copying it. Uses the cpu's SHA extensions when available.
+ */
+hash sha256(std::span<const uint8_t> input);
+
 template <typename T> hash sha256(const T& input);
 
+/**
+ * @brief Hash many independent messages, writing the hash of inputs[i] to outputs[i].
+ *
+ * @details Suited to the many short messages hashed by calldata and witness generation. Uses the SHA extensions when
+ * available; otherwise, on AVX2 machines, hashes 8 messages at once in SIMD lanes.
+ */
+void sha256_many(std::span<const std::span<const uint8_t>> inputs, std::span<hash> outputs);
+std::vector<hash> sha256_many(std::span<const std::span<const uint8_t>> inputs);
+
 extern template hash sha256<std::vector<uint8_t>>(const std::vector<uint8_t>& input);
 extern template hash sha256<std::array<uint8_t, 32>>(const std::array<uint8_t, 32>& input);
 extern template hash sha256<std::string>(const std::string& input);
 
-inline barretenberg::fr sha256_to_field(std::vector<uint8_t> const& input)
+inline barretenberg::fr sha256_to_field(std::span<const uint8_t> input)
 {
     auto result = sha256::sha256(input);
     return from_buffer<barretenberg::fr>(&result[0]);
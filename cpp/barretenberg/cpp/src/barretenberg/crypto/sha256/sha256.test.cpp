@@ -1,5 +1,7 @@
 #include "sha256.hpp"
+#include "sha256_simd.hpp"
 #include <gtest/gtest.h>
+#include <random>
 #include <iostream>
 #include <memory>
 
@@ -98,3 +100,155 @@ TEST(misc_sha256, test_NIST_vector_five)
         EXPECT_EQ(result[i], expected[i]);
     }
 }
+
+namespace {
+std::mt19937 engine(1234);
+
+std::vector<uint8_t> random_bytes(size_t length)
+{
+    std::vector<uint8_t> bytes(length);
+    for (auto& byte : bytes) {
+        byte = static_cast<uint8_t>(engine());
+    }
+    return bytes;
+}
+} // namespace
+
+TEST(misc_sha256, span_matches_container)
+{
+    // Cover every padding case: tails of 0..63 bytes, including those that spill into a second final block.
+    for (size_t length = 0; length < 200; ++length) {
+        auto input = random_bytes(length);
+        EXPECT_EQ(sha256::sha256(std::span<const uint8_t>(input)), sha256::sha256(input));
+    }
+}
+
+TEST(misc_sha256, many_matches_single)
+{
+    std::vector<std::vector<uint8_t>> messages;
+    for (size_t i = 0; i < 37; ++i) {
+        messages.push_back(random_bytes((i * 29) % 300));
+    }
+    std::vector<std::span<const uint8_t>> inputs(messages.begin(), messages.end());
+    auto outputs = sha256::sha256_many(inputs);
+    ASSERT_EQ(outputs.size(), messages.size());
+    for (size_t i = 0; i < messages.size(); ++i) {
+        EXPECT_EQ(outputs[i], sha256::sha256(messages[i]));
+    }
+}
+
+TEST(misc_sha256, avx2_lanes_match_single)
+{
+    if (!sha256::simd::avx2_supported()) {
+        GTEST_SKIP() << "no AVX2";
+    }
+    // Lanes finish at different times and pick up new messages mid-flight.
+    std::vector<std::vector<uint8_t>> messages;
+    for (size_t i = 0; i < 53; ++i) {
+        messages.push_back(random_bytes((i * 71) % 400));
+    }
+    std::vector<std::span<const uint8_t>> inputs(messages.begin(), messages.end());
+    std::vector<sha256::hash> outputs(messages.size());
+    sha256::simd::sha256_many_avx2(inputs, outputs);
+    for (size_t i = 0; i < messages.size(); ++i) {
+        EXPECT_EQ(outputs[i], sha256::sha256(messages[i]));
+    }
+}
+
+TEST(misc_sha256, avx2_inactive_lanes_are_untouched)
+{
+    if (!sha256::simd::avx2_supported()) {
+        GTEST_SKIP() << "no AVX2";
+    }
+    std::array<std::array<uint32_t, 8>, sha256::simd::AVX2_LANES> states{};
+    std::array<const uint8_t*, sha256::simd::AVX2_LANES> blocks{};
+    auto block = random_bytes(64);
+    for (size_t lane = 0; lane < sha256::simd::AVX2_LANES; ++lane) {
+        states[lane] = { 1, 2, 3, 4, 5, 6, 7, static_cast<uint32_t>(lane) };
+        blocks[lane] = &block[0];
+    }
+    const auto initial = states;
+    sha256::simd::compress_avx2_x8(states, blocks, 0b01010101);
+    for (size_t lane = 0; lane < sha256::simd::AVX2_LANES; ++lane) {
+        if (lane % 2 == 0) {
+            EXPECT_NE(states[lane], initial[lane]);
+        } else {
+            EXPECT_EQ(states[lane], initial[lane]);
+        }
+    }
+}
+
+namespace {
+using many_function = void (*)(std::span<const std::span<const uint8_t>>, std::span<sha256::hash>);
+
+// Every way sha256_many can hash that this cpu supports, whichever one it would pick.
+std::vector<std::pair<std::string, many_function>> supported_backends()
+{
+    std::vector<std::pair<std::string, many_function>> backends{ { "portable", sha256::sha256_many_portable } };
+    if (sha256::simd::sha_ni_supported()) {
+        backends.emplace_back("sha_ni", sha256::simd::sha256_many_sha_ni);
+    }
+    if (sha256::simd::avx2_supported()) {
+        backends.emplace_back("avx2", sha256::simd::sha256_many_avx2);
+    }
+    return backends;
+}
+} // namespace
+
+TEST(misc_sha256, every_backend_matches_known_answers)
+{
+    // The NIST vectors above.
+    std::vector<std::pair<std::string, sha256::hash>> vectors{
+        { "abc",
+          { 0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA, 0x41, 0x41, 0x40, 0xDE, 0x5D, 0xAE, 0x22, 0x23,
+            0xB0, 0x03, 0x61, 0xA3, 0x96, 0x17, 0x7A, 0x9C, 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00, 0x15, 0xAD } },
+        { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+          { 0x24, 0x8D, 0x6A, 0x61, 0xD2, 0x06, 0x38, 0xB8, 0xE5, 0xC0, 0x26, 0x93, 0x0C, 0x3E, 0x60, 0x39,
+            0xA3, 0x3C, 0xE4, 0x59, 0x64, 0xFF, 0x21, 0x67, 0xF6, 0xEC, 0xED, 0xD4, 0x19, 0xDB, 0x06, 0xC1 } },
+        { "\xbd",
+          { 0x68, 0x32, 0x57, 0x20, 0xaa, 0xbd, 0x7c, 0x82, 0xf3, 0x0f, 0x55, 0x4b, 0x31, 0x3d, 0x05, 0x70,
+            0xc9, 0x5a, 0xcc, 0xbb, 0x7d, 0xc4, 0xb5, 0xaa, 0xe1, 0x12, 0x04, 0xc0, 0x8f, 0xfe, 0x73, 0x2b } },
+        { "\xc9\x8c\x8e\x55",
+          { 0x7a, 0xbc, 0x22, 0xc0, 0xae, 0x5a, 0xf2, 0x6c, 0xe9, 0x3d, 0xbb, 0x94, 0x43, 0x3a, 0x0e, 0x0b,
+            0x2e, 0x11, 0x9d, 0x01, 0x4f, 0x8e, 0x7f, 0x65, 0xbd, 0x56, 0xc6, 0x1c, 0xcc, 0xcd, 0x95, 0x04 } },
+        { std::string(1000, 'A'),
+          { 0xc2, 0xe6, 0x86, 0x82, 0x34, 0x89, 0xce, 0xd2, 0x01, 0x7f, 0x60, 0x59, 0xb8, 0xb2, 0x39, 0x31,
+            0x8b, 0x63, 0x64, 0xf6, 0xdc, 0xd8, 0x35, 0xd0, 0xa5, 0x19, 0x10, 0x5a, 0x1e, 0xad, 0xd6, 0xe4 } },
+    };
+    // Repeat them so the batch is not a whole number of AVX2 lanes.
+    const auto first_vectors = vectors;
+    vectors.insert(vectors.end(), first_vectors.begin(), first_vectors.begin() + 4);
+    ASSERT_NE(vectors.size() % sha256::simd::AVX2_LANES, 0U);
+
+    std::vector<std::span<const uint8_t>> inputs;
+    for (const auto& [message, digest] : vectors) {
+        inputs.emplace_back(reinterpret_cast<const uint8_t*>(message.data()), message.size());
+    }
+    for (const auto& [name, hash_many] : supported_backends()) {
+        std::vector<sha256::hash> outputs(inputs.size());
+        hash_many(inputs, outputs);
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            EXPECT_EQ(outputs[i], vectors[i].second) << name << " message " << i;
+        }
+    }
+}
+
+TEST(misc_sha256, every_backend_matches_portable)
+{
+    // Batches that fill the AVX2 lanes exactly, leave some idle, and are smaller than one set of lanes, with lengths
+    // covering every padding case.
+    for (const size_t num_messages : { size_t(1), size_t(7), size_t(8), size_t(9), size_t(53) }) {
+        std::vector<std::vector<uint8_t>> messages;
+        for (size_t i = 0; i < num_messages; ++i) {
+            messages.push_back(random_bytes((i * 37 + num_messages) % 300));
+        }
+        std::vector<std::span<const uint8_t>> inputs(messages.begin(), messages.end());
+        std::vector<sha256::hash> expected(num_messages);
+        sha256::sha256_many_portable(inputs, expected);
+        for (const auto& [name, hash_many] : supported_backends()) {
+            std::vector<sha256::hash> outputs(num_messages);
+            hash_many(inputs, outputs);
+            EXPECT_EQ(outputs, expected) << name << " with " << num_messages << " messages";
+        }
+    }
+}
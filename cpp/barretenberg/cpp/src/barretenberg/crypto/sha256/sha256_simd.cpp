@@ -0,0 +1,224 @@
+#include "./sha256_simd.hpp"
+
+#if defined(__x86_64__) && !defined(__wasm__)
+#include <cpuid.h>
+#include <cstring>
+#include <immintrin.h>
+
+namespace sha256::simd {
+
+namespace {
+uint32_t load_big_endian(const uint8_t* data)
+{
+    uint32_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return __builtin_bswap32(word);
+}
+} // namespace
+
+bool sha_ni_supported()
+{
+    static const bool supported = []() {
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+            return false;
+        }
+        // CPUID.(EAX=7,ECX=0):EBX.SHA[bit 29]. The SHA instructions also need SSSE3 and SSE4.1.
+        return (ebx & (1U << 29)) != 0 && __builtin_cpu_supports("ssse3") && __builtin_cpu_supports("sse4.1");
+    }();
+    return supported;
+}
+
+bool avx2_supported()
+{
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+__attribute__((target("sha,ssse3,sse4.1"))) void compress_sha_ni(std::array<uint32_t, 8>& state,
+                                                                 const uint8_t* blocks,
+                                                                 size_t num_blocks)
+{
+    // Big-endian word loads.
+    const __m128i byteswap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+
+    // The rounds instruction wants the state as (A, B, E, F) and (C, D, G, H).
+    __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+    __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4]));
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);
+    state1 = _mm_shuffle_epi32(state1, 0x1B);
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+    for (size_t block = 0; block < num_blocks; ++block) {
+        const uint8_t* data = blocks + block * 64;
+        const __m128i abef_save = state0;
+        const __m128i cdgh_save = state1;
+
+        // The message schedule is kept in a rolling window of four 4-word vectors.
+        __m128i messages[4];
+        for (size_t i = 0; i < 4; ++i) {
+            messages[i] =
+                _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i)), byteswap);
+        }
+
+        for (size_t i = 0; i < 16; ++i) {
+            __m128i& current = messages[i % 4];
+            __m128i message = _mm_add_epi32(
+                current, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&round_constants[4 * i])));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, message);
+            if (i >= 3 && i < 15) {
+                // w[i + 4] = w[i] + sigma1(w[i + 3]) + w[i - 3] + sigma0(w[i - 4 + 1]), four words at a time.
+                __m128i& next = messages[(i + 1) % 4];
+                next = _mm_add_epi32(next, _mm_alignr_epi8(current, messages[(i + 3) % 4], 4));
+                next = _mm_sha256msg2_epu32(next, current);
+            }
+            message = _mm_shuffle_epi32(message, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, message);
+            if (i >= 1 && i < 13) {
+                __m128i& previous = messages[(i + 3) % 4];
+                previous = _mm_sha256msg1_epu32(previous, current);
+            }
+        }
+
+        state0 = _mm_add_epi32(state0, abef_save);
+        state1 = _mm_add_epi32(state1, cdgh_save);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+
+namespace {
+template <int shift> __attribute__((target("avx2"))) inline __m256i ror(const __m256i value)
+{
+    return _mm256_or_si256(_mm256_srli_epi32(value, shift), _mm256_slli_epi32(value, 32 - shift));
+}
+} // namespace
+
+__attribute__((target("avx2"))) void compress_avx2_x8(std::array<std::array<uint32_t, 8>, AVX2_LANES>& states,
+                                                      const std::array<const uint8_t*, AVX2_LANES>& blocks,
+                                                      const uint32_t active_lanes)
+{
+    // Inactive lanes hash a block of zeroes and are discarded at the end.
+    static constexpr uint8_t zero_block[64] = {};
+    std::array<const uint8_t*, AVX2_LANES> data;
+    for (size_t lane = 0; lane < AVX2_LANES; ++lane) {
+        data[lane] = ((active_lanes >> lane) & 1U) != 0 ? blocks[lane] : zero_block;
+    }
+
+    // Transpose: vector i holds word i of every lane.
+    alignas(32) std::array<std::array<uint32_t, AVX2_LANES>, 8> transposed;
+    for (size_t i = 0; i < 8; ++i) {
+        for (size_t lane = 0; lane < AVX2_LANES; ++lane) {
+            transposed[i][lane] = states[lane][i];
+        }
+    }
+    __m256i initial[8];
+    for (size_t i = 0; i < 8; ++i) {
+        initial[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(&transposed[i][0]));
+    }
+
+    __m256i w[16];
+    for (size_t i = 0; i < 16; ++i) {
+        w[i] = _mm256_setr_epi32(static_cast<int>(load_big_endian(data[0] + 4 * i)),
+                                 static_cast<int>(load_big_endian(data[1] + 4 * i)),
+                                 static_cast<int>(load_big_endian(data[2] + 4 * i)),
+                                 static_cast<int>(load_big_endian(data[3] + 4 * i)),
+                                 static_cast<int>(load_big_endian(data[4] + 4 * i)),
+                                 static_cast<int>(load_big_endian(data[5] + 4 * i)),
+                                 static_cast<int>(load_big_endian(data[6] + 4 * i)),
+                                 static_cast<int>(load_big_endian(data[7] + 4 * i)));
+    }
+
+    __m256i a = initial[0];
+    __m256i b = initial[1];
+    __m256i c = initial[2];
+    __m256i d = initial[3];
+    __m256i e = initial[4];
+    __m256i f = initial[5];
+    __m256i g = initial[6];
+    __m256i h = initial[7];
+
+    for (size_t i = 0; i < 64; ++i) {
+        if (i >= 16) {
+            // Extend the schedule in place over a 16 word window.
+            const __m256i w15 = w[(i - 15) & 15];
+            const __m256i w2 = w[(i - 2) & 15];
+            const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(ror<7>(w15), ror<18>(w15)), _mm256_srli_epi32(w15, 3));
+            const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(ror<17>(w2), ror<19>(w2)), _mm256_srli_epi32(w2, 10));
+            w[i & 15] = _mm256_add_epi32(_mm256_add_epi32(w[i & 15], w[(i - 7) & 15]), _mm256_add_epi32(s0, s1));
+        }
+        const __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(ror<6>(e), ror<11>(e)), ror<25>(e));
+        const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        const __m256i temp1 = _mm256_add_epi32(
+            _mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, w[i & 15])),
+            _mm256_set1_epi32(static_cast<int>(round_constants[i])));
+        const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(ror<2>(a), ror<13>(a)), ror<22>(a));
+        const __m256i maj = _mm256_or_si256(_mm256_and_si256(a, _mm256_or_si256(b, c)), _mm256_and_si256(b, c));
+        const __m256i temp2 = _mm256_add_epi32(S0, maj);
+
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, temp1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(temp1, temp2);
+    }
+
+    const __m256i result[8] = { a, b, c, d, e, f, g, h };
+    for (size_t i = 0; i < 8; ++i) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&transposed[i][0]), _mm256_add_epi32(result[i], initial[i]));
+    }
+    for (size_t lane = 0; lane < AVX2_LANES; ++lane) {
+        if (((active_lanes >> lane) & 1U) == 0) {
+            continue;
+        }
+        for (size_t i = 0; i < 8; ++i) {
+            states[lane][i] = transposed[i][lane];
+        }
+    }
+}
+
+} // namespace sha256::simd
+
+#else
+
+#include "barretenberg/common/throw_or_abort.hpp"
+
+namespace sha256::simd {
+
+bool sha_ni_supported()
+{
+    return false;
+}
+
+void compress_sha_ni(std::array<uint32_t, 8>&, const uint8_t*, size_t)
+{
+    throw_or_abort("SHA-NI is not available on this platform");
+}
+
+bool avx2_supported()
+{
+    return false;
+}
+
+void compress_avx2_x8(std::array<std::array<uint32_t, 8>, AVX2_LANES>&,
+                      const std::array<const uint8_t*, AVX2_LANES>&,
+                      uint32_t)
+{
+    throw_or_abort("AVX2 is not available on this platform");
+}
+
+} // namespace sha256::simd
+
+#endif
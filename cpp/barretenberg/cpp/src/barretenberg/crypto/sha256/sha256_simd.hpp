@@ -0,0 +1,74 @@
+#pragma once
+
+#include "./sha256.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace sha256 {
+
+/**
+ * @brief sha256_many without the hardware accelerated paths, whatever the cpu supports. The simd paths below must
+ * produce the same hashes.
+ */
+void sha256_many_portable(std::span<const std::span<const uint8_t>> inputs, std::span<hash> outputs);
+
+inline constexpr uint32_t round_constants[64]{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+} // namespace sha256
+
+/**
+ * Hardware accelerated SHA-256 compression functions, used by sha256.cpp when the cpu supports them.
+ *
+ * Blocks are 64 bytes of big-endian message data; states are in the host-endian form used by sha256_block.
+ * On anything but x86_64 the *_supported() functions return false and the compression functions must not be called.
+ */
+namespace sha256::simd {
+
+/**
+ * @brief Whether the cpu implements the SHA extensions (SHA-NI).
+ */
+bool sha_ni_supported();
+
+/**
+ * @brief Compress `num_blocks` consecutive blocks into `state` with the SHA extensions.
+ */
+void compress_sha_ni(std::array<uint32_t, 8>& state, const uint8_t* blocks, size_t num_blocks);
+
+/**
+ * @brief sha256_many one message at a time on top of compress_sha_ni. Requires sha_ni_supported().
+ */
+void sha256_many_sha_ni(std::span<const std::span<const uint8_t>> inputs, std::span<hash> outputs);
+
+/**
+ * @brief Whether the cpu (and OS) support AVX2.
+ */
+bool avx2_supported();
+
+constexpr size_t AVX2_LANES = 8;
+
+/**
+ * @brief Compress one block into each of 8 independent states at once, one message per 32-bit AVX2 lane.
+ *
+ * @details Lanes whose bit in `active_lanes` is clear are left untouched and their block pointer is not read.
+ */
+void compress_avx2_x8(std::array<std::array<uint32_t, 8>, AVX2_LANES>& states,
+                      const std::array<const uint8_t*, AVX2_LANES>& blocks,
+                      uint32_t active_lanes);
+
+/**
+ * @brief sha256_many on top of compress_avx2_x8. Requires avx2_supported().
+ */
+void sha256_many_avx2(std::span<const std::span<const uint8_t>> inputs, std::span<hash> outputs);
+
+} // namespace sha256::simd
@@ -58,12 +58,14 @@ size_t init_proving_key(uint8_t const* constraint_system_buf, uint8_t const** pk
     auto composer = create_circuit(constraint_system, std::move(crs_factory));
     auto proving_key = composer.compute_proving_key();
 
-    auto buffer = to_buffer(*proving_key);
-    auto raw_buf = (uint8_t*)malloc(buffer.size());
-    memcpy(raw_buf, (void*)buffer.data(), buffer.size());
+    // Serialize straight into the returned buffer rather than into a vector that would then be copied.
+    auto size = plonk::serialized_size(*proving_key);
+    auto raw_buf = (uint8_t*)malloc(size);
+    auto raw_buf_end = raw_buf;
+    write(raw_buf_end, *proving_key);
     *pk_buf = raw_buf;
 
-    return buffer.size();
+    return size;
 }
 
 size_t init_verification_key(void* pippenger, uint8_t const* g2x, uint8_t const* pk_buf, uint8_t const** vk_buf)
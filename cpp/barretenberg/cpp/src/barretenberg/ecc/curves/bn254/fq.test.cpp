@@ -1,5 +1,6 @@
 #include "fq.hpp"
 #include "pseudorandom.hpp"
+#include <cstring>
 #include <gtest/gtest.h>
 
 using namespace barretenberg;
@@ -446,6 +447,56 @@ TEST(fq, serialize_from_buffer)
     EXPECT_EQ((result == expected), true);
 }
 
+TEST(fq, serialize_span)
+{
+    // Large enough to be split across threads.
+    constexpr size_t num_elements = 5000;
+    std::vector<fq> expected(num_elements);
+    for (auto& element : expected) {
+        element = fq::random_element();
+    }
+
+    std::vector<uint8_t> buffer(num_elements * sizeof(fq));
+    fq::serialize_to_buffer(expected, buffer.data());
+    for (size_t i = 0; i < num_elements; ++i) {
+        uint8_t element_buffer[32];
+        fq::serialize_to_buffer(expected[i], &element_buffer[0]);
+        EXPECT_EQ(std::memcmp(&buffer[i * sizeof(fq)], &element_buffer[0], sizeof(fq)), 0);
+    }
+
+    std::vector<fq> result(num_elements);
+    fq::serialize_from_buffer(buffer.data(), result);
+    EXPECT_EQ(result, expected);
+}
+
+TEST(fq, serialize_vector)
+{
+    std::vector<fq> expected(3000);
+    for (auto& element : expected) {
+        element = fq::random_element();
+    }
+
+    // The generic vector format: a big-endian size, then the elements.
+    std::vector<uint8_t> expected_buffer;
+    serialize::write(expected_buffer, static_cast<uint32_t>(expected.size()));
+    for (const auto& element : expected) {
+        uint8_t element_buffer[32];
+        fq::serialize_to_buffer(element, &element_buffer[0]);
+        expected_buffer.insert(expected_buffer.end(), &element_buffer[0], &element_buffer[32]);
+    }
+
+    std::vector<uint8_t> buffer = to_buffer</*include_size=*/true>(expected);
+    EXPECT_EQ(buffer, expected_buffer);
+
+    std::vector<uint8_t> raw_buffer(expected_buffer.size());
+    uint8_t* ptr = raw_buffer.data();
+    write(ptr, expected);
+    EXPECT_EQ(ptr, raw_buffer.data() + raw_buffer.size());
+    EXPECT_EQ(raw_buffer, expected_buffer);
+
+    EXPECT_EQ(from_buffer<std::vector<fq>>(buffer), expected);
+}
+
 TEST(fq, multiplicative_generator)
 {
     EXPECT_EQ(fq::multiplicative_generator(), fq(3));
@@ -435,4 +435,71 @@ void pow_bench(State& state) noexcept
 }
 BENCHMARK(pow_bench);
 
+namespace {
+// Serialized witness-sized vectors (the size-prefixed format of from_buffer<std::vector<fr>>), as decoded by
+// acir_proofs::new_proof.
+std::vector<fr> random_vector(const size_t num_elements)
+{
+    std::vector<fr> elements(num_elements);
+    for (auto& element : elements) {
+        element = fr::random_element();
+    }
+    return elements;
+}
+} // namespace
+
+void vector_from_buffer_bench(State& state) noexcept
+{
+    const auto buffer = to_buffer</*include_size=*/true>(random_vector(static_cast<size_t>(state.range(0))));
+    for (auto _ : state) {
+        DoNotOptimize(from_buffer<std::vector<fr>>(buffer));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(buffer.size()));
+}
+BENCHMARK(vector_from_buffer_bench)->RangeMultiplier(4)->Range(1 << 16, 1 << 20)->Unit(kMillisecond);
+
+// The same decode, one element at a time, as the generic vector read does it.
+void vector_from_buffer_per_element_bench(State& state) noexcept
+{
+    const auto buffer = to_buffer</*include_size=*/true>(random_vector(static_cast<size_t>(state.range(0))));
+    for (auto _ : state) {
+        const uint8_t* ptr = buffer.data();
+        uint32_t size;
+        serialize::read(ptr, size);
+        std::vector<fr> elements(size);
+        for (auto& element : elements) {
+            read(ptr, element);
+        }
+        DoNotOptimize(elements);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(buffer.size()));
+}
+BENCHMARK(vector_from_buffer_per_element_bench)->RangeMultiplier(4)->Range(1 << 16, 1 << 20)->Unit(kMillisecond);
+
+void vector_to_buffer_bench(State& state) noexcept
+{
+    const auto elements = random_vector(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(to_buffer</*include_size=*/true>(elements));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(elements.size() * 32));
+}
+BENCHMARK(vector_to_buffer_bench)->RangeMultiplier(4)->Range(1 << 16, 1 << 20)->Unit(kMillisecond);
+
+// The same encode, one element at a time, as the generic vector write does it.
+void vector_to_buffer_per_element_bench(State& state) noexcept
+{
+    const auto elements = random_vector(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<uint8_t> buffer;
+        serialize::write(buffer, static_cast<uint32_t>(elements.size()));
+        for (const auto& element : elements) {
+            write(buffer, element);
+        }
+        DoNotOptimize(buffer);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(elements.size() * 32));
+}
+BENCHMARK(vector_to_buffer_per_element_bench)->RangeMultiplier(4)->Range(1 << 16, 1 << 20)->Unit(kMillisecond);
+
 BENCHMARK_MAIN();
@@ -2,6 +2,7 @@
 #include "./scalar_multiplication.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/numa.hpp"
 
 #ifndef NO_MULTITHREADING
 #include <omp.h>
@@ -27,9 +28,13 @@ template <typename T> inline size_t point_table_buf_size(size_t num_points)
     return sizeof(T) * point_table_size(num_points);
 }
 
+/**
+ * Every pippenger thread reads the point table at random, so on multi-socket machines its pages are interleaved over
+ * the NUMA nodes rather than all landing on the node of whichever thread first writes them.
+ */
 template <typename T> inline T* point_table_alloc(size_t num_points)
 {
-    return (T*)aligned_alloc(64, point_table_buf_size<T>(num_points));
+    return (T*)numa::aligned_alloc_interleaved(point_table_buf_size<T>(num_points));
 }
 
 class Pippenger {
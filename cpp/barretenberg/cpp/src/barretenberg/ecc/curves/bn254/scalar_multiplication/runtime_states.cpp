@@ -2,6 +2,8 @@
 
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/numa.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
 #ifndef NO_MULTITHREADING
@@ -40,10 +42,28 @@ pippenger_runtime_state::pippenger_runtime_state(const size_t num_initial_points
     round_counts = (uint64_t*)(aligned_alloc(32, MAX_NUM_ROUNDS * sizeof(uint64_t)));
 
     const size_t points_per_thread = static_cast<size_t>(num_points) / num_threads;
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
+
+    // Thread i of evaluate_pippenger_rounds runs on numa::node_of_chunk(i, num_threads) and is the only user of its
+    // slice of the bucket and scratch arrays, so place each slice on that node before anything touches it. The point
+    // schedule is written per thread but read per round, so it is spread over every node instead.
+    numa::interleave_range(point_schedule,
+                           (static_cast<size_t>(num_points) * num_rounds + prefetch_overflow) * sizeof(uint64_t));
     for (size_t i = 0; i < num_threads; ++i) {
+        const size_t node = numa::node_of_chunk(i, num_threads);
+        const size_t thread_offset = i * points_per_thread;
+        numa::bind_range(point_pairs_1 + thread_offset + (i * 16),
+                         (points_per_thread + 16) * sizeof(g1::affine_element),
+                         node);
+        numa::bind_range(point_pairs_2 + thread_offset + (i * 16),
+                         (points_per_thread + 16) * sizeof(g1::affine_element),
+                         node);
+        numa::bind_range(scratch_space + i * (points_per_thread / 2), (points_per_thread / 2) * sizeof(fq), node);
+        numa::bind_range(bucket_counts + i * num_buckets, num_buckets * sizeof(uint32_t), node);
+        numa::bind_range(bit_counts + i * num_buckets, num_buckets * sizeof(uint32_t), node);
+        numa::bind_range(bucket_empty_status + i * num_buckets, num_buckets * sizeof(bool), node);
+    }
+
+    parallel_for_numa(num_threads, [&](size_t i) {
         const size_t thread_offset = i * points_per_thread;
         memset((void*)(point_pairs_1 + thread_offset + (i * 16)),
                0,
@@ -57,11 +77,11 @@ pippenger_runtime_state::pippenger_runtime_state(const size_t num_initial_points
             memset((void*)(point_schedule + round_offset + thread_offset), 0, points_per_thread * sizeof(uint64_t));
         }
         memset((void*)(skew_table + thread_offset), 0, points_per_thread * sizeof(bool));
-    }
+        memset((void*)(bucket_counts + i * num_buckets), 0, num_buckets * sizeof(uint32_t));
+        memset((void*)(bit_counts + i * num_buckets), 0, num_buckets * sizeof(uint32_t));
+        memset((void*)(bucket_empty_status + i * num_buckets), 0, num_buckets * sizeof(bool));
+    });
 
-    memset((void*)bucket_counts, 0, num_threads * num_buckets * sizeof(uint32_t));
-    memset((void*)bit_counts, 0, num_threads * num_buckets * sizeof(uint32_t));
-    memset((void*)bucket_empty_status, 0, num_threads * num_buckets * sizeof(bool));
     memset((void*)round_counts, 0, MAX_NUM_ROUNDS * sizeof(uint64_t));
 }
 
@@ -3,6 +3,7 @@
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
 #include <array>
@@ -217,10 +218,7 @@ void compute_wnaf_states(uint64_t* point_schedule,
             thread_round_counts[i][j] = 0;
         }
     }
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < num_threads; ++i) {
+    parallel_for(num_threads, [&](size_t i) {
         fr T0;
         uint64_t* wnaf_table = &point_schedule[(2 * i) * num_initial_points_per_thread];
         const fr* thread_scalars = &scalars[i * num_initial_points_per_thread];
@@ -246,7 +244,7 @@ void compute_wnaf_states(uint64_t* point_schedule,
                                          num_points,
                                          wnaf_bits);
         }
-    }
+    });
 
     for (size_t i = 0; i < num_rounds; ++i) {
         round_counts[i] = 0;
@@ -267,14 +265,11 @@ void compute_wnaf_states(uint64_t* point_schedule,
 void organize_buckets(uint64_t* point_schedule, const uint64_t*, const size_t num_points)
 {
     const size_t num_rounds = get_num_rounds(num_points);
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < num_rounds; ++i) {
+    parallel_for(num_rounds, [&](size_t i) {
         scalar_multiplication::process_buckets(&point_schedule[i * num_points],
                                                num_points,
                                                static_cast<uint32_t>(get_optimal_bucket_width(num_points / 2)) + 1);
-    }
+    });
 }
 
 /**
@@ -739,10 +734,8 @@ g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
     std::unique_ptr<g1::element[], decltype(&aligned_free)> thread_accumulators(
         static_cast<g1::element*>(aligned_alloc(64, num_threads * sizeof(g1::element))), &aligned_free);
 
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < num_threads; ++j) {
+    // Run thread j on the node that holds its slice of `state` (see pippenger_runtime_state).
+    parallel_for_numa(num_threads, [&](size_t j) {
         thread_accumulators[j].self_set_infinity();
 
         for (size_t i = 0; i < num_rounds; ++i) {
@@ -833,7 +826,7 @@ g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
             }
             thread_accumulators[j] += accumulator;
         }
-    }
+    });
 
     g1::element result;
     result.self_set_infinity();
@@ -881,12 +874,9 @@ g1::element pippenger(fr* scalars,
         std::vector<g1::element> exponentiation_results(num_initial_points);
         // might as well multithread this...
         // Possible optimization: use group::batch_mul_with_endomorphism here.
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-        for (size_t i = 0; i < num_initial_points; ++i) {
+        parallel_for(num_initial_points, [&](size_t i) {
             exponentiation_results[i] = g1::element(points[i * 2]) * scalars[i];
-        }
+        });
 
         for (size_t i = num_initial_points - 1; i > 0; --i) {
             exponentiation_results[i - 1] += exponentiation_results[i];
@@ -230,6 +230,13 @@ template <class Params> struct alignas(32) field {
 
     static field serialize_from_buffer(const uint8_t* buffer) { return from_buffer<field>(buffer); }
 
+    /**
+     * @brief Bulk serialize_to_buffer / serialize_from_buffer of `values.size()` elements, each in the format of a
+     * single element (32 big-endian bytes, in standard form). Large spans are split across threads.
+     */
+    static void serialize_to_buffer(std::span<const field> values, uint8_t* buffer);
+    static void serialize_from_buffer(const uint8_t* buffer, std::span<field> values);
+
     inline std::vector<uint8_t> to_buffer() const { return ::to_buffer(*this); }
 
     struct wide_array {
@@ -550,6 +557,37 @@ template <typename B, typename Params> void write(B& buf, field<Params> const& v
     write(buf, input.data[0]);
 }
 
+// Vectors of field elements, in the format of the generic vector read / write, are converted in bulk when reading from
+// or writing to raw buffers and byte vectors. The generic versions would convert, and for byte vectors grow the
+// buffer, one limb at a time.
+template <typename Params> void read(uint8_t const*& it, std::vector<field<Params>>& value)
+{
+    using serialize::read;
+    DEBUG_CANARY_READ(it, value);
+    uint32_t size;
+    read(it, size);
+    value.resize(size);
+    field<Params>::serialize_from_buffer(it, value);
+    it += size * sizeof(field<Params>);
+}
+
+template <typename Params> void write(uint8_t*& buf, std::vector<field<Params>> const& value)
+{
+    using serialize::write;
+    write(buf, static_cast<uint32_t>(value.size()));
+    field<Params>::serialize_to_buffer(value, buf);
+    buf += value.size() * sizeof(field<Params>);
+}
+
+template <typename Params> void write(std::vector<uint8_t>& buf, std::vector<field<Params>> const& value)
+{
+    using serialize::write;
+    write(buf, static_cast<uint32_t>(value.size()));
+    const size_t offset = buf.size();
+    buf.resize(offset + value.size() * sizeof(field<Params>));
+    field<Params>::serialize_to_buffer(value, buf.data() + offset);
+}
+
 } // namespace barretenberg
 
 #include "./field_impl.hpp"
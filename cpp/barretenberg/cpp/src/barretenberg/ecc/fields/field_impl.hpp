@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
@@ -402,6 +403,47 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     }
 }
 
+template <class T> void field<T>::serialize_to_buffer(std::span<const field> values, uint8_t* buffer)
+{
+    static_assert(sizeof(field) == 32);
+    // The conversion out of Montgomery form, a multiplication per element, dominates. The limbs are byte swapped in
+    // registers as they are stored.
+    constexpr size_t min_elements_per_chunk = 1 << 10;
+    parallel_for_range(
+        values.size(),
+        [&](size_t start, size_t end) {
+            uint8_t* it = buffer + start * sizeof(field);
+            for (size_t i = start; i < end; ++i) {
+                const field input = values[i].from_montgomery_form();
+                serialize::write(it, input.data[3]);
+                serialize::write(it, input.data[2]);
+                serialize::write(it, input.data[1]);
+                serialize::write(it, input.data[0]);
+            }
+        },
+        min_elements_per_chunk);
+}
+
+template <class T> void field<T>::serialize_from_buffer(const uint8_t* buffer, std::span<field> values)
+{
+    constexpr size_t min_elements_per_chunk = 1 << 10;
+    parallel_for_range(
+        values.size(),
+        [&](size_t start, size_t end) {
+            // Load and swap limb by limb: copying each element out as a block first measured slower.
+            const uint8_t* it = buffer + start * sizeof(field);
+            for (size_t i = start; i < end; ++i) {
+                field result{ 0, 0, 0, 0 };
+                serialize::read(it, result.data[3]);
+                serialize::read(it, result.data[2]);
+                serialize::read(it, result.data[1]);
+                serialize::read(it, result.data[0]);
+                values[i] = result.to_montgomery_form();
+            }
+        },
+        min_elements_per_chunk);
+}
+
 template <class T> constexpr field<T> field<T>::tonelli_shanks_sqrt() const noexcept
 {
     // Tonelli-shanks algorithm begins by finding a field element Q and integer S,
@@ -420,6 +420,25 @@ TEST(StandardHonkComposer, BaseCase)
     ASSERT_TRUE(verified);
 }
 
+TEST(StandardHonkComposer, TwoProversFromOneComposer)
+{
+    auto composer = StandardHonkComposer();
+    uint32_t a_idx = composer.circuit_constructor.add_variable(2);
+    uint32_t b_idx = composer.circuit_constructor.add_variable(3);
+    uint32_t c_idx = composer.circuit_constructor.add_variable(6);
+    composer.create_mul_gate({ a_idx, b_idx, c_idx, 1, -1, 0 });
+
+    // Each prover takes ownership of the wire polynomials, so the second one must not see them emptied
+    auto first_prover = composer.create_prover();
+    auto second_prover = composer.create_prover();
+    auto verifier = composer.create_verifier();
+
+    plonk::proof first_proof = first_prover.construct_proof();
+    plonk::proof second_proof = second_prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(first_proof));
+    EXPECT_TRUE(verifier.verify_proof(second_proof));
+}
+
 TEST(StandardHonkComposer, TwoGates)
 {
     auto run_test = [](bool expect_verified) {
@@ -1,6 +1,8 @@
 #pragma once
 #include <array>
+#include <span>
 #include <string>
+#include <string_view>
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/proof_system/arithmetization/arithmetization.hpp"
 #include "barretenberg/transcript/manifest.hpp"
@@ -48,16 +50,37 @@ struct StandardArithmetization {
     static constexpr size_t NUM_PRECOMPUTED_POLYNOMIALS = 13;
     static constexpr size_t NUM_UNSHIFTED_POLYNOMIALS = NUM_POLYNOMIALS - NUM_SHIFTED_POLYNOMIALS;
 
-    // *** WARNING: The order of this array must be manually updated to match POLYNOMIAL enum ***
-    // TODO(luke): This is a temporary measure to associate the above enum with sting tags. Its only needed because
-    // the
-    // polynomials/commitments in the prover/verifier are stored in maps. This storage could be converted to simple
-    // arrays at which point these string tags can be removed.
-    inline static const std::array<std::string, 18> ENUM_TO_COMM = {
+    // *** WARNING: The order of these arrays must be manually updated to match POLYNOMIAL enum ***
+    // Compile-time names of the polynomials, indexed by POLYNOMIAL. These are the transcript labels of the witness
+    // commitments and the keys of the precomputed commitments in the verification key.
+    static constexpr std::array<std::string_view, NUM_POLYNOMIALS> ENUM_TO_COMM = {
         "Q_C",           "Q_1",     "Q_2",  "Q_3",  "Q_M",    "SIGMA_1",
         "SIGMA_2",       "SIGMA_3", "ID_1", "ID_2", "ID_3",   "LAGRANGE_FIRST",
         "LAGRANGE_LAST", "W_1",     "W_2",  "W_3",  "Z_PERM", "Z_PERM_SHIFT"
     };
+    // The keys under which the proving key's polynomial store holds the precomputed polynomials, indexed by POLYNOMIAL.
+    // They are resolved once, when a prover is constructed; the prover then only indexes by POLYNOMIAL.
+    static constexpr std::array<std::string_view, NUM_PRECOMPUTED_POLYNOMIALS> ENUM_TO_PROVING_KEY = {
+        "q_c_lagrange",
+        "q_1_lagrange",
+        "q_2_lagrange",
+        "q_3_lagrange",
+        "q_m_lagrange",
+        "sigma_1_lagrange",
+        "sigma_2_lagrange",
+        "sigma_3_lagrange",
+        "id_1_lagrange",
+        "id_2_lagrange",
+        "id_3_lagrange",
+        "L_first_lagrange",
+        "L_last_lagrange",
+    };
+
+    /**
+     * @brief Handles to all of the polynomials, indexed by POLYNOMIAL. The handles do not own the polynomials: the
+     * precomputed ones belong to the proving key and the witness ones to the prover.
+     */
+    template <typename Fr> using PolynomialHandles = std::array<std::span<Fr>, NUM_POLYNOMIALS>;
 };
 } // namespace proof_system::honk
 
@@ -238,7 +238,8 @@ class CommitmentKey {
     {
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs.get_monomial_size());
-        return barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points(
+        // The monomial points are stored as a pippenger point table (each point followed by its endomorphism image).
+        return barretenberg::scalar_multiplication::pippenger_unsafe(
             const_cast<Fr*>(polynomial.data()), srs.get_monomial_points(), degree, pippenger_runtime_state);
     };
 
@@ -71,8 +71,9 @@ template <typename Params> class InnerProductArgument {
         // use SRS instead of G_vector.
         auto srs_elements = ck->srs.get_monomial_points();
         std::vector<affine_element> G_vec_local(poly_degree);
+        // The monomial points are a pippenger point table: each point is followed by its endomorphism image.
         for (size_t i = 0; i < poly_degree; i++) {
-            G_vec_local[i] = srs_elements[i];
+            G_vec_local[i] = srs_elements[i * 2];
         }
         // Construct b vector
         // TODO(#220)(Arijit): For round i=0, b_vec can be derived in-place.
@@ -239,8 +240,9 @@ template <typename Params> class InnerProductArgument {
         auto srs_elements = vk->srs.get_monomial_points();
         // Copy the G_vector to local memory.
         std::vector<affine_element> G_vec_local(poly_degree);
+        // The monomial points are a pippenger point table: each point is followed by its endomorphism image.
         for (size_t i = 0; i < poly_degree; i++) {
-            G_vec_local[i] = srs_elements[i];
+            G_vec_local[i] = srs_elements[i * 2];
         }
         auto G_zero = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points(
             &s_vec[0], &G_vec_local[0], poly_degree, vk->pippenger_runtime_state);
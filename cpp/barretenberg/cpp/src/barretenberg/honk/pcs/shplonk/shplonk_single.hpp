@@ -93,18 +93,15 @@ template <typename Params> class SingleBatchOpeningScheme {
 
         // G₀ = ∑ⱼ ρʲ ⋅ vⱼ / ( r − xⱼ )
         Fr current_nu = Fr::one();
-        Polynomial tmp(G.size());
         for (size_t j = 0; j < num_opening_pairs; ++j) {
             // (Cⱼ, xⱼ, vⱼ)
             const auto& [challenge, evaluation] = opening_pairs[j];
 
-            // tmp = ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ )
-            tmp = witness_polynomials[j];
-            tmp[0] -= evaluation;
             Fr scaling_factor = current_nu * inverse_vanishing_evals[j]; // = ρʲ / ( r − xⱼ )
 
-            // G -= ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ )
-            G.add_scaled(tmp, -scaling_factor);
+            // G -= ρʲ ⋅ ( fⱼ(X) − vⱼ) / ( r − xⱼ ), without copying fⱼ(X) to subtract vⱼ from it
+            G.add_scaled(witness_polynomials[j], -scaling_factor);
+            G[0] += scaling_factor * evaluation;
 
             current_nu *= nu_challenge;
         }
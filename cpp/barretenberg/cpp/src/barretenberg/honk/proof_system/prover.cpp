@@ -18,6 +18,7 @@
 #include "barretenberg/honk/sumcheck/relations/grand_product_computation_relation.hpp"
 #include "barretenberg/honk/sumcheck/relations/grand_product_initialization_relation.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/honk/flavor/flavor.hpp"
 #include "barretenberg/transcript/transcript_wrappers.hpp"
 #include <string>
@@ -41,25 +42,14 @@ using POLYNOMIAL = proof_system::honk::StandardArithmetization::POLYNOMIAL;
 template <typename settings>
 Prover<settings>::Prover(std::vector<barretenberg::polynomial>&& wire_polys,
                          const std::shared_ptr<plonk::proving_key> input_key)
-    : wire_polynomials(wire_polys)
+    : wire_polynomials(std::move(wire_polys))
     , key(input_key)
     , queue(key, transcript)
 {
-    // Note(luke): This could be done programmatically with some hacks but this isnt too bad and its nice to see the
-    // polys laid out explicitly.
-    prover_polynomials[POLYNOMIAL::Q_C] = key->polynomial_store.get("q_c_lagrange");
-    prover_polynomials[POLYNOMIAL::Q_L] = key->polynomial_store.get("q_1_lagrange");
-    prover_polynomials[POLYNOMIAL::Q_R] = key->polynomial_store.get("q_2_lagrange");
-    prover_polynomials[POLYNOMIAL::Q_O] = key->polynomial_store.get("q_3_lagrange");
-    prover_polynomials[POLYNOMIAL::Q_M] = key->polynomial_store.get("q_m_lagrange");
-    prover_polynomials[POLYNOMIAL::SIGMA_1] = key->polynomial_store.get("sigma_1_lagrange");
-    prover_polynomials[POLYNOMIAL::SIGMA_2] = key->polynomial_store.get("sigma_2_lagrange");
-    prover_polynomials[POLYNOMIAL::SIGMA_3] = key->polynomial_store.get("sigma_3_lagrange");
-    prover_polynomials[POLYNOMIAL::ID_1] = key->polynomial_store.get("id_1_lagrange");
-    prover_polynomials[POLYNOMIAL::ID_2] = key->polynomial_store.get("id_2_lagrange");
-    prover_polynomials[POLYNOMIAL::ID_3] = key->polynomial_store.get("id_3_lagrange");
-    prover_polynomials[POLYNOMIAL::LAGRANGE_FIRST] = key->polynomial_store.get("L_first_lagrange");
-    prover_polynomials[POLYNOMIAL::LAGRANGE_LAST] = key->polynomial_store.get("L_last_lagrange");
+    // Resolve the precomputed polynomials once; from here on they are only accessed by POLYNOMIAL.
+    for (size_t i = 0; i < StandardArithmetization::NUM_PRECOMPUTED_POLYNOMIALS; ++i) {
+        prover_polynomials[i] = key->polynomial_store.get(std::string(StandardArithmetization::ENUM_TO_PROVING_KEY[i]));
+    }
     prover_polynomials[POLYNOMIAL::W_L] = wire_polynomials[0];
     prover_polynomials[POLYNOMIAL::W_R] = wire_polynomials[1];
     prover_polynomials[POLYNOMIAL::W_O] = wire_polynomials[2];
@@ -80,7 +70,8 @@ Prover<settings>::Prover(std::vector<barretenberg::polynomial>&& wire_polys,
 template <typename settings> void Prover<settings>::compute_wire_commitments()
 {
     for (size_t i = 0; i < settings::Arithmetization::num_wires; ++i) {
-        queue.add_commitment(wire_polynomials[i], "W_" + std::to_string(i + 1));
+        const auto label = StandardArithmetization::ENUM_TO_COMM[POLYNOMIAL::W_L + i];
+        queue.add_commitment(wire_polynomials[i], std::string(label));
     }
 }
 
@@ -138,7 +129,7 @@ template <typename settings> void Prover<settings>::execute_grand_product_comput
     z_permutation =
         prover_library::compute_permutation_grand_product<settings::program_width>(key, wire_polynomials, beta, gamma);
 
-    queue.add_commitment(z_permutation, "Z_PERM");
+    queue.add_commitment(z_permutation, std::string(StandardArithmetization::ENUM_TO_COMM[POLYNOMIAL::Z_PERM]));
 
     prover_polynomials[POLYNOMIAL::Z_PERM] = z_permutation;
     prover_polynomials[POLYNOMIAL::Z_PERM_SHIFT] = z_permutation.shifted();
@@ -176,18 +167,37 @@ template <typename settings> void Prover<settings>::execute_univariatization_rou
     Fr rho = transcript.get_challenge("rho");
     std::vector<Fr> rhos = Gemini::powers_of_rho(rho, NUM_POLYNOMIALS);
 
-    // Batch the unshifted polynomials and the to-be-shifted polynomials using ρ
-    Polynomial batched_poly_unshifted(key->circuit_size); // batched unshifted polynomials
-    for (size_t i = 0; i < NUM_UNSHIFTED_POLYS; ++i) {
-        batched_poly_unshifted.add_scaled(prover_polynomials[i], rhos[i]);
-    }
+    // Batch the unshifted polynomials and the to-be-shifted polynomials using ρ, in one pass over the coefficients
+    // (split across threads) that reads every polynomial and writes each batched coefficient once.
+    Polynomial batched_poly_unshifted(key->circuit_size);     // batched unshifted polynomials
     Polynomial batched_poly_to_be_shifted(key->circuit_size); // batched to-be-shifted polynomials
-    batched_poly_to_be_shifted.add_scaled(prover_polynomials[POLYNOMIAL::Z_PERM], rhos[NUM_UNSHIFTED_POLYS]);
+    constexpr size_t min_iterations_per_chunk = 1 << 8;
+    barretenberg::parallel_for_range(
+        key->circuit_size,
+        [&](size_t start, size_t end) {
+            for (size_t j = start; j < end; ++j) {
+                Fr batched_unshifted = Fr::zero();
+                for (size_t i = 0; i < NUM_UNSHIFTED_POLYS; ++i) {
+                    batched_unshifted += rhos[i] * prover_polynomials[i][j];
+                }
+                batched_poly_unshifted[j] = batched_unshifted;
+                batched_poly_to_be_shifted[j] = rhos[NUM_UNSHIFTED_POLYS] * prover_polynomials[POLYNOMIAL::Z_PERM][j];
+            }
+        },
+        min_iterations_per_chunk);
 
     // Compute d-1 polynomials Fold^(i), i = 1, ..., d-1.
     fold_polynomials = Gemini::compute_fold_polynomials(
         sumcheck_output.challenge_point, std::move(batched_poly_unshifted), std::move(batched_poly_to_be_shifted));
 
+    // The batching above was the last use of the witness polynomials, so release them now rather than with the prover.
+    // The precomputed polynomials belong to the proving key and are kept.
+    for (size_t i = POLYNOMIAL::W_L; i < POLYNOMIAL::COUNT; ++i) {
+        prover_polynomials[i] = {};
+    }
+    wire_polynomials = std::vector<barretenberg::polynomial>();
+    z_permutation = Polynomial();
+
     // Compute and add to trasnscript the commitments [Fold^(i)], i = 1, ..., d-1
     for (size_t l = 0; l < key->log_circuit_size - 1; ++l) {
         queue.add_commitment(fold_polynomials[l + 2], "Gemini:FOLD_" + std::to_string(l + 1));
@@ -66,7 +66,8 @@ template <typename settings> class Prover {
     std::shared_ptr<plonk::proving_key> key;
 
     // Container for spans of all polynomials required by the prover (i.e. all multivariates evaluated by Sumcheck).
-    std::array<std::span<Fr>, honk::StandardArithmetization::POLYNOMIAL::COUNT> prover_polynomials;
+    // The witness polynomials they point to are released after the univariatization round.
+    honk::StandardArithmetization::PolynomialHandles<Fr> prover_polynomials;
 
     // Container for d + 1 Fold polynomials produced by Gemini
     std::vector<Polynomial> fold_polynomials;
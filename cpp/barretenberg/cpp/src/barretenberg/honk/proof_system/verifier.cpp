@@ -165,7 +165,7 @@ template <typename program_settings> bool Verifier<program_settings>::verify_pro
 
     // Construct batched commitment for NON-shifted polynomials
     for (size_t i = 0; i < NUM_PRECOMPUTED; ++i) {
-        auto commitment = key->commitments[honk::StandardArithmetization::ENUM_TO_COMM[i]];
+        auto commitment = key->commitments[std::string(honk::StandardArithmetization::ENUM_TO_COMM[i])];
         batched_commitment_unshifted += commitment * rhos[i];
     }
     // add wire commitments
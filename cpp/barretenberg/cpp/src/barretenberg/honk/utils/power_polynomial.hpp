@@ -1,10 +1,6 @@
 #include "barretenberg/polynomials/polynomial.hpp"
-#include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include <span>
-
-#ifndef NO_MULTITHREADING
-#include "omp.h"
-#endif
 namespace proof_system::honk::power_polynomial {
 /**
  * @brief Generate the power polynomial vector
@@ -21,34 +17,19 @@ template <typename Fr> barretenberg::Polynomial<Fr> generate_vector(Fr zeta, siz
     barretenberg::Polynomial<Fr> pow_vector(vector_size);
 
     constexpr size_t usefulness_margin = 4;
-    size_t num_threads = max_threads::compute_num_threads();
-    if (vector_size < (usefulness_margin * num_threads)) {
-        num_threads = 1;
-    }
-    // Prepare for a random number of threads. We need to handle the last thread separately
-    size_t thread_size = vector_size / num_threads;
-    size_t last_thread_size = thread_size;
-    // Check if the vector size is divided into threads cleanly
-    if ((vector_size % thread_size) != 0) {
-        thread_size += 1;
-        last_thread_size = vector_size % thread_size;
-    }
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < num_threads; i++) {
-        // Exponentiate ζ to the starting power of the chunk
-        Fr starting_power = zeta.pow(i * thread_size);
-        // Set the chunk size depending ontwhether this is the last thread
-        size_t chunk_size = i != (num_threads - 1) ? thread_size : last_thread_size;
-        size_t j = 0;
-        // Go through elements and compute ζ powers
-        for (; j < chunk_size - 1; j++) {
-            pow_vector[i * thread_size + j] = starting_power;
-            starting_power *= zeta;
-        }
-        pow_vector[i * thread_size + j] = starting_power;
-    }
+    // The chunks need not be of equal size, so every available thread can be used
+    barretenberg::parallel_for_range(
+        vector_size,
+        [&](size_t start, size_t end) {
+            // Exponentiate ζ to the starting power of the chunk
+            Fr starting_power = zeta.pow(start);
+            // Go through elements and compute ζ powers
+            for (size_t j = start; j < end; j++) {
+                pow_vector[j] = starting_power;
+                starting_power *= zeta;
+            }
+        },
+        usefulness_margin);
     return pow_vector;
 }
 
@@ -42,30 +42,15 @@ WASM_EXPORT void join_split__release_key()
 
 WASM_EXPORT uint32_t join_split__get_new_proving_key_data(uint8_t** output)
 {
-// Computing the size of the serialized key is non trivial. We know it's ~331mb.
-// Allocate a buffer large enough to hold it, and abort if we overflow.
-// This is to keep memory usage down.
-#ifdef USE_TURBO
-    size_t total_buf_len = 350 * 1024 * 1024;
-    auto raw_buf = (uint8_t*)malloc(total_buf_len);
-    auto raw_buf_end = raw_buf;
-    write(raw_buf_end, *get_proving_key());
-    *output = raw_buf;
-    auto len = static_cast<uint32_t>(raw_buf_end - raw_buf);
-    if (len > total_buf_len) {
-        info("Buffer overflow serializing proving key.");
-        std::abort();
-    }
-    return len;
-#else
+    // Serialize straight into the returned buffer rather than into a vector that would then be copied.
     auto proving_key = get_proving_key();
-    auto buffer = to_buffer(*proving_key);
-    auto raw_buf = (uint8_t*)malloc(buffer.size());
-    memcpy(raw_buf, (void*)buffer.data(), buffer.size());
+    auto size = plonk::serialized_size(*proving_key);
+    auto raw_buf = (uint8_t*)malloc(size);
+    auto raw_buf_end = raw_buf;
+    write(raw_buf_end, *proving_key);
     *output = raw_buf;
 
-    return static_cast<uint32_t>(buffer.size());
-#endif
+    return static_cast<uint32_t>(size);
 }
 
 WASM_EXPORT void join_split__init_verification_key(void* pippenger, uint8_t const* g2x)
@@ -0,0 +1,121 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace numeric {
+
+/**
+ * Multi-word division, used by the divmod methods of uint256_t and uintx.
+ *
+ * Implements Knuth's Algorithm D (The Art of Computer Programming, vol. 2, 4.3.1) on little endian arrays of 32 bit
+ * digits, so that every step fits in 64 bit arithmetic and the code stays constexpr and portable. Each quotient digit
+ * costs one multiply-and-subtract pass over the divisor, instead of the one shift-and-subtract pass over the whole
+ * dividend per quotient *bit* of the binary long division it replaces.
+ *
+ * `num_digits` is the capacity of every array. `quotient` and `remainder` are fully written (zero padded).
+ * The divisor must be nonzero.
+ */
+template <size_t num_digits>
+constexpr void long_division(const uint32_t (&dividend)[num_digits],
+                             const uint32_t (&divisor)[num_digits],
+                             uint32_t (&quotient)[num_digits],
+                             uint32_t (&remainder)[num_digits])
+{
+    for (size_t i = 0; i < num_digits; ++i) {
+        quotient[i] = 0;
+        remainder[i] = 0;
+    }
+
+    // m: number of significant digits in the dividend, n: in the divisor
+    size_t m = num_digits;
+    while (m > 0 && dividend[m - 1] == 0) {
+        --m;
+    }
+    size_t n = num_digits;
+    while (n > 0 && divisor[n - 1] == 0) {
+        --n;
+    }
+    if (m < n) {
+        for (size_t i = 0; i < m; ++i) {
+            remainder[i] = dividend[i];
+        }
+        return;
+    }
+
+    // Single digit divisors do not need the quotient estimate below.
+    if (n == 1) {
+        const uint64_t d = divisor[0];
+        uint64_t r = 0;
+        for (size_t j = m; j-- > 0;) {
+            const uint64_t numerator = (r << 32) | dividend[j];
+            quotient[j] = static_cast<uint32_t>(numerator / d);
+            r = numerator % d;
+        }
+        remainder[0] = static_cast<uint32_t>(r);
+        return;
+    }
+
+    // D1: normalize, so that the top digit of the divisor has its top bit set. This makes the quotient digit estimate
+    // in D3 at most 2 too large.
+    const unsigned shift = static_cast<unsigned>(__builtin_clz(divisor[n - 1]));
+    uint32_t v[num_digits] = {};
+    uint32_t u[num_digits + 1] = {};
+    for (size_t i = n - 1; i > 0; --i) {
+        v[i] = static_cast<uint32_t>(((uint64_t(divisor[i]) << 32 | divisor[i - 1]) << shift) >> 32);
+    }
+    v[0] = divisor[0] << shift;
+    u[m] = static_cast<uint32_t>(uint64_t(dividend[m - 1]) >> (32 - shift));
+    for (size_t i = m - 1; i > 0; --i) {
+        u[i] = static_cast<uint32_t>(((uint64_t(dividend[i]) << 32 | dividend[i - 1]) << shift) >> 32);
+    }
+    u[0] = dividend[0] << shift;
+
+    constexpr uint64_t base = 1ULL << 32;
+    const uint64_t v_top = v[n - 1];
+    const uint64_t v_next = v[n - 2];
+    for (size_t j = m - n + 1; j-- > 0;) {
+        // D3: estimate the quotient digit from the top two digits of the divisor.
+        const uint64_t numerator = (uint64_t(u[j + n]) << 32) | u[j + n - 1];
+        uint64_t q_hat = numerator / v_top;
+        uint64_t r_hat = numerator % v_top;
+        while (q_hat >= base || q_hat * v_next > ((r_hat << 32) | u[j + n - 2])) {
+            --q_hat;
+            r_hat += v_top;
+            if (r_hat >= base) {
+                break;
+            }
+        }
+
+        // D4: multiply and subtract.
+        int64_t borrow = 0;
+        int64_t t = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const uint64_t product = q_hat * v[i];
+            t = int64_t(u[i + j]) - borrow - int64_t(product & 0xffffffffULL);
+            u[i + j] = static_cast<uint32_t>(t);
+            borrow = int64_t(product >> 32) - (t >> 32);
+        }
+        t = int64_t(u[j + n]) - borrow;
+        u[j + n] = static_cast<uint32_t>(t);
+
+        // D5, D6: the estimate was one too large (rare, probability about 2 / 2^32), so add the divisor back.
+        if (t < 0) {
+            --q_hat;
+            uint64_t carry = 0;
+            for (size_t i = 0; i < n; ++i) {
+                const uint64_t sum = uint64_t(u[i + j]) + v[i] + carry;
+                u[i + j] = static_cast<uint32_t>(sum);
+                carry = sum >> 32;
+            }
+            u[j + n] = static_cast<uint32_t>(uint64_t(u[j + n]) + carry);
+        }
+        quotient[j] = static_cast<uint32_t>(q_hat);
+    }
+
+    // D8: the remainder is the low n digits of u, unnormalized.
+    for (size_t i = 0; i < n; ++i) {
+        remainder[i] = static_cast<uint32_t>(((uint64_t(u[i + 1]) << 32 | u[i]) >> shift));
+    }
+}
+
+} // namespace numeric
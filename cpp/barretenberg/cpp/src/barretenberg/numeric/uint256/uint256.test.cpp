@@ -103,6 +103,33 @@ TEST(uint256, div_and_mod)
     EXPECT_EQ(r, uint256_t(0));
 }
 
+TEST(uint256, div_and_mod_digit_boundaries)
+{
+    const auto check = [](const uint256_t& a, const uint256_t& b) {
+        const auto [q, r] = a.divmod(b);
+        EXPECT_EQ(q * b + r, a);
+        EXPECT_LT(r, b);
+    };
+    // Divisors of every length in 32 bit digits, including ones with many leading or trailing zero bits.
+    for (size_t i = 0; i < 256; ++i) {
+        const uint256_t a = engine.get_random_uint256();
+        const uint256_t b = engine.get_random_uint256() >> (i % 255);
+        check(a, b);
+        check(a, b | 1);
+        check(a >> (i / 2), (b >> 1) << (i % 200));
+    }
+
+    // Cases that need the rarely taken corrections of the quotient digit estimate.
+    check(uint256_t(0, 0x7fffffff80000000ULL, 0, 0), uint256_t(0x1, 0x80000000ULL, 0, 0));
+    check(uint256_t(0xfffffffe00000000ULL, 0x8000000000000000ULL, 0, 0), uint256_t(0xffffffffULL, 0x80000000ULL, 0, 0));
+    check(uint256_t(0, 0, 0xffffffffffffffffULL, 0xffffffffffffffffULL), uint256_t(0, 0xffffffffffffffffULL, 1, 0));
+    check(uint256_t(0, 0, 0, 0x8000000000000000ULL), uint256_t(0xffffffffffffffffULL, 0xffffffffffffffffULL, 0, 0));
+
+    // Division is still usable in constant expressions.
+    static_assert(uint256_t(0, 0, 0, 1) / uint256_t(0, 0, 1, 0) == uint256_t(0, 1, 0, 0));
+    static_assert(uint256_t(7, 0, 0, 1) % uint256_t(0, 0, 1, 0) == uint256_t(7));
+}
+
 TEST(uint256, sub)
 {
     uint256_t a = engine.get_random_uint256();
@@ -1,5 +1,6 @@
 #pragma once
 #include "../bitop/get_msb.hpp"
+#include "./long_division.hpp"
 #include "barretenberg/common/assert.hpp"
 
 namespace numeric {
@@ -78,6 +79,24 @@ constexpr uint64_t uint256_t::mac_discard_hi(const uint64_t a,
     return (b * c + a + carry_in);
 }
 
+namespace detail {
+// Conversions to and from the 32 bit digits that long_division works on.
+constexpr void to_digits(const uint256_t& a, uint32_t* digits)
+{
+    for (size_t i = 0; i < 4; ++i) {
+        digits[2 * i] = static_cast<uint32_t>(a.data[i]);
+        digits[2 * i + 1] = static_cast<uint32_t>(a.data[i] >> 32);
+    }
+}
+
+constexpr void from_digits(const uint32_t* digits, uint256_t& a)
+{
+    for (size_t i = 0; i < 4; ++i) {
+        a.data[i] = uint64_t(digits[2 * i]) | (uint64_t(digits[2 * i + 1]) << 32);
+    }
+}
+} // namespace detail
+
 constexpr std::pair<uint256_t, uint256_t> uint256_t::divmod(const uint256_t& b) const
 {
     if (*this == 0 || b == 0) {
@@ -90,37 +109,23 @@ constexpr std::pair<uint256_t, uint256_t> uint256_t::divmod(const uint256_t& b)
         return { 0, *this };
     }
 
-    uint256_t quotient = 0;
-    uint256_t remainder = *this;
-
-    uint64_t bit_difference = get_msb() - b.get_msb();
-
-    uint256_t divisor = b << bit_difference;
-    uint256_t accumulator = uint256_t(1) << bit_difference;
-
-    // if the divisor is bigger than the remainder, a and b have the same bit length
-    if (divisor > remainder) {
-        divisor >>= 1;
-        accumulator >>= 1;
-    }
-
-    // while the remainder is bigger than our original divisor, we can subtract multiples of b from the remainder,
-    // and add to the quotient
-    while (remainder >= b) {
-
-        // we've shunted 'divisor' up to have the same bit length as our remainder.
-        // If remainder >= divisor, then a is at least '1 << bit_difference' multiples of b
-        if (remainder >= divisor) {
-            remainder -= divisor;
-            // we can use OR here instead of +, as
-            // accumulator is always a nice power of two
-            quotient |= accumulator;
-        }
-        divisor >>= 1;
-        accumulator >>= 1;
+    if ((data[1] | data[2] | data[3]) == 0) {
+        return { data[0] / b.data[0], data[0] % b.data[0] };
     }
 
-    return { quotient, remainder };
+    uint32_t dividend[8] = {};
+    uint32_t divisor[8] = {};
+    uint32_t quotient[8] = {};
+    uint32_t remainder[8] = {};
+    detail::to_digits(*this, dividend);
+    detail::to_digits(b, divisor);
+    long_division(dividend, divisor, quotient, remainder);
+
+    uint256_t q;
+    uint256_t r;
+    detail::from_digits(quotient, q);
+    detail::from_digits(remainder, r);
+    return { q, r };
 }
 
 constexpr std::pair<uint256_t, uint256_t> uint256_t::mul_extended(const uint256_t& other) const
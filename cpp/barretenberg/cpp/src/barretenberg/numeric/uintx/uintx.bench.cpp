@@ -0,0 +1,43 @@
+#include "../random/engine.hpp"
+#include "./uintx.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+} // namespace
+
+// Shapes that bigfield witness generation divides by: a full width numerator over a modulus half its width.
+void uint256_divmod(State& state) noexcept
+{
+    const uint256_t a = engine.get_random_uint256();
+    const uint256_t b = engine.get_random_uint256() >> 128;
+    for (auto _ : state) {
+        auto r = a.divmod(b);
+        DoNotOptimize(r);
+    }
+}
+BENCHMARK(uint256_divmod);
+
+void uint512_divmod(State& state) noexcept
+{
+    const uint512_t a = engine.get_random_uint512();
+    const uint512_t b = uint512_t(engine.get_random_uint256());
+    for (auto _ : state) {
+        auto r = a.divmod(b);
+        DoNotOptimize(r);
+    }
+}
+BENCHMARK(uint512_divmod);
+
+void uint1024_divmod(State& state) noexcept
+{
+    const uint1024_t a = engine.get_random_uint1024();
+    const uint1024_t b = uint1024_t(engine.get_random_uint512());
+    for (auto _ : state) {
+        auto r = a.divmod(b);
+        DoNotOptimize(r);
+    }
+}
+BENCHMARK(uint1024_divmod);
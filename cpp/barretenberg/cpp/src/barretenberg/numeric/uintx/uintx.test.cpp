@@ -63,6 +63,23 @@ TEST(uintx, div_and_mod)
     EXPECT_EQ(r, uint1024_t(0));
 }
 
+TEST(uintx, div_and_mod_varying_widths)
+{
+    for (size_t i = 0; i < 256; ++i) {
+        const uint1024_t a = engine.get_random_uint1024() >> ((i % 7) * 64);
+        const uint1024_t b = engine.get_random_uint1024() >> (i * 4 % 1023);
+        const auto [q, r] = a.divmod(b);
+        EXPECT_EQ(q * b + r, a);
+        EXPECT_LT(r, b);
+
+        const uint512_t c = engine.get_random_uint512();
+        const uint512_t d = engine.get_random_uint512() >> (i * 2 % 511);
+        const auto [q_512, r_512] = c.divmod(d);
+        EXPECT_EQ(q_512 * d + r_512, c);
+        EXPECT_LT(r_512, d);
+    }
+}
+
 // We should not be depending on ecc in numeric.
 TEST(uintx, DISABLED_mulmod)
 {
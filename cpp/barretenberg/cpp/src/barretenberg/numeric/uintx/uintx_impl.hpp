@@ -1,6 +1,20 @@
 #pragma once
 #include "barretenberg/common/assert.hpp"
 
+namespace detail {
+template <class base_uint> constexpr void to_digits(const uintx<base_uint>& a, uint32_t* digits)
+{
+    to_digits(a.lo, digits);
+    to_digits(a.hi, digits + base_uint::length() / 32);
+}
+
+template <class base_uint> constexpr void from_digits(const uint32_t* digits, uintx<base_uint>& a)
+{
+    from_digits(digits, a.lo);
+    from_digits(digits + base_uint::length() / 32, a.hi);
+}
+} // namespace detail
+
 template <class base_uint>
 constexpr std::pair<uintx<base_uint>, uintx<base_uint>> uintx<base_uint>::divmod(const uintx& b) const
 {
@@ -15,36 +29,19 @@ constexpr std::pair<uintx<base_uint>, uintx<base_uint>> uintx<base_uint>::divmod
         return { uintx(0), *this };
     }
 
-    uintx quotient(0);
-    uintx remainder = *this;
-
-    uint64_t bit_difference = get_msb() - b.get_msb();
-
-    uintx divisor = b << bit_difference;
-    uintx accumulator = uintx(1) << bit_difference;
-
-    // if the divisor is bigger than the remainder, a and b have the same bit length
-    if (divisor > remainder) {
-        divisor >>= 1;
-        accumulator >>= 1;
-    }
-
-    // while the remainder is bigger than our original divisor, we can subtract multiples of b from the remainder,
-    // and add to the quotient
-    while (remainder >= b) {
-
-        // we've shunted 'divisor' up to have the same bit length as our remainder.
-        // If remainder >= divisor, then a is at least '1 << bit_difference' multiples of b
-        if (remainder >= divisor) {
-            remainder -= divisor;
-            // we can use OR here instead of +, as
-            // accumulator is always a nice power of two
-            quotient |= accumulator;
-        }
-        divisor >>= 1;
-        accumulator >>= 1;
-    }
-
+    constexpr size_t num_digits = length() / 32;
+    uint32_t dividend[num_digits] = {};
+    uint32_t divisor[num_digits] = {};
+    uint32_t quotient_digits[num_digits] = {};
+    uint32_t remainder_digits[num_digits] = {};
+    detail::to_digits(*this, dividend);
+    detail::to_digits(b, divisor);
+    long_division(dividend, divisor, quotient_digits, remainder_digits);
+
+    uintx quotient;
+    uintx remainder;
+    detail::from_digits(quotient_digits, quotient);
+    detail::from_digits(remainder_digits, remainder);
     return std::make_pair(quotient, remainder);
 }
 
@@ -1,9 +1,117 @@
 #include "composer_base.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/plonk/proof_system/utils/permutation.hpp"
+#include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
 namespace proof_system::plonk {
 
+namespace {
+
+/**
+ * The most rows a cached polynomial may differ in and still be updated in place: each changed row costs about 6n field
+ * multiplications, against roughly (n/2).log(n) + 2n.log(4n) for an ifft and a coset fft.
+ */
+size_t max_rows_to_update(const barretenberg::evaluation_domain& small_domain,
+                          const barretenberg::evaluation_domain& large_domain)
+{
+    return (small_domain.log2_size / 2 + 2 * large_domain.log2_size) / 6;
+}
+
+enum class CachedForm { UNUSABLE, REUSED, UPDATED };
+
+/**
+ * Compute the coefficient and coset FFT forms of `lagrange_form` from those of the same polynomial in `cached_key`,
+ * unless they differ in too many rows for that to be worth it.
+ */
+CachedForm update_from_cached_key(proving_key* key,
+                                  proving_key& cached_key,
+                                  const size_t num_public_inputs,
+                                  std::string const& label,
+                                  const barretenberg::polynomial& lagrange_form,
+                                  const size_t coset_size,
+                                  barretenberg::polynomial& monomial_form,
+                                  barretenberg::polynomial& coset_form)
+{
+    auto& cached_store = cached_key.polynomial_store;
+    if (cached_key.composer_type != key->composer_type || cached_key.circuit_size != key->circuit_size ||
+        !cached_store.contains(label) || !cached_store.contains(label + "_fft") ||
+        cached_store.get(label + "_fft").size() != coset_size) {
+        return CachedForm::UNUSABLE;
+    }
+    const size_t n = key->circuit_size;
+
+    // Not every key keeps the Lagrange form, but one fft of the coefficients recovers it.
+    barretenberg::polynomial recovered_lagrange_form;
+    const barretenberg::polynomial* cached_lagrange_form = &recovered_lagrange_form;
+    if (cached_store.contains(label + "_lagrange")) {
+        cached_lagrange_form = &cached_store.get(label + "_lagrange");
+    } else {
+        recovered_lagrange_form = barretenberg::polynomial(cached_store.get(label), n);
+        recovered_lagrange_form.fft(key->small_domain);
+    }
+
+    // Compare against the cached values as they are, and as they would be if every row moved by the change in the
+    // number of public inputs. Moving a row also multiplies a permutation polynomial's value there by ω^shift.
+    struct Alignment {
+        size_t shift;
+        barretenberg::fr scale;
+    };
+    std::vector<Alignment> alignments{ { 0, barretenberg::fr::one() } };
+    if (num_public_inputs != cached_key.num_public_inputs) {
+        const size_t shift = (num_public_inputs + n - cached_key.num_public_inputs % n) % n;
+        alignments.push_back({ shift, barretenberg::fr::one() });
+        alignments.push_back({ shift, key->small_domain.root.pow(static_cast<uint64_t>(shift)) });
+    }
+
+    const size_t max_rows = max_rows_to_update(key->small_domain, key->large_domain);
+    const Alignment* best = nullptr;
+    std::vector<size_t> rows;
+    std::vector<barretenberg::fr> deltas;
+    for (const auto& alignment : alignments) {
+        std::vector<size_t> candidate_rows;
+        std::vector<barretenberg::fr> candidate_deltas;
+        for (size_t i = 0; i < n && candidate_rows.size() <= max_rows; ++i) {
+            const barretenberg::fr expected = (*cached_lagrange_form)[(i + n - alignment.shift) % n] * alignment.scale;
+            if (lagrange_form[i] != expected) {
+                candidate_rows.push_back(i);
+                candidate_deltas.push_back(lagrange_form[i] - expected);
+            }
+        }
+        if (candidate_rows.size() <= max_rows && (best == nullptr || candidate_rows.size() < rows.size())) {
+            best = &alignment;
+            rows = std::move(candidate_rows);
+            deltas = std::move(candidate_deltas);
+        }
+    }
+    if (best == nullptr) {
+        return CachedForm::UNUSABLE;
+    }
+
+    monomial_form = barretenberg::polynomial(cached_store.get(label), n);
+    coset_form = barretenberg::polynomial(cached_store.get(label + "_fft"), coset_size);
+    if (best->shift != 0) {
+        barretenberg::polynomial_arithmetic::rotate_lagrange_values(
+            monomial_form.data(), coset_form.data(), best->shift, best->scale, key->small_domain, key->large_domain);
+    }
+    if (!rows.empty() && !key->polynomial_store.contains("lagrange_1_fft")) {
+        // The prover needs L_1 on the coset too, so it is kept in the key.
+        key->polynomial_store.put("lagrange_1_fft", key->compute_lagrange_1_fft());
+    }
+    for (size_t i = 0; i < rows.size(); ++i) {
+        barretenberg::polynomial_arithmetic::add_lagrange_basis_multiple(
+            monomial_form.data(),
+            coset_form.data(),
+            key->polynomial_store.get("lagrange_1_fft").data(),
+            rows[i],
+            deltas[i],
+            key->small_domain,
+            key->large_domain);
+    }
+    return best->shift == 0 && rows.empty() ? CachedForm::REUSED : CachedForm::UPDATED;
+}
+
+} // namespace
+
 /**
  * Join variable class b to variable class a.
  *
@@ -177,42 +285,21 @@ template <size_t program_width, bool with_tags> void ComposerBase::compute_sigma
 
     for (size_t i = 0; i < program_width; ++i) {
 
-        // Construct permutation polynomials in lagrange base
+        // Construct permutation polynomials in lagrange base, then their monomial and coset FFT forms
         std::string index = std::to_string(i + 1);
         barretenberg::polynomial sigma_polynomial_lagrange(key->circuit_size);
         compute_permutation_lagrange_base_single<standard_settings>(
             sigma_polynomial_lagrange, sigma_mappings[i], key->small_domain);
-
-        // Compute permutation polynomial monomial form
-        barretenberg::polynomial sigma_polynomial(key->circuit_size);
-        barretenberg::polynomial_arithmetic::ifft(
-            &sigma_polynomial_lagrange[0], &sigma_polynomial[0], key->small_domain);
-
-        // Compute permutation polynomial coset FFT form
-        barretenberg::polynomial sigma_fft(sigma_polynomial, key->large_domain.size);
-        sigma_fft.coset_fft(key->large_domain);
-
-        key->polynomial_store.put("sigma_" + index + "_lagrange", std::move(sigma_polynomial_lagrange));
-        key->polynomial_store.put("sigma_" + index, std::move(sigma_polynomial));
-        key->polynomial_store.put("sigma_" + index + "_fft", std::move(sigma_fft));
+        put_precomputed_polynomial(
+            key, "sigma_" + index, std::move(sigma_polynomial_lagrange), key->large_domain.size, true);
 
         if (with_tags) {
-            // Construct id polynomials in lagrange base
+            // Construct id polynomials in lagrange base, then their monomial and coset FFT forms
             barretenberg::polynomial id_polynomial_lagrange(key->circuit_size);
             compute_permutation_lagrange_base_single<standard_settings>(
                 id_polynomial_lagrange, id_mappings[i], key->small_domain);
-
-            // Compute id polynomial monomial form
-            barretenberg::polynomial id_polynomial(key->circuit_size);
-            barretenberg::polynomial_arithmetic::ifft(&id_polynomial_lagrange[0], &id_polynomial[0], key->small_domain);
-
-            // Compute id polynomial coset FFT form
-            barretenberg::polynomial id_fft(id_polynomial, key->large_domain.size);
-            id_fft.coset_fft(key->large_domain);
-
-            key->polynomial_store.put("id_" + index + "_lagrange", std::move(id_polynomial_lagrange));
-            key->polynomial_store.put("id_" + index, std::move(id_polynomial));
-            key->polynomial_store.put("id_" + index + "_fft", std::move(id_fft));
+            put_precomputed_polynomial(
+                key, "id_" + index, std::move(id_polynomial_lagrange), key->large_domain.size, true);
         }
     }
 }
@@ -252,6 +339,7 @@ std::shared_ptr<proving_key> ComposerBase::compute_proving_key_base(const Compos
 
     // Initialize circuit_proving_key
     circuit_proving_key = std::make_shared<proving_key>(subgroup_size, public_inputs.size(), crs, composer_type);
+    cached_key_stats = {};
 
     for (size_t i = 0; i < num_selectors; ++i) {
         std::vector<barretenberg::fr>& selector_values = selectors[i];
@@ -287,22 +375,52 @@ std::shared_ptr<proving_key> ComposerBase::compute_proving_key_base(const Compos
             selector_poly_lagrange[k] = selector_values[k - public_inputs.size()];
         }
 
-        // Compute monomial form of selector polynomial
-        polynomial selector_poly(subgroup_size);
-        polynomial_arithmetic::ifft(&selector_poly_lagrange[0], &selector_poly[0], circuit_proving_key->small_domain);
+        // Compute monomial form and coset FFT of selector polynomial
+        put_precomputed_polynomial(circuit_proving_key.get(),
+                                   properties.name,
+                                   std::move(selector_poly_lagrange),
+                                   subgroup_size * 4 + 4,
+                                   properties.requires_lagrange_base_polynomial);
+    }
 
-        // Compute coset FFT of selector polynomial
-        polynomial selector_poly_fft(selector_poly, subgroup_size * 4 + 4);
-        selector_poly_fft.coset_fft(circuit_proving_key->large_domain);
+    return circuit_proving_key;
+}
 
-        if (properties.requires_lagrange_base_polynomial) {
-            circuit_proving_key->polynomial_store.put(properties.name + "_lagrange", std::move(selector_poly_lagrange));
-        }
-        circuit_proving_key->polynomial_store.put(properties.name, std::move(selector_poly));
-        circuit_proving_key->polynomial_store.put(properties.name + "_fft", std::move(selector_poly_fft));
+void ComposerBase::put_precomputed_polynomial(proving_key* key,
+                                              std::string const& label,
+                                              barretenberg::polynomial&& lagrange_form,
+                                              const size_t coset_size,
+                                              const bool keep_lagrange_form)
+{
+    barretenberg::polynomial monomial_form;
+    barretenberg::polynomial coset_form;
+    const CachedForm cached_form =
+        cached_proving_key ? update_from_cached_key(key,
+                                                    *cached_proving_key,
+                                                    public_inputs.size(),
+                                                    label,
+                                                    lagrange_form,
+                                                    coset_size,
+                                                    monomial_form,
+                                                    coset_form)
+                           : CachedForm::UNUSABLE;
+    if (cached_form == CachedForm::REUSED) {
+        ++cached_key_stats.reused;
+    } else if (cached_form == CachedForm::UPDATED) {
+        ++cached_key_stats.updated;
+    } else {
+        monomial_form = barretenberg::polynomial(key->circuit_size);
+        barretenberg::polynomial_arithmetic::ifft(&lagrange_form[0], &monomial_form[0], key->small_domain);
+        coset_form = barretenberg::polynomial(monomial_form, coset_size);
+        coset_form.coset_fft(key->large_domain);
+        ++cached_key_stats.recomputed;
     }
 
-    return circuit_proving_key;
+    if (keep_lagrange_form) {
+        key->polynomial_store.put(label + "_lagrange", std::move(lagrange_form));
+    }
+    key->polynomial_store.put(label, std::move(monomial_form));
+    key->polynomial_store.put(label + "_fft", std::move(coset_form));
 }
 
 /**
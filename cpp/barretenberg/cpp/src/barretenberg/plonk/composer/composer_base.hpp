@@ -263,6 +263,27 @@ class ComposerBase {
     template <size_t program_width> void compute_wire_copy_cycles();
     template <size_t program_width, bool with_tags = false> void compute_sigma_permutations(proving_key* key);
 
+    /**
+     * @brief Build the next proving key from `key`, a key computed earlier for a previous version of this circuit.
+     *
+     * @details compute_proving_key() still builds every Lagrange form, but compares each with the cached key's: an
+     * unchanged polynomial reuses the cached coefficient and coset FFT forms, one that differs in a few rows has the
+     * difference applied to them directly, and only the rest pay for an ifft and a coset fft. A change in the number of
+     * public inputs moves every gate by the same number of rows, which is applied as a rotation. The cached key is
+     * ignored unless its composer type and circuit size match the new circuit's.
+     */
+    void set_cached_proving_key(std::shared_ptr<proving_key> const& key) { cached_proving_key = key; }
+
+    /**
+     * @brief Put the coefficient form (under `label`), coset FFT form (`label_fft`) and optionally the Lagrange form
+     * (`label_lagrange`) of a precomputed polynomial into `key`, reusing the cached proving key where possible.
+     */
+    void put_precomputed_polynomial(proving_key* key,
+                                    std::string const& label,
+                                    barretenberg::polynomial&& lagrange_form,
+                                    size_t coset_size,
+                                    bool keep_lagrange_form);
+
     size_t get_circuit_subgroup_size(const size_t num_gates)
     {
         size_t log2_n = static_cast<size_t>(numeric::get_msb(num_gates));
@@ -314,6 +335,14 @@ class ComposerBase {
     std::shared_ptr<proving_key> circuit_proving_key;
     std::shared_ptr<verification_key> circuit_verification_key;
 
+    std::shared_ptr<proving_key> cached_proving_key;
+    // How put_precomputed_polynomial obtained each polynomial of the last key computed.
+    struct CachedKeyStats {
+        size_t reused = 0;
+        size_t updated = 0;
+        size_t recomputed = 0;
+    } cached_key_stats;
+
     bool computed_witness = false;
 
     std::shared_ptr<ReferenceStringFactory> crs_factory_;
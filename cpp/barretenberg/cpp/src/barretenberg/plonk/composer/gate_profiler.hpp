@@ -0,0 +1,202 @@
+#pragma once
+#include <map>
+#include <string>
+#include <vector>
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/proof_system/types/composer_type.hpp"
+
+namespace proof_system::plonk {
+
+/**
+ * @brief Attributes the gates of a circuit to named, nested scopes.
+ *
+ * @details While a GateProfiler is alive, every GateProfiler<Composer>::Scope opened on its composer records what was
+ * added to the circuit between the scope's construction and destruction: gates, lookup gates, range-list entries and
+ * ROM/RAM records (the last three only exist on UltraComposer; ROM/RAM records and range lists turn into extra gates
+ * when the circuit is finalised, which is why they are counted separately).
+ *
+ * Scopes nest: a scope named "pedersen" opened inside a scope named "kernel" is recorded as "kernel/pedersen", and its
+ * counts are also part of the counts of "kernel". A scope opened on a composer that has no profiler does nothing, so
+ * gadgets can be annotated unconditionally:
+ *
+ *     GateProfiler<Composer> profiler(composer);
+ *     {
+ *         GateProfiler<Composer>::Scope scope(&composer, "kernel");
+ *         ...
+ *     }
+ *     profiler.print();
+ *
+ * A scope that found a profiler keeps a pointer to it and to its composer, so it must be destroyed before both; the
+ * profiler asserts on destruction that none of its scopes is still open.
+ */
+template <typename Composer> class GateProfiler {
+  public:
+    struct Counts {
+        size_t gates = 0;
+        size_t lookup_gates = 0;
+        size_t range_list_entries = 0;
+        size_t rom_records = 0;
+        size_t ram_records = 0;
+
+        Counts& operator+=(const Counts& other)
+        {
+            gates += other.gates;
+            lookup_gates += other.lookup_gates;
+            range_list_entries += other.range_list_entries;
+            rom_records += other.rom_records;
+            ram_records += other.ram_records;
+            return *this;
+        }
+
+        Counts operator-(const Counts& other) const
+        {
+            return { gates - other.gates,
+                     lookup_gates - other.lookup_gates,
+                     range_list_entries - other.range_list_entries,
+                     rom_records - other.rom_records,
+                     ram_records - other.ram_records };
+        }
+
+        bool operator==(const Counts& other) const = default;
+    };
+
+    struct ScopeCounts {
+        size_t calls = 0;
+        Counts counts;
+    };
+
+    class Scope {
+      public:
+        Scope(Composer* composer, const std::string& name)
+        {
+            if (composer == nullptr) {
+                return;
+            }
+            const auto it = active_profilers().find(composer);
+            if (it == active_profilers().end()) {
+                return;
+            }
+            profiler = it->second;
+            profiler->open_scope(name);
+            start = count(*composer);
+        }
+
+        ~Scope()
+        {
+            if (profiler != nullptr) {
+                profiler->close_scope(count(profiler->composer) - start);
+            }
+        }
+
+        Scope(const Scope& other) = delete;
+        Scope& operator=(const Scope& other) = delete;
+
+      private:
+        GateProfiler* profiler = nullptr;
+        Counts start;
+    };
+
+    explicit GateProfiler(Composer& composer)
+        : composer(composer)
+    {
+        ASSERT(!active_profilers().contains(&composer));
+        active_profilers()[&composer] = this;
+    }
+
+    ~GateProfiler()
+    {
+        ASSERT(path.empty());
+        active_profilers().erase(&composer);
+    }
+
+    GateProfiler(const GateProfiler& other) = delete;
+    GateProfiler& operator=(const GateProfiler& other) = delete;
+
+    /**
+     * @brief What the circuit of `composer` currently contains
+     */
+    static Counts count(const Composer& composer)
+    {
+        Counts counts;
+        if constexpr (Composer::type == ComposerType::PLOOKUP) {
+            counts.gates = composer.num_gates;
+            for (const auto& table : composer.lookup_tables) {
+                counts.lookup_gates += table.lookup_gates.size();
+            }
+            for (const auto& [target_range, range_list] : composer.range_lists) {
+                counts.range_list_entries += range_list.variable_indices.size();
+            }
+            for (const auto& rom_array : composer.rom_arrays) {
+                counts.rom_records += rom_array.records.size();
+            }
+            for (const auto& ram_array : composer.ram_arrays) {
+                counts.ram_records += ram_array.records.size();
+            }
+        } else {
+            counts.gates = composer.get_num_gates();
+        }
+        return counts;
+    }
+
+    /**
+     * @brief Counts per scope path, e.g. "kernel" and "kernel/pedersen"
+     */
+    const std::map<std::string, ScopeCounts>& breakdown() const { return scopes; }
+
+    void print() const
+    {
+        const Counts total = count(composer);
+        info("gate profile: ",
+             total.gates,
+             " gates, ",
+             total.lookup_gates,
+             " lookup gates, ",
+             total.range_list_entries,
+             " range list entries, ",
+             total.rom_records,
+             " ROM records, ",
+             total.ram_records,
+             " RAM records");
+        for (const auto& [path, scope] : scopes) {
+            info("  ",
+                 path,
+                 " (",
+                 scope.calls,
+                 " calls): ",
+                 scope.counts.gates,
+                 " gates, ",
+                 scope.counts.lookup_gates,
+                 " lookup gates, ",
+                 scope.counts.range_list_entries,
+                 " range list entries, ",
+                 scope.counts.rom_records,
+                 " ROM records, ",
+                 scope.counts.ram_records,
+                 " RAM records");
+        }
+    }
+
+  private:
+    static std::map<const Composer*, GateProfiler*>& active_profilers()
+    {
+        static thread_local std::map<const Composer*, GateProfiler*> profilers;
+        return profilers;
+    }
+
+    void open_scope(const std::string& name) { path.push_back(path.empty() ? name : path.back() + "/" + name); }
+
+    void close_scope(const Counts& counts)
+    {
+        auto& scope = scopes[path.back()];
+        scope.calls++;
+        scope.counts += counts;
+        path.pop_back();
+    }
+
+    Composer& composer;
+    std::vector<std::string> path;
+    std::map<std::string, ScopeCounts> scopes;
+};
+
+} // namespace proof_system::plonk
@@ -0,0 +1,93 @@
+#include "gate_profiler.hpp"
+#include "standard_composer.hpp"
+#include "ultra_composer.hpp"
+#include <gtest/gtest.h>
+
+using namespace barretenberg;
+
+namespace proof_system::plonk {
+
+namespace {
+
+void add_arithmetic_gate(auto& composer)
+{
+    const auto a = composer.add_variable(fr(1));
+    const auto b = composer.add_variable(fr(2));
+    const auto c = composer.add_variable(fr(3));
+    composer.create_add_gate({ a, b, c, fr(1), fr(1), fr(-1), fr(0) });
+}
+
+} // namespace
+
+TEST(gate_profiler, ultra_nested_scopes)
+{
+    using Profiler = GateProfiler<UltraComposer>;
+    UltraComposer composer = UltraComposer();
+    Profiler profiler(composer);
+
+    const auto start = Profiler::count(composer);
+    {
+        Profiler::Scope outer(&composer, "outer");
+        add_arithmetic_gate(composer);
+        {
+            Profiler::Scope range(&composer, "range");
+            composer.create_new_range_constraint(composer.add_variable(fr(5)), 8);
+            composer.create_new_range_constraint(composer.add_variable(fr(6)), 8);
+        }
+        for (size_t i = 0; i < 2; ++i) {
+            Profiler::Scope rom(&composer, "rom");
+            const size_t rom_id = composer.create_ROM_array(2);
+            composer.set_ROM_element(rom_id, 0, composer.add_variable(fr(7)));
+            composer.set_ROM_element(rom_id, 1, composer.add_variable(fr(8)));
+            composer.read_ROM_array(rom_id, composer.add_variable(fr(1)));
+        }
+    }
+    const auto end = Profiler::count(composer);
+
+    const auto& breakdown = profiler.breakdown();
+    ASSERT_EQ(breakdown.size(), 3UL);
+
+    const auto& outer = breakdown.at("outer");
+    EXPECT_EQ(outer.calls, 1UL);
+    EXPECT_EQ(outer.counts, end - start);
+
+    const auto& range = breakdown.at("outer/range");
+    EXPECT_EQ(range.calls, 1UL);
+    // the range list for 8 was created in this scope, including its entries for the steps 0, 3, 6 and 8
+    EXPECT_EQ(range.counts.range_list_entries, composer.range_lists.at(8).variable_indices.size());
+    EXPECT_GT(range.counts.range_list_entries, 2UL);
+    EXPECT_EQ(range.counts.rom_records, 0UL);
+
+    const auto& rom = breakdown.at("outer/rom");
+    EXPECT_EQ(rom.calls, 2UL);
+    EXPECT_EQ(rom.counts.rom_records, 2 * composer.rom_arrays[0].records.size());
+    EXPECT_EQ(rom.counts.range_list_entries, 0UL);
+
+    // the arithmetic gate is only attributed to the outer scope
+    EXPECT_EQ(outer.counts.gates, range.counts.gates + rom.counts.gates + 1);
+}
+
+TEST(gate_profiler, scopes_without_profiler_are_ignored)
+{
+    StandardComposer profiled = StandardComposer();
+    StandardComposer unprofiled = StandardComposer();
+    GateProfiler<StandardComposer> profiler(profiled);
+    {
+        GateProfiler<StandardComposer>::Scope scope(&unprofiled, "unprofiled");
+        add_arithmetic_gate(unprofiled);
+    }
+    {
+        GateProfiler<StandardComposer>::Scope scope(nullptr, "constant");
+    }
+    EXPECT_TRUE(profiler.breakdown().empty());
+
+    {
+        GateProfiler<StandardComposer>::Scope scope(&profiled, "profiled");
+        add_arithmetic_gate(profiled);
+        add_arithmetic_gate(profiled);
+    }
+    ASSERT_EQ(profiler.breakdown().size(), 1UL);
+    EXPECT_EQ(profiler.breakdown().at("profiled").counts.gates, 2UL);
+}
+
+} // namespace proof_system::plonk
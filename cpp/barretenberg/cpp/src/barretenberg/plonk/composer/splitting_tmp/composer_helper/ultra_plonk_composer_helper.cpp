@@ -5,6 +5,7 @@
 #include "barretenberg/proof_system/circuit_constructors/ultra_circuit_constructor.hpp"
 #include "barretenberg/proof_system/composer/permutation_helper.hpp"
 #include "barretenberg/plonk/proof_system/commitment_scheme/kate_commitment_scheme.hpp"
+#include "barretenberg/plonk/proof_system/widgets/transition_widgets/fused_transition_widgets.hpp"
 
 #include <cstddef>
 #include <cstdint>
@@ -157,25 +158,13 @@ UltraProver UltraPlonkComposerHelper<CircuitConstructor>::create_prover(CircuitC
     std::unique_ptr<ProverPlookupWidget<>> plookup_widget =
         std::make_unique<ProverPlookupWidget<>>(circuit_proving_key.get());
 
-    std::unique_ptr<ProverPlookupArithmeticWidget<ultra_settings>> arithmetic_widget =
-        std::make_unique<ProverPlookupArithmeticWidget<ultra_settings>>(circuit_proving_key.get());
-
-    std::unique_ptr<ProverGenPermSortWidget<ultra_settings>> sort_widget =
-        std::make_unique<ProverGenPermSortWidget<ultra_settings>>(circuit_proving_key.get());
-
-    std::unique_ptr<ProverEllipticWidget<ultra_settings>> elliptic_widget =
-        std::make_unique<ProverEllipticWidget<ultra_settings>>(circuit_proving_key.get());
-
-    std::unique_ptr<ProverPlookupAuxiliaryWidget<ultra_settings>> auxiliary_widget =
-        std::make_unique<ProverPlookupAuxiliaryWidget<ultra_settings>>(circuit_proving_key.get());
+    std::unique_ptr<ProverUltraTransitionWidget<ultra_settings>> transition_widget =
+        std::make_unique<ProverUltraTransitionWidget<ultra_settings>>(circuit_proving_key.get());
 
     output_state.random_widgets.emplace_back(std::move(permutation_widget));
     output_state.random_widgets.emplace_back(std::move(plookup_widget));
 
-    output_state.transition_widgets.emplace_back(std::move(arithmetic_widget));
-    output_state.transition_widgets.emplace_back(std::move(sort_widget));
-    output_state.transition_widgets.emplace_back(std::move(elliptic_widget));
-    output_state.transition_widgets.emplace_back(std::move(auxiliary_widget));
+    output_state.transition_widgets.emplace_back(std::move(transition_widget));
 
     std::unique_ptr<KateCommitmentScheme<ultra_settings>> kate_commitment_scheme =
         std::make_unique<KateCommitmentScheme<ultra_settings>>();
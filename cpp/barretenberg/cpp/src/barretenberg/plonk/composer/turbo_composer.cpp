@@ -6,6 +6,7 @@
 #include "barretenberg/plonk/proof_system/widgets/transition_widgets/fixed_base_widget.hpp"
 #include "barretenberg/plonk/proof_system/widgets/transition_widgets/turbo_logic_widget.hpp"
 #include "barretenberg/plonk/proof_system/widgets/transition_widgets/turbo_range_widget.hpp"
+#include "barretenberg/plonk/proof_system/widgets/transition_widgets/fused_transition_widgets.hpp"
 #include "barretenberg/plonk/proof_system/commitment_scheme/kate_commitment_scheme.hpp"
 #include "../proof_system/widgets/transition_widgets/transition_widget.hpp"
 #include "../proof_system/widgets/transition_widgets/turbo_arithmetic_widget.hpp"
@@ -1001,22 +1002,12 @@ TurboProver TurboComposer::create_prover()
     std::unique_ptr<ProverPermutationWidget<4, false>> permutation_widget =
         std::make_unique<ProverPermutationWidget<4, false>>(circuit_proving_key.get());
 
-    std::unique_ptr<ProverTurboRangeWidget<turbo_settings>> range_widget =
-        std::make_unique<ProverTurboRangeWidget<turbo_settings>>(circuit_proving_key.get());
-    std::unique_ptr<ProverTurboLogicWidget<turbo_settings>> logic_widget =
-        std::make_unique<ProverTurboLogicWidget<turbo_settings>>(circuit_proving_key.get());
-
-    std::unique_ptr<ProverTurboArithmeticWidget<turbo_settings>> arithmetic_widget =
-        std::make_unique<ProverTurboArithmeticWidget<turbo_settings>>(circuit_proving_key.get());
-    std::unique_ptr<ProverTurboFixedBaseWidget<turbo_settings>> fixed_base_widget =
-        std::make_unique<ProverTurboFixedBaseWidget<turbo_settings>>(circuit_proving_key.get());
+    std::unique_ptr<ProverTurboTransitionWidget<turbo_settings>> transition_widget =
+        std::make_unique<ProverTurboTransitionWidget<turbo_settings>>(circuit_proving_key.get());
 
     output_state.random_widgets.emplace_back(std::move(permutation_widget));
 
-    output_state.transition_widgets.emplace_back(std::move(arithmetic_widget));
-    output_state.transition_widgets.emplace_back(std::move(fixed_base_widget));
-    output_state.transition_widgets.emplace_back(std::move(range_widget));
-    output_state.transition_widgets.emplace_back(std::move(logic_widget));
+    output_state.transition_widgets.emplace_back(std::move(transition_widget));
 
     std::unique_ptr<KateCommitmentScheme<turbo_settings>> kate_commitment_scheme =
         std::make_unique<KateCommitmentScheme<turbo_settings>>();
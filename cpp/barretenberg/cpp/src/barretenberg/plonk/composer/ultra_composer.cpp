@@ -2,6 +2,8 @@
 
 #include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/common/counting_sort.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include <algorithm>
 #include <optional>
 #include "barretenberg/plonk/proof_system/widgets/transition_widgets/plookup_arithmetic_widget.hpp"
@@ -9,6 +11,7 @@
 #include "barretenberg/plonk/proof_system/widgets/transition_widgets/genperm_sort_widget.hpp"
 #include "barretenberg/plonk/proof_system/widgets/transition_widgets/elliptic_widget.hpp"
 #include "barretenberg/plonk/proof_system/widgets/transition_widgets/plookup_auxiliary_widget.hpp"
+#include "barretenberg/plonk/proof_system/widgets/transition_widgets/fused_transition_widgets.hpp"
 #include "barretenberg/plonk/proof_system/widgets/random_widgets/permutation_widget.hpp"
 #include "barretenberg/plonk/proof_system/widgets/random_widgets/plookup_widget.hpp"
 #include "barretenberg/plonk/proof_system/commitment_scheme/kate_commitment_scheme.hpp"
@@ -489,17 +492,11 @@ uint32_t UltraComposer::put_constant_variable(const barretenberg::fr& variable)
 void UltraComposer::add_table_column_selector_poly_to_proving_key(polynomial& selector_poly_lagrange_form,
                                                                   const std::string& tag)
 {
-    polynomial selector_poly_lagrange_form_copy(selector_poly_lagrange_form, circuit_proving_key->small_domain.size);
-
-    selector_poly_lagrange_form.ifft(circuit_proving_key->small_domain);
-    auto& selector_poly_coeff_form = selector_poly_lagrange_form;
-
-    polynomial selector_poly_coset_form(selector_poly_coeff_form, circuit_proving_key->circuit_size * 4);
-    selector_poly_coset_form.coset_fft(circuit_proving_key->large_domain);
-
-    circuit_proving_key->polynomial_store.put(tag, std::move(selector_poly_coeff_form));
-    circuit_proving_key->polynomial_store.put(tag + "_lagrange", std::move(selector_poly_lagrange_form_copy));
-    circuit_proving_key->polynomial_store.put(tag + "_fft", std::move(selector_poly_coset_form));
+    put_precomputed_polynomial(circuit_proving_key.get(),
+                               tag,
+                               std::move(selector_poly_lagrange_form),
+                               circuit_proving_key->circuit_size * 4,
+                               true);
 }
 
 std::shared_ptr<proving_key> UltraComposer::compute_proving_key()
@@ -818,25 +815,13 @@ UltraProver UltraComposer::create_prover()
     std::unique_ptr<ProverPlookupWidget<>> plookup_widget =
         std::make_unique<ProverPlookupWidget<>>(circuit_proving_key.get());
 
-    std::unique_ptr<ProverPlookupArithmeticWidget<ultra_settings>> arithmetic_widget =
-        std::make_unique<ProverPlookupArithmeticWidget<ultra_settings>>(circuit_proving_key.get());
-
-    std::unique_ptr<ProverGenPermSortWidget<ultra_settings>> sort_widget =
-        std::make_unique<ProverGenPermSortWidget<ultra_settings>>(circuit_proving_key.get());
-
-    std::unique_ptr<ProverEllipticWidget<ultra_settings>> elliptic_widget =
-        std::make_unique<ProverEllipticWidget<ultra_settings>>(circuit_proving_key.get());
-
-    std::unique_ptr<ProverPlookupAuxiliaryWidget<ultra_settings>> auxiliary_widget =
-        std::make_unique<ProverPlookupAuxiliaryWidget<ultra_settings>>(circuit_proving_key.get());
+    std::unique_ptr<ProverUltraTransitionWidget<ultra_settings>> transition_widget =
+        std::make_unique<ProverUltraTransitionWidget<ultra_settings>>(circuit_proving_key.get());
 
     output_state.random_widgets.emplace_back(std::move(permutation_widget));
     output_state.random_widgets.emplace_back(std::move(plookup_widget));
 
-    output_state.transition_widgets.emplace_back(std::move(arithmetic_widget));
-    output_state.transition_widgets.emplace_back(std::move(sort_widget));
-    output_state.transition_widgets.emplace_back(std::move(elliptic_widget));
-    output_state.transition_widgets.emplace_back(std::move(auxiliary_widget));
+    output_state.transition_widgets.emplace_back(std::move(transition_widget));
 
     std::unique_ptr<KateCommitmentScheme<ultra_settings>> kate_commitment_scheme =
         std::make_unique<KateCommitmentScheme<ultra_settings>>();
@@ -862,25 +847,13 @@ UltraToStandardProver UltraComposer::create_ultra_to_standard_prover()
     std::unique_ptr<ProverPlookupWidget<>> plookup_widget =
         std::make_unique<ProverPlookupWidget<>>(circuit_proving_key.get());
 
-    std::unique_ptr<ProverPlookupArithmeticWidget<ultra_to_standard_settings>> arithmetic_widget =
-        std::make_unique<ProverPlookupArithmeticWidget<ultra_to_standard_settings>>(circuit_proving_key.get());
-
-    std::unique_ptr<ProverGenPermSortWidget<ultra_to_standard_settings>> sort_widget =
-        std::make_unique<ProverGenPermSortWidget<ultra_to_standard_settings>>(circuit_proving_key.get());
-
-    std::unique_ptr<ProverEllipticWidget<ultra_to_standard_settings>> elliptic_widget =
-        std::make_unique<ProverEllipticWidget<ultra_to_standard_settings>>(circuit_proving_key.get());
-
-    std::unique_ptr<ProverPlookupAuxiliaryWidget<ultra_to_standard_settings>> auxiliary_widget =
-        std::make_unique<ProverPlookupAuxiliaryWidget<ultra_to_standard_settings>>(circuit_proving_key.get());
+    std::unique_ptr<ProverUltraTransitionWidget<ultra_to_standard_settings>> transition_widget =
+        std::make_unique<ProverUltraTransitionWidget<ultra_to_standard_settings>>(circuit_proving_key.get());
 
     output_state.random_widgets.emplace_back(std::move(permutation_widget));
     output_state.random_widgets.emplace_back(std::move(plookup_widget));
 
-    output_state.transition_widgets.emplace_back(std::move(arithmetic_widget));
-    output_state.transition_widgets.emplace_back(std::move(sort_widget));
-    output_state.transition_widgets.emplace_back(std::move(elliptic_widget));
-    output_state.transition_widgets.emplace_back(std::move(auxiliary_widget));
+    output_state.transition_widgets.emplace_back(std::move(transition_widget));
 
     std::unique_ptr<KateCommitmentScheme<ultra_to_standard_settings>> kate_commitment_scheme =
         std::make_unique<KateCommitmentScheme<ultra_to_standard_settings>>();
@@ -1163,27 +1136,47 @@ void UltraComposer::create_new_range_constraint(const uint32_t variable_index,
     list.variable_indices.emplace_back(variable_index);
 }
 
-void UltraComposer::process_range_list(const RangeList& list)
+/**
+ * @brief Collect the values of the variables in a range list, in increasing order.
+ *
+ * @details This only reads witnesses, so the lists can be sorted concurrently. Satisfiable lists hold values no larger
+ * than their target range, which is usually at most DEFAULT_PLOOKUP_RANGE_SIZE, so they are counting sorted in time
+ * linear in the list size. Values from a wider range than that (or from an unsatisfiable list) fall back to std::sort
+ * when the range dwarfs the list.
+ */
+std::vector<uint64_t> UltraComposer::sort_range_list(const RangeList& list) const
 {
-    assert_valid_variables(list.variable_indices);
-
-    ASSERT(list.variable_indices.size() > 0);
-    // go over variables
-    // for each variable, create mirror variable with same value - with tau tag
-    // need to make sure that, in original list, increments of at most 3
     std::vector<uint64_t> sorted_list;
     sorted_list.reserve(list.variable_indices.size());
+    uint64_t max_value = 0;
     for (const auto variable_index : list.variable_indices) {
         const auto& field_element = get_variable(variable_index);
         const uint64_t shrinked_value = field_element.from_montgomery_form().data[0];
         sorted_list.emplace_back(shrinked_value);
+        max_value = std::max(max_value, shrinked_value);
     }
 
-#ifdef NO_TBB
-    std::sort(sorted_list.begin(), sorted_list.end());
-#else
-    std::sort(std::execution::par_unseq, sorted_list.begin(), sorted_list.end());
-#endif
+    if (max_value <= std::max(static_cast<uint64_t>(DEFAULT_PLOOKUP_RANGE_SIZE), uint64_t(sorted_list.size()))) {
+        counting_sort(sorted_list, max_value);
+    } else {
+        std::sort(sorted_list.begin(), sorted_list.end());
+    }
+    return sorted_list;
+}
+
+void UltraComposer::process_range_list(const RangeList& list)
+{
+    process_range_list(list, sort_range_list(list));
+}
+
+void UltraComposer::process_range_list(const RangeList& list, const std::vector<uint64_t>& sorted_list)
+{
+    assert_valid_variables(list.variable_indices);
+
+    ASSERT(list.variable_indices.size() > 0);
+    // go over variables
+    // for each variable, create mirror variable with same value - with tau tag
+    // need to make sure that, in original list, increments of at most 3
     std::vector<uint32_t> indices;
 
     // list must be padded to a multipe of 4 and larger than 4 (gate_width)
@@ -1204,8 +1197,17 @@ void UltraComposer::process_range_list(const RangeList& list)
 
 void UltraComposer::process_range_lists()
 {
-    for (const auto& i : range_lists)
-        process_range_list(i.second);
+    // Sort every list up front, in parallel: adding the sorted values to the circuit has to be done in order.
+    std::vector<const RangeList*> lists;
+    for (const auto& i : range_lists) {
+        lists.push_back(&i.second);
+    }
+    std::vector<std::vector<uint64_t>> sorted_lists(lists.size());
+    parallel_for(lists.size(), [&](size_t i) { sorted_lists[i] = sort_range_list(*lists[i]); });
+
+    for (size_t i = 0; i < lists.size(); ++i) {
+        process_range_list(*lists[i], sorted_lists[i]);
+    }
 }
 
 /*
@@ -2593,6 +2595,33 @@ std::array<uint32_t, 2> UltraComposer::read_ROM_array_pair(const size_t rom_id,
     return value_witnesses;
 }
 
+namespace {
+/**
+ * @brief Order ROM records by index. Indices are bounded by the array size, so this is a counting sort (which keeps
+ * reads of the same cell in the order they were made).
+ */
+void sort_ROM_records(UltraComposer::RomTranscript& rom_array)
+{
+    if (std::is_sorted(rom_array.records.begin(), rom_array.records.end())) {
+        return;
+    }
+    counting_sort(rom_array.records, rom_array.state.size(), [](const auto& record) { return record.index; });
+}
+
+/**
+ * @brief Order RAM records by index, then timestamp: a counting sort on the timestamps (bounded by the number of
+ * accesses), followed by a stable one on the indices (bounded by the array size).
+ */
+void sort_RAM_records(UltraComposer::RamTranscript& ram_array)
+{
+    if (std::is_sorted(ram_array.records.begin(), ram_array.records.end())) {
+        return;
+    }
+    counting_sort(ram_array.records, ram_array.access_count, [](const auto& record) { return record.timestamp; });
+    counting_sort(ram_array.records, ram_array.state.size(), [](const auto& record) { return record.index; });
+}
+} // namespace
+
 /**
  * @brief Compute additional gates required to validate ROM reads. Called when generating the proving key
  *
@@ -2614,11 +2643,7 @@ void UltraComposer::process_ROM_array(const size_t rom_id, const size_t gate_off
         }
     }
 
-#ifdef NO_TBB
-    std::sort(rom_array.records.begin(), rom_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, rom_array.records.begin(), rom_array.records.end());
-#endif
+    sort_ROM_records(rom_array);
 
     for (const RomRecord& record : rom_array.records) {
         const auto index = record.index;
@@ -2698,11 +2723,7 @@ void UltraComposer::process_RAM_array(const size_t ram_id, const size_t gate_off
         }
     }
 
-#ifdef NO_TBB
-    std::sort(ram_array.records.begin(), ram_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, ram_array.records.begin(), ram_array.records.end());
-#endif
+    sort_RAM_records(ram_array);
 
     // Iterate over all but final RAM record.
     for (size_t i = 0; i < ram_array.records.size(); ++i) {
@@ -2818,12 +2839,16 @@ void UltraComposer::process_RAM_array(const size_t ram_id, const size_t gate_off
 
 void UltraComposer::process_ROM_arrays(const size_t gate_offset_from_public_inputs)
 {
+    // Arrays are sorted in parallel here; process_ROM_array then only re-sorts an array if it had to fill in
+    // uninitialized cells.
+    parallel_for(rom_arrays.size(), [&](size_t i) { sort_ROM_records(rom_arrays[i]); });
     for (size_t i = 0; i < rom_arrays.size(); ++i) {
         process_ROM_array(i, gate_offset_from_public_inputs);
     }
 }
 void UltraComposer::process_RAM_arrays(const size_t gate_offset_from_public_inputs)
 {
+    parallel_for(ram_arrays.size(), [&](size_t i) { sort_RAM_records(ram_arrays[i]); });
     for (size_t i = 0; i < ram_arrays.size(); ++i) {
         process_RAM_array(i, gate_offset_from_public_inputs);
     }
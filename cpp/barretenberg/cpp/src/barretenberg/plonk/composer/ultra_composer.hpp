@@ -440,7 +440,9 @@ class UltraComposer : public ComposerBase {
     }
 
     RangeList create_range_list(const uint64_t target_range);
+    std::vector<uint64_t> sort_range_list(const RangeList& list) const;
     void process_range_list(const RangeList& list);
+    void process_range_list(const RangeList& list, const std::vector<uint64_t>& sorted_list);
     void process_range_lists();
 
     /**
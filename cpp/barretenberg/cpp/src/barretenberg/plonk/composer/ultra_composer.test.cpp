@@ -5,6 +5,7 @@
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/uintx/uintx.hpp"
 #include "../proof_system/widgets/random_widgets/plookup_widget.hpp"
+#include "../proof_system/widgets/transition_widgets/fused_transition_widgets.hpp"
 #include "./plookup_tables/sha256.hpp"
 
 using namespace barretenberg;
@@ -856,4 +857,131 @@ TEST(ultra_composer, ram)
     EXPECT_EQ(result, true);
 }
 
+namespace {
+void build_cached_key_test_circuit(UltraComposer& composer, const fr& constant, const size_t num_public_inputs)
+{
+    for (size_t i = 0; i < num_public_inputs; ++i) {
+        composer.add_public_variable(fr(i + 1));
+    }
+    const uint32_t a_idx = composer.add_variable(fr(5));
+    const uint32_t b_idx = composer.add_variable(fr(7));
+    const uint32_t c_idx = composer.add_variable(fr(12) + constant);
+    composer.create_add_gate({ a_idx, b_idx, c_idx, fr::one(), fr::one(), fr::neg_one(), constant });
+    for (size_t i = 0; i < 10; ++i) {
+        const uint32_t d_idx = composer.add_variable(fr(i));
+        composer.create_new_range_constraint(d_idx, 15);
+        composer.create_add_gate({ a_idx, d_idx, composer.zero_idx, fr(i), fr::one(), fr::zero(), -fr(5 * i + i) });
+    }
+}
+
+// Every precomputed polynomial of a key built from a cached one must match the key built from scratch.
+void expect_same_precomputed_polynomials(proving_key& expected, proving_key& actual)
+{
+    PrecomputedPolyList precomputed_poly_list(expected.composer_type);
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        const std::string label = precomputed_poly_list[i];
+        EXPECT_EQ(expected.polynomial_store.get(label), actual.polynomial_store.get(label)) << label;
+    }
+}
+} // namespace
+
+TEST(ultra_composer, cached_proving_key_after_constant_change)
+{
+    UltraComposer old_composer;
+    build_cached_key_test_circuit(old_composer, fr(3), 1);
+    auto old_key = old_composer.compute_proving_key();
+
+    UltraComposer fresh_composer;
+    build_cached_key_test_circuit(fresh_composer, fr(4), 1);
+    auto fresh_key = fresh_composer.compute_proving_key();
+
+    UltraComposer composer;
+    build_cached_key_test_circuit(composer, fr(4), 1);
+    composer.set_cached_proving_key(old_key);
+    auto key = composer.compute_proving_key();
+
+    expect_same_precomputed_polynomials(*fresh_key, *key);
+    // Only q_c changes, in a single row.
+    EXPECT_EQ(composer.cached_key_stats.updated, 1UL);
+    EXPECT_EQ(composer.cached_key_stats.recomputed, 0UL);
+
+    auto prover = composer.create_prover();
+    auto verifier = composer.create_verifier();
+    proof proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+TEST(ultra_composer, cached_proving_key_after_public_input_change)
+{
+    UltraComposer old_composer;
+    build_cached_key_test_circuit(old_composer, fr(3), 1);
+    auto old_key = old_composer.compute_proving_key();
+
+    UltraComposer fresh_composer;
+    build_cached_key_test_circuit(fresh_composer, fr(3), 2);
+    auto fresh_key = fresh_composer.compute_proving_key();
+
+    UltraComposer composer;
+    build_cached_key_test_circuit(composer, fr(3), 2);
+    composer.set_cached_proving_key(old_key);
+    auto key = composer.compute_proving_key();
+
+    expect_same_precomputed_polynomials(*fresh_key, *key);
+    // The gates move down a row: selectors follow with a rotation and a couple of changed rows, and polynomials that
+    // only hold the lookup tables do not change at all.
+    EXPECT_GT(composer.cached_key_stats.updated, 0UL);
+    EXPECT_GT(composer.cached_key_stats.reused, 0UL);
+
+    auto prover = composer.create_prover();
+    auto verifier = composer.create_verifier();
+    proof proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+TEST(ultra_composer, fused_transition_widget_matches_separate_widgets)
+{
+    UltraComposer composer;
+    build_cached_key_test_circuit(composer, fr(3), 1);
+    auto prover = composer.create_prover();
+
+    // Run the prover through the quotient round, so that the transcript holds alpha and the store holds the coset
+    // forms of the witnesses.
+    prover.execute_preamble_round();
+    prover.queue.process_queue();
+    prover.execute_first_round();
+    prover.queue.process_queue();
+    prover.execute_second_round();
+    prover.queue.process_queue();
+    prover.execute_third_round();
+    prover.queue.process_queue();
+    prover.execute_fourth_round();
+    prover.queue.process_queue();
+
+    auto* key = prover.key.get();
+    const fr alpha_base = fr::serialize_from_buffer(prover.transcript.get_challenge("alpha").begin());
+    auto compute_quotient = [&](auto... widgets) {
+        for (auto& part : key->quotient_polynomial_parts) {
+            std::fill(part.begin(), part.end(), fr::zero());
+        }
+        fr alpha = alpha_base;
+        ((alpha = widgets.compute_quotient_contribution(alpha, prover.transcript)), ...);
+        std::vector<polynomial> parts;
+        for (auto& part : key->quotient_polynomial_parts) {
+            parts.emplace_back(part);
+        }
+        return std::make_pair(alpha, std::move(parts));
+    };
+
+    const auto separate = compute_quotient(ProverPlookupArithmeticWidget<ultra_settings>(key),
+                                           ProverGenPermSortWidget<ultra_settings>(key),
+                                           ProverEllipticWidget<ultra_settings>(key),
+                                           ProverPlookupAuxiliaryWidget<ultra_settings>(key));
+    const auto fused = compute_quotient(ProverUltraTransitionWidget<ultra_settings>(key));
+
+    EXPECT_EQ(fused.first, separate.first);
+    for (size_t i = 0; i < separate.second.size(); ++i) {
+        EXPECT_EQ(fused.second[i], separate.second[i]);
+    }
+}
+
 } // namespace proof_system::plonk
@@ -545,16 +545,14 @@ template <typename settings> void ProverBase<settings>::add_blinding_to_quotient
     }
 }
 
-// Compute FFT of lagrange polynomial L_1 needed in random widgets only
+// Compute FFT of lagrange polynomial L_1 needed in random widgets only. It depends only on the circuit size, so it is
+// kept in the key across proofs, and a key loaded from an extended key file already has it.
 template <typename settings> void ProverBase<settings>::compute_lagrange_1_fft()
 {
-    polynomial lagrange_1_fft(4 * circuit_size + 8);
-    polynomial_arithmetic::compute_lagrange_polynomial_fft(
-        lagrange_1_fft.get_coefficients(), key->small_domain, key->large_domain);
-    for (size_t i = 0; i < 8; i++) {
-        lagrange_1_fft[4 * circuit_size + i] = lagrange_1_fft[i];
+    if (key->polynomial_store.contains("lagrange_1_fft")) {
+        return;
     }
-    key->polynomial_store.put("lagrange_1_fft", std::move(lagrange_1_fft));
+    key->polynomial_store.put("lagrange_1_fft", key->compute_lagrange_1_fft());
 }
 
 template <typename settings> plonk::proof& ProverBase<settings>::export_proof()
@@ -0,0 +1,184 @@
+#ifndef __wasm__
+#include "barretenberg/plonk/composer/standard_composer.hpp"
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
+#include "barretenberg/polynomials/polynomial_memory.hpp"
+#include "barretenberg/proof_system/work_queue/remote_worker.hpp"
+
+#include <chrono>
+#include <climits>
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace barretenberg;
+
+namespace proof_system::plonk {
+
+namespace {
+
+// Large enough for the SRS the test circuits commit with, and for the four n-sized FFTs of a wire.
+constexpr size_t MAX_CIRCUIT_SIZE = 1 << 13;
+constexpr size_t NUM_SEGMENT_ELEMENTS = 4 * MAX_CIRCUIT_SIZE;
+
+/**
+ * @brief bb_worker processes started with fork/exec, as a prover would use them, and a pool connected to them.
+ *
+ * @details bb_worker is built next to the test binary. The workers run with the working directory of the test, so
+ * they load the same SRS (../srs_db/ignition) as the composers.
+ */
+class WorkerProcesses {
+  public:
+    explicit WorkerProcesses(const size_t num_workers)
+    {
+        char exe[PATH_MAX] = {};
+        const ssize_t length = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+        std::string worker = length > 0 ? std::string(exe, static_cast<size_t>(length)) : "";
+        worker = worker.substr(0, worker.rfind('/') + 1) + "bb_worker";
+        const std::string num_points = std::to_string(MAX_CIRCUIT_SIZE + 1);
+
+        for (size_t i = 0; i < num_workers; ++i) {
+            const std::string path =
+                "/tmp/bb_remote_prover_test_" + std::to_string(getpid()) + "_" + std::to_string(i) + ".sock";
+            const pid_t pid = fork();
+            if (pid == 0) {
+                execl(worker.c_str(),
+                      worker.c_str(),
+                      path.c_str(),
+                      "--num-points",
+                      num_points.c_str(),
+                      static_cast<char*>(nullptr));
+                _exit(127);
+            }
+            pids.push_back(pid);
+            socket_paths.push_back(path);
+        }
+        // The workers load the SRS before they listen.
+        for (size_t attempt = 0; attempt < 600 && pool == nullptr; ++attempt) {
+            try {
+                pool = std::make_unique<remote::WorkerPool>(socket_paths, NUM_SEGMENT_ELEMENTS);
+            } catch (std::runtime_error&) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+        }
+    }
+
+    WorkerProcesses(const WorkerProcesses& other) = delete;
+    WorkerProcesses& operator=(const WorkerProcesses& other) = delete;
+
+    ~WorkerProcesses()
+    {
+        if (pool != nullptr) {
+            for (size_t i = 0; i < pool->size(); ++i) {
+                pool->get(i).shutdown();
+            }
+        }
+        for (const pid_t pid : pids) {
+            if (pool == nullptr) {
+                kill(pid, SIGKILL);
+            }
+            int status = 0;
+            waitpid(pid, &status, 0);
+            EXPECT_TRUE(pool == nullptr || (WIFEXITED(status) && WEXITSTATUS(status) == 0));
+        }
+    }
+
+    std::unique_ptr<remote::WorkerPool> pool;
+
+  private:
+    std::vector<pid_t> pids;
+    std::vector<std::string> socket_paths;
+};
+
+template <typename Composer> void add_multiplication_gates(Composer& composer, const size_t num_gates)
+{
+    for (size_t i = 0; i < num_gates; ++i) {
+        const fr a = fr::random_element();
+        const fr b = fr::random_element();
+        const uint32_t a_index = composer.add_variable(a);
+        const uint32_t b_index = composer.add_variable(b);
+        const uint32_t c_index = composer.add_variable(a * b);
+        composer.create_mul_gate({ a_index, b_index, c_index, fr::one(), fr::neg_one(), fr::zero() });
+    }
+}
+
+} // namespace
+
+// Every work item of the proof (the wire IFFTs, the 4-way split coset FFTs and the commitments) runs in bb_worker
+// processes. A wrong result anywhere makes the proof fail to verify.
+TEST(remote_prover, standard_proof_verifies)
+{
+    WorkerProcesses workers(2);
+    ASSERT_NE(workers.pool, nullptr);
+
+    StandardComposer composer;
+    add_multiplication_gates(composer, 3000);
+    auto prover = composer.create_prover();
+    ASSERT_LE(prover.key->circuit_size, MAX_CIRCUIT_SIZE);
+    prover.queue.set_remote_workers(workers.pool.get());
+    auto verifier = composer.create_verifier();
+
+    proof proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+TEST(remote_prover, ultra_proof_verifies)
+{
+    WorkerProcesses workers(3);
+    ASSERT_NE(workers.pool, nullptr);
+
+    UltraComposer composer;
+    add_multiplication_gates(composer, 3000);
+    auto prover = composer.create_prover();
+    ASSERT_LE(prover.key->circuit_size, MAX_CIRCUIT_SIZE);
+    prover.queue.set_remote_workers(workers.pool.get());
+    auto verifier = composer.create_verifier();
+
+    proof proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+// Scalars in polynomials allocated after the pool are read by the worker in place: the result matches a local
+// multiplication and the worker's segment is never written.
+TEST(remote_prover, shared_scalars_are_not_copied)
+{
+    WorkerProcesses workers(1);
+    ASSERT_NE(workers.pool, nullptr);
+
+    StandardComposer composer;
+    add_multiplication_gates(composer, 3000);
+    auto remote_prover = composer.create_prover();
+    auto local_prover = composer.create_prover();
+    const size_t n = remote_prover.key->circuit_size;
+
+    polynomial scalars(n);
+    for (auto& scalar : scalars) {
+        scalar = fr::random_element();
+    }
+    ASSERT_TRUE(polynomial_memory::find_shared(scalars.data(), n * sizeof(fr)).has_value());
+
+    auto& connection = workers.pool->get(0);
+    const fr poison = fr::random_element();
+    std::fill(connection.buffer(), connection.buffer() + n, poison);
+
+    for (auto* prover : { &remote_prover, &local_prover }) {
+        prover->queue.add_to_queue({
+            .work_type = work_queue::WorkType::SCALAR_MULTIPLICATION,
+            .mul_scalars = scalars.data(),
+            .tag = "W_1",
+            .constant = n,
+            .index = 0,
+        });
+    }
+    remote_prover.queue.set_remote_workers(workers.pool.get());
+    remote_prover.queue.process_queue();
+    local_prover.queue.process_queue();
+
+    EXPECT_EQ(remote_prover.transcript.get_element("W_1"), local_prover.transcript.get_element("W_1"));
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(connection.buffer()[i], poison);
+    }
+}
+
+} // namespace proof_system::plonk
+#endif
@@ -53,7 +53,7 @@ proving_key::proving_key(proving_key_data&& data, std::shared_ptr<proof_system::
     , recursive_proof_public_input_indices(std::move(data.recursive_proof_public_input_indices))
     , memory_read_records(data.memory_read_records)
     , memory_write_records(data.memory_write_records)
-    , polynomial_store(data.polynomial_store)
+    , polynomial_store(std::move(data.polynomial_store))
     , small_domain(circuit_size, circuit_size)
     , large_domain(4 * circuit_size, circuit_size > min_thread_block ? circuit_size : 4 * circuit_size)
     , reference_string(crs)
@@ -89,4 +89,15 @@ void proving_key::init()
     memset((void*)&quotient_polynomial_parts[3][0], 0x00, sizeof(barretenberg::fr) * circuit_size);
 }
 
+barretenberg::polynomial proving_key::compute_lagrange_1_fft() const
+{
+    barretenberg::polynomial lagrange_1_fft(4 * circuit_size + 8);
+    barretenberg::polynomial_arithmetic::compute_lagrange_polynomial_fft(
+        lagrange_1_fft.get_coefficients(), small_domain, large_domain);
+    for (size_t i = 0; i < 8; i++) {
+        lagrange_1_fft[4 * circuit_size + i] = lagrange_1_fft[i];
+    }
+    return lagrange_1_fft;
+}
+
 } // namespace proof_system::plonk
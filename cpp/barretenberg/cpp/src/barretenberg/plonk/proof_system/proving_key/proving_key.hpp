@@ -42,6 +42,12 @@ struct proving_key {
 
     void init();
 
+    /**
+     * @brief Compute the evaluations of L_1 on the 4n coset (plus 8 wrap-around values), as used by the random
+     * widgets. The result depends only on the circuit size, so it can be stored with the key.
+     */
+    barretenberg::polynomial compute_lagrange_1_fft() const;
+
     uint32_t composer_type;
     size_t circuit_size;
     size_t log_circuit_size;
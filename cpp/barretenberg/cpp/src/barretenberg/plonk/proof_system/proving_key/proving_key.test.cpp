@@ -151,3 +151,87 @@ TEST(proving_key, proving_key_from_mmaped_key)
     EXPECT_EQ(p_key.contains_recursive_proof, pk_data.contains_recursive_proof);
 }
 #endif
+
+// Test that a proving key survives a round trip through a key file, both copied into memory and mmapped
+#ifndef __wasm__
+TEST(proving_key, proving_key_from_key_file)
+{
+    plonk::UltraComposer composer = plonk::UltraComposer();
+    fr a = fr::one();
+    composer.add_public_variable(a);
+    plonk::proving_key& p_key = *composer.compute_proving_key();
+
+    std::string pk_path = std::filesystem::temp_directory_path() / "proving_key_from_key_file";
+    plonk::write_key_file(pk_path, p_key);
+
+    for (bool map : { false, true }) {
+        plonk::proving_key_data pk_data;
+        plonk::read_key_file(pk_path, pk_data, map);
+
+        plonk::PrecomputedPolyList precomputed_poly_list(p_key.composer_type);
+        for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+            std::string poly_id = precomputed_poly_list[i];
+            barretenberg::polynomial& output_poly = pk_data.polynomial_store.get(poly_id);
+            EXPECT_EQ(p_key.polynomial_store.get(poly_id), output_poly);
+            EXPECT_EQ(output_poly.mapped(), map);
+            // The coefficient past the end, which shifted polynomials read, is zero.
+            EXPECT_EQ(output_poly[output_poly.size()], fr::zero());
+        }
+
+        EXPECT_EQ(p_key.composer_type, pk_data.composer_type);
+        EXPECT_EQ(p_key.circuit_size, pk_data.circuit_size);
+        EXPECT_EQ(p_key.num_public_inputs, pk_data.num_public_inputs);
+        EXPECT_EQ(p_key.contains_recursive_proof, pk_data.contains_recursive_proof);
+        EXPECT_EQ(p_key.memory_read_records, pk_data.memory_read_records);
+        EXPECT_EQ(p_key.memory_write_records, pk_data.memory_write_records);
+    }
+    std::filesystem::remove(pk_path);
+}
+#endif
+
+// Test that a prover can run straight from a key mmapped out of an extended key file
+#ifndef __wasm__
+TEST(proving_key, prove_from_mapped_extended_key_file)
+{
+    plonk::UltraComposer composer = plonk::UltraComposer();
+    fr a = fr::one();
+    composer.add_public_variable(a);
+    plonk::proving_key& p_key = *composer.compute_proving_key();
+    auto verification_key = composer.compute_verification_key();
+
+    std::string pk_path = std::filesystem::temp_directory_path() / "prove_from_mapped_extended_key_file";
+    plonk::write_key_file(pk_path, p_key, true);
+    EXPECT_FALSE(p_key.polynomial_store.contains("lagrange_1_fft"));
+
+    plonk::proving_key_data pk_data;
+    plonk::read_key_file(pk_path, pk_data, true);
+    EXPECT_EQ(pk_data.polynomial_store.get("lagrange_1_fft"), p_key.compute_lagrange_1_fft());
+
+    auto crs = std::make_unique<proof_system::FileReferenceStringFactory>("../srs_db/ignition");
+    auto proving_key =
+        std::make_shared<plonk::proving_key>(std::move(pk_data), crs->get_prover_crs(p_key.circuit_size + 1));
+    // The polynomials are moved into the key, not copied out of the mapping.
+    EXPECT_TRUE(proving_key->polynomial_store.get("lagrange_1_fft").mapped());
+    EXPECT_TRUE(proving_key->polynomial_store.get("sigma_1_fft").mapped());
+
+    plonk::UltraComposer composer2 = plonk::UltraComposer(proving_key, verification_key);
+    composer2.add_public_variable(a);
+    auto prover = composer2.create_prover();
+    auto verifier = composer2.create_verifier();
+    plonk::proof proof = prover.construct_proof();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+
+    std::filesystem::remove(pk_path);
+}
+#endif
+
+// Test that serialized_size matches the size of the serialized key
+TEST(proving_key, serialized_size_matches_buffer)
+{
+    plonk::UltraComposer composer = plonk::UltraComposer();
+    fr a = fr::one();
+    composer.add_public_variable(a);
+    plonk::proving_key& p_key = *composer.compute_proving_key();
+
+    EXPECT_EQ(plonk::serialized_size(p_key), to_buffer(p_key).size());
+}
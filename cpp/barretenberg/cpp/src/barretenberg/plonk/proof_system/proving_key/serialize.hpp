@@ -3,6 +3,9 @@
 #include "barretenberg/polynomials/serialize.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "serialize_file.hpp"
+#include <fcntl.h>
+#include <unistd.h>
 
 namespace proof_system::plonk {
 
@@ -61,6 +64,39 @@ template <typename B> inline void write(B& buf, proving_key const& key)
     write(buf, key.memory_write_records);
 }
 
+/**
+ * @brief The number of bytes write(buf, key) produces, so that a key can be serialized straight into a buffer of
+ * exactly that size instead of into a vector that is then copied.
+ */
+inline size_t serialized_size(proving_key const& key)
+{
+    using serialize::write;
+    // Everything but the polynomial coefficients is small, so serialize that and count the coefficients.
+    std::vector<uint8_t> metadata;
+    size_t coefficient_bytes = 0;
+    write(metadata, key.composer_type);
+    write(metadata, (uint32_t)key.circuit_size);
+    write(metadata, (uint32_t)key.num_public_inputs);
+
+    PrecomputedPolyList precomputed_poly_list(key.composer_type);
+    size_t num_polys = precomputed_poly_list.size();
+    write(metadata, static_cast<uint32_t>(num_polys));
+
+    for (size_t i = 0; i < num_polys; ++i) {
+        std::string poly_id = precomputed_poly_list[i];
+        const barretenberg::polynomial& value = ((proving_key&)key).polynomial_store.get(poly_id);
+        write(metadata, poly_id);
+        write(metadata, static_cast<uint32_t>(value.size()));
+        coefficient_bytes += value.size() * sizeof(barretenberg::fr);
+    }
+
+    write(metadata, key.contains_recursive_proof);
+    write(metadata, key.recursive_proof_public_input_indices);
+    write(metadata, key.memory_read_records);
+    write(metadata, key.memory_write_records);
+    return metadata.size() + coefficient_bytes;
+}
+
 template <typename B> inline void read_mmap(B& is, std::string const& path, proving_key_data& key)
 {
     using serialize::read;
@@ -103,11 +139,12 @@ template <typename B> inline void write_mmap(B& os, std::string const& path, pro
         write(os, poly_id);
         const barretenberg::polynomial& value = ((proving_key&)key).polynomial_store.get(poly_id);
         auto size = value.size();
-        std::ofstream ofs(filename);
-        ofs.write((char*)&value[0], (std::streamsize)(size * sizeof(barretenberg::fr)));
-        if (!ofs.good()) {
+        int fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
             throw_or_abort(format("Failed to write: ", filename));
         }
+        parallel_pwrite(fd, &value[0], size * sizeof(barretenberg::fr), 0);
+        ::close(fd);
     }
     write(os, key.contains_recursive_proof);
     write(os, key.recursive_proof_public_input_indices);
@@ -0,0 +1,264 @@
+#include "serialize_file.hpp"
+#include "barretenberg/common/net.hpp"
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace proof_system::plonk {
+
+namespace {
+
+// Large enough to keep the per-call overhead negligible, small enough to spread a polynomial over many threads.
+constexpr size_t IO_CHUNK_SIZE = 1 << 22;
+constexpr size_t PREAMBLE_SIZE = 2 * sizeof(uint32_t) + sizeof(uint64_t);
+
+// Closes the descriptor on every exit path, including a throw_or_abort.
+struct ScopedFile {
+    int fd;
+    ~ScopedFile()
+    {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+};
+
+uint64_t align_up(uint64_t value)
+{
+    return (value + KEY_FILE_ALIGNMENT - 1) & ~(KEY_FILE_ALIGNMENT - 1);
+}
+
+void pwrite_all(int fd, const uint8_t* data, size_t num_bytes, uint64_t offset)
+{
+    while (num_bytes > 0) {
+        const ssize_t written = ::pwrite(fd, data, num_bytes, static_cast<off_t>(offset));
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            throw_or_abort(format("Failed to write proving key file: ", std::strerror(errno)));
+        }
+        data += written;
+        num_bytes -= static_cast<size_t>(written);
+        offset += static_cast<uint64_t>(written);
+    }
+}
+
+void pread_all(int fd, uint8_t* data, size_t num_bytes, uint64_t offset)
+{
+    while (num_bytes > 0) {
+        const ssize_t num_read = ::pread(fd, data, num_bytes, static_cast<off_t>(offset));
+        if (num_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (num_read <= 0) {
+            throw_or_abort("Failed to read proving key file: unexpected end of file");
+        }
+        data += num_read;
+        num_bytes -= static_cast<size_t>(num_read);
+        offset += static_cast<uint64_t>(num_read);
+    }
+}
+
+void check_little_endian()
+{
+    if (!is_little_endian()) {
+        throw_or_abort("Proving key files are only supported on little endian hosts.");
+    }
+}
+
+key_file_header read_header_and_check(int fd)
+{
+    check_little_endian();
+    return read_key_file_header(fd);
+}
+
+void copy_header_fields(key_file_header& header, proving_key_data& key)
+{
+    key.composer_type = header.composer_type;
+    key.circuit_size = header.circuit_size;
+    key.num_public_inputs = header.num_public_inputs;
+    key.contains_recursive_proof = header.contains_recursive_proof;
+    key.recursive_proof_public_input_indices = std::move(header.recursive_proof_public_input_indices);
+    key.memory_read_records = std::move(header.memory_read_records);
+    key.memory_write_records = std::move(header.memory_write_records);
+}
+
+} // namespace
+
+void parallel_pwrite(int fd, const void* data, size_t num_bytes, uint64_t offset)
+{
+    const size_t num_chunks = (num_bytes + IO_CHUNK_SIZE - 1) / IO_CHUNK_SIZE;
+    barretenberg::parallel_for(num_chunks, [&](size_t i) {
+        const size_t start = i * IO_CHUNK_SIZE;
+        const size_t length = std::min(IO_CHUNK_SIZE, num_bytes - start);
+        pwrite_all(fd, static_cast<const uint8_t*>(data) + start, length, offset + start);
+    });
+}
+
+void parallel_pread(int fd, void* data, size_t num_bytes, uint64_t offset)
+{
+    const size_t num_chunks = (num_bytes + IO_CHUNK_SIZE - 1) / IO_CHUNK_SIZE;
+    barretenberg::parallel_for(num_chunks, [&](size_t i) {
+        const size_t start = i * IO_CHUNK_SIZE;
+        const size_t length = std::min(IO_CHUNK_SIZE, num_bytes - start);
+        pread_all(fd, static_cast<uint8_t*>(data) + start, length, offset + start);
+    });
+}
+
+void write_key_file(int fd, proving_key const& key, bool extended)
+{
+    check_little_endian();
+    auto& polynomial_store = const_cast<proving_key&>(key).polynomial_store;
+
+    key_file_header header{ key.composer_type,
+                            static_cast<uint32_t>(key.circuit_size),
+                            static_cast<uint32_t>(key.num_public_inputs),
+                            key.contains_recursive_proof,
+                            key.recursive_proof_public_input_indices,
+                            key.memory_read_records,
+                            key.memory_write_records,
+                            {} };
+    std::vector<const barretenberg::polynomial*> polynomials;
+    PrecomputedPolyList precomputed_poly_list(key.composer_type);
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        polynomials.push_back(&polynomial_store.get(precomputed_poly_list[i]));
+        header.polynomials.push_back({ precomputed_poly_list[i], 0, polynomials.back()->size() });
+    }
+    // lagrange_1_fft depends only on the circuit size. If the key does not hold it yet it is computed into `derived`,
+    // which outlives the writes below.
+    barretenberg::polynomial derived;
+    if (extended) {
+        if (polynomial_store.contains("lagrange_1_fft")) {
+            polynomials.push_back(&polynomial_store.get("lagrange_1_fft"));
+        } else {
+            derived = key.compute_lagrange_1_fft();
+            polynomials.push_back(&derived);
+        }
+        header.polynomials.push_back({ "lagrange_1_fft", 0, polynomials.back()->size() });
+    }
+
+    // The offsets are part of the header, so size the header with placeholder offsets first.
+    const uint64_t header_size = to_buffer(header).size();
+    uint64_t offset = align_up(PREAMBLE_SIZE + header_size);
+    for (auto& entry : header.polynomials) {
+        entry.offset = offset;
+        offset = align_up(offset + (entry.num_coefficients + 1) * sizeof(barretenberg::fr));
+    }
+    const uint64_t file_size = offset;
+
+    std::vector<uint8_t> head;
+    serialize::write(head, KEY_FILE_MAGIC);
+    serialize::write(head, KEY_FILE_VERSION);
+    serialize::write(head, header_size);
+    write(head, header);
+
+    // Sizing the file first leaves zeroes in the alignment padding (including the coefficient after each polynomial)
+    // and lets the chunks below be written in any order.
+    if (::ftruncate(fd, static_cast<off_t>(file_size)) != 0) {
+        throw_or_abort(format("Failed to size proving key file: ", std::strerror(errno)));
+    }
+    pwrite_all(fd, head.data(), head.size(), 0);
+
+    // One task per chunk of every polynomial, so that small polynomials do not serialize the write.
+    struct Chunk {
+        const uint8_t* data;
+        size_t num_bytes;
+        uint64_t offset;
+    };
+    std::vector<Chunk> chunks;
+    for (size_t j = 0; j < header.polynomials.size(); ++j) {
+        const auto& entry = header.polynomials[j];
+        const auto* data = reinterpret_cast<const uint8_t*>(polynomials[j]->data());
+        const size_t num_bytes = entry.num_coefficients * sizeof(barretenberg::fr);
+        for (size_t start = 0; start < num_bytes; start += IO_CHUNK_SIZE) {
+            chunks.push_back({ data + start, std::min(IO_CHUNK_SIZE, num_bytes - start), entry.offset + start });
+        }
+    }
+    barretenberg::parallel_for(chunks.size(), [&](size_t i) {
+        pwrite_all(fd, chunks[i].data, chunks[i].num_bytes, chunks[i].offset);
+    });
+}
+
+void write_key_file(std::string const& path, proving_key const& key, bool extended)
+{
+    const ScopedFile file{ ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644) };
+    if (file.fd < 0) {
+        throw_or_abort(format("Failed to open proving key file for writing: ", path));
+    }
+    write_key_file(file.fd, key, extended);
+}
+
+key_file_header read_key_file_header(int fd)
+{
+    uint8_t preamble[PREAMBLE_SIZE];
+    pread_all(fd, preamble, PREAMBLE_SIZE, 0);
+    const uint8_t* it = preamble;
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint64_t header_size = 0;
+    serialize::read(it, magic);
+    serialize::read(it, version);
+    serialize::read(it, header_size);
+    if (magic != KEY_FILE_MAGIC) {
+        throw_or_abort("Not a proving key file.");
+    }
+    if (version != KEY_FILE_VERSION) {
+        throw_or_abort(format("Unsupported proving key file version: ", version));
+    }
+
+    std::vector<uint8_t> buffer(header_size);
+    pread_all(fd, buffer.data(), buffer.size(), PREAMBLE_SIZE);
+    return from_buffer<key_file_header>(buffer);
+}
+
+void read_key_file(int fd, proving_key_data& key)
+{
+    key_file_header header = read_header_and_check(fd);
+
+    struct Chunk {
+        uint8_t* data;
+        size_t num_bytes;
+        uint64_t offset;
+    };
+    std::vector<Chunk> chunks;
+    for (const auto& entry : header.polynomials) {
+        barretenberg::polynomial value(entry.num_coefficients);
+        auto* data = reinterpret_cast<uint8_t*>(value.data());
+        const size_t num_bytes = entry.num_coefficients * sizeof(barretenberg::fr);
+        for (size_t start = 0; start < num_bytes; start += IO_CHUNK_SIZE) {
+            chunks.push_back({ data + start, std::min(IO_CHUNK_SIZE, num_bytes - start), entry.offset + start });
+        }
+        // Moving the polynomial does not move its coefficients, so `data` stays valid.
+        key.polynomial_store.put(entry.label, std::move(value));
+    }
+    barretenberg::parallel_for(chunks.size(), [&](size_t i) {
+        pread_all(fd, chunks[i].data, chunks[i].num_bytes, chunks[i].offset);
+    });
+
+    copy_header_fields(header, key);
+}
+
+void read_key_file(std::string const& path, proving_key_data& key, bool map)
+{
+    const ScopedFile file{ ::open(path.c_str(), O_RDONLY) };
+    if (file.fd < 0) {
+        throw_or_abort(format("Failed to open proving key file: ", path));
+    }
+    if (!map) {
+        read_key_file(file.fd, key);
+        return;
+    }
+
+    key_file_header header = read_header_and_check(file.fd);
+    for (const auto& entry : header.polynomials) {
+        key.polynomial_store.put(entry.label,
+                                 barretenberg::polynomial(file.fd, entry.offset, entry.num_coefficients));
+    }
+    copy_header_fields(header, key);
+}
+
+} // namespace proof_system::plonk
@@ -0,0 +1,123 @@
+#pragma once
+#include "proving_key.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include <string>
+#include <vector>
+
+/**
+ * Proving key files: the same data as write(B&, proving_key), laid out so that the polynomials can be moved between
+ * memory and disk directly, in parallel, without ever building the serialized key in memory.
+ *
+ * Layout:
+ *   - a fixed 16 byte preamble: magic, format version and the size of the header that follows;
+ *   - the header (key_file_header, in the usual big-endian serialization), which indexes every polynomial;
+ *   - the coefficients of each polynomial in little endian Montgomery form, at KEY_FILE_ALIGNMENT aligned offsets.
+ *
+ * Each polynomial is followed by at least one zero coefficient, so that a polynomial mmapped straight from the file
+ * can be shifted just like one allocated in memory. Aligned offsets mean the polynomials can be mmapped individually,
+ * as read_mmap does for the one-file-per-polynomial layout.
+ *
+ * An extended key file also indexes lagrange_1_fft, which the prover would otherwise compute from the circuit size
+ * when the key is first used. Readers load whatever the header indexes, so both kinds of file read the same way.
+ */
+namespace proof_system::plonk {
+
+constexpr uint32_t KEY_FILE_MAGIC = 0x504b4559; // "PKEY"
+constexpr uint32_t KEY_FILE_VERSION = 1;
+// A multiple of every page size we run on (up to 64 KiB pages on arm64).
+constexpr uint64_t KEY_FILE_ALIGNMENT = 1 << 16;
+
+struct key_file_entry {
+    std::string label;
+    uint64_t offset;           // in bytes, from the start of the file
+    uint64_t num_coefficients; // not counting the zero coefficient that follows
+};
+
+template <typename B> inline void read(B& it, key_file_entry& entry)
+{
+    using serialize::read;
+    read(it, entry.label);
+    read(it, entry.offset);
+    read(it, entry.num_coefficients);
+}
+
+template <typename B> inline void write(B& buf, key_file_entry const& entry)
+{
+    using serialize::write;
+    write(buf, entry.label);
+    write(buf, entry.offset);
+    write(buf, entry.num_coefficients);
+}
+
+struct key_file_header {
+    uint32_t composer_type;
+    uint32_t circuit_size;
+    uint32_t num_public_inputs;
+    bool contains_recursive_proof;
+    std::vector<uint32_t> recursive_proof_public_input_indices;
+    std::vector<uint32_t> memory_read_records;
+    std::vector<uint32_t> memory_write_records;
+    std::vector<key_file_entry> polynomials;
+};
+
+template <typename B> inline void read(B& it, key_file_header& header)
+{
+    using serialize::read;
+    read(it, header.composer_type);
+    read(it, header.circuit_size);
+    read(it, header.num_public_inputs);
+    read(it, header.contains_recursive_proof);
+    read(it, header.recursive_proof_public_input_indices);
+    read(it, header.memory_read_records);
+    read(it, header.memory_write_records);
+    read(it, header.polynomials);
+}
+
+template <typename B> inline void write(B& buf, key_file_header const& header)
+{
+    using serialize::write;
+    write(buf, header.composer_type);
+    write(buf, header.circuit_size);
+    write(buf, header.num_public_inputs);
+    write(buf, header.contains_recursive_proof);
+    write(buf, header.recursive_proof_public_input_indices);
+    write(buf, header.memory_read_records);
+    write(buf, header.memory_write_records);
+    write(buf, header.polynomials);
+}
+
+/**
+ * @brief Write the precomputed polynomials of `key` to the start of the open file `fd`, in parallel chunks. If
+ * `extended` is set lagrange_1_fft is written too (computed first if `key` does not hold it), so that nothing about
+ * the circuit has to be recomputed before a loaded key can prove.
+ */
+void write_key_file(int fd, proving_key const& key, bool extended = false);
+void write_key_file(std::string const& path, proving_key const& key, bool extended = false);
+
+/**
+ * @brief Read just the header (the key's metadata and polynomial index) of a key file.
+ */
+key_file_header read_key_file_header(int fd);
+
+/**
+ * @brief Read a key file into `key`, copying the polynomials into memory in parallel chunks.
+ */
+void read_key_file(int fd, proving_key_data& key);
+
+/**
+ * @brief Read a key file into `key`. If `map` is set the polynomials are mmapped read-only from the file instead of
+ * copied, in which case the file must not change while the key is alive.
+ */
+void read_key_file(std::string const& path, proving_key_data& key, bool map = false);
+
+/**
+ * @brief Write `num_bytes` of `data` to `fd` at `offset`, in chunks spread over the thread pool.
+ */
+void parallel_pwrite(int fd, const void* data, size_t num_bytes, uint64_t offset);
+
+/**
+ * @brief Read `num_bytes` from `fd` at `offset` into `data`, in chunks spread over the thread pool.
+ */
+void parallel_pread(int fd, void* data, size_t num_bytes, uint64_t offset);
+
+} // namespace proof_system::plonk
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "./transition_widget.hpp"
+#include "./turbo_arithmetic_widget.hpp"
+#include "./fixed_base_widget.hpp"
+#include "./turbo_range_widget.hpp"
+#include "./turbo_logic_widget.hpp"
+#include "./plookup_arithmetic_widget.hpp"
+#include "./genperm_sort_widget.hpp"
+#include "./elliptic_widget.hpp"
+#include "./plookup_auxiliary_widget.hpp"
+
+namespace proof_system::plonk {
+
+/**
+ * @brief All of the turbo plonk transition gates for the prover, evaluated in a single pass over the coset. The
+ * kernels are listed in the order their separate widgets used to be registered, which fixes their powers of α.
+ * @tparam Settings
+ */
+template <typename Settings>
+using ProverTurboTransitionWidget = widget::FusedTransitionWidget<barretenberg::fr,
+                                                                  Settings,
+                                                                  widget::TurboArithmeticKernel,
+                                                                  widget::TurboFixedBaseKernel,
+                                                                  widget::TurboRangeKernel,
+                                                                  widget::TurboLogicKernel>;
+
+/**
+ * @brief All of the ultra plonk transition gates for the prover, evaluated in a single pass over the coset. The
+ * kernels are listed in the order their separate widgets used to be registered, which fixes their powers of α.
+ * @tparam Settings
+ */
+template <typename Settings>
+using ProverUltraTransitionWidget = widget::FusedTransitionWidget<barretenberg::fr,
+                                                                  Settings,
+                                                                  widget::PlookupArithmeticKernel,
+                                                                  widget::GenPermSortKernel,
+                                                                  widget::EllipticKernel,
+                                                                  widget::PlookupAuxiliaryKernel>;
+
+} // namespace proof_system::plonk
@@ -3,7 +3,7 @@
 #include <array>
 #include <vector>
 #include <set>
-#include <unordered_map>
+#include <tuple>
 
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
 #include "../../types/prover_settings.hpp"
@@ -41,8 +41,10 @@ template <class Field, size_t num_widget_relations> struct challenge_array {
 
 template <class Field> using poly_array = std::array<std::pair<Field, Field>, PolynomialIndex::MAX_NUM_POLYNOMIALS>;
 
+// Indexed directly by PolynomialIndex: the kernels look a polynomial up for every value they read, and this keeps those
+// lookups free of hashing (and of any insertion when several threads share the map).
 template <class Field> struct poly_ptr_map {
-    std::unordered_map<PolynomialIndex, std::span<Field>> coefficients;
+    std::array<std::span<Field>, PolynomialIndex::MAX_NUM_POLYNOMIALS> coefficients;
     size_t block_mask;
     size_t index_shift;
 };
@@ -340,6 +342,96 @@ class TransitionWidget : public TransitionWidgetBase<Field> {
     }
 };
 
+/**
+ * @brief Computes the quotient contributions of several transition kernels in one pass over the large domain.
+ *
+ * @details The result is the same as registering a TransitionWidget for each kernel, in the order given: every kernel
+ * gets its own powers of α, continuing from the last power used by the kernel before it. But the polynomials are
+ * looked up once for all kernels, each row of the coset is visited once, and the kernels' contributions to a row are
+ * summed before the quotient part is updated, so the quotient is written once per row rather than once per kernel.
+ */
+template <class Field, class Settings, template <typename, typename, typename> typename... Kernels>
+class FusedTransitionWidget : public TransitionWidgetBase<Field> {
+  protected:
+    typedef containers::poly_ptr_map<Field> poly_ptr_map;
+    typedef containers::coefficient_array<Field> coefficient_array;
+
+    /**
+     * @brief One kernel of the fused widget, together with the challenges it was given.
+     */
+    template <template <typename, typename, typename> typename KernelBase> struct Stage {
+        static constexpr size_t num_independent_relations = KernelBase<int, int, int>::num_independent_relations;
+        typedef containers::challenge_array<Field, num_independent_relations> challenge_array;
+        typedef getters::FFTGetter<Field, transcript::StandardTranscript, Settings, num_independent_relations>
+            FFTGetter;
+        typedef KernelBase<Field, FFTGetter, poly_ptr_map> FFTKernel;
+
+        challenge_array challenges;
+
+        Field get_challenges(const transcript::StandardTranscript& transcript, const Field& alpha_base)
+        {
+            challenges = FFTGetter::get_challenges(transcript, alpha_base, FFTKernel::quotient_required_challenges);
+            return FFTGetter::update_alpha(challenges, num_independent_relations);
+        }
+
+        inline void accumulate(poly_ptr_map& polynomials, Field& quotient, const size_t i) const
+        {
+            coefficient_array linear_terms;
+            FFTKernel::compute_linear_terms(polynomials, challenges, linear_terms, i);
+            quotient += FFTKernel::sum_linear_terms(polynomials, challenges, linear_terms, i);
+            FFTKernel::compute_non_linear_terms(polynomials, challenges, quotient, i);
+        }
+    };
+
+    // get_polynomials does not depend on the number of relations
+    typedef getters::FFTGetter<Field, transcript::StandardTranscript, Settings, 1> FFTGetter;
+
+  public:
+    FusedTransitionWidget(proving_key* _key = nullptr)
+        : TransitionWidgetBase<Field>(_key){};
+    FusedTransitionWidget(const FusedTransitionWidget& other)
+        : TransitionWidgetBase<Field>(other){};
+    FusedTransitionWidget(FusedTransitionWidget&& other)
+        : TransitionWidgetBase<Field>(other){};
+    FusedTransitionWidget& operator=(const FusedTransitionWidget& other)
+    {
+        TransitionWidgetBase<Field>::operator=(other);
+        return *this;
+    };
+    FusedTransitionWidget& operator=(FusedTransitionWidget&& other)
+    {
+        TransitionWidgetBase<Field>::operator=(other);
+        return *this;
+    };
+
+    Field compute_quotient_contribution(const Field& alpha_base,
+                                        const transcript::StandardTranscript& transcript) override
+    {
+        auto* key = TransitionWidgetBase<Field>::key;
+
+        std::set<PolynomialIndex> required_polynomial_ids;
+        (required_polynomial_ids.insert(Stage<Kernels>::FFTKernel::get_required_polynomial_ids().begin(),
+                                        Stage<Kernels>::FFTKernel::get_required_polynomial_ids().end()),
+         ...);
+        poly_ptr_map polynomials = FFTGetter::get_polynomials(key, required_polynomial_ids);
+
+        // The comma fold runs left to right, so the powers of α are handed out in kernel order.
+        std::tuple<Stage<Kernels>...> stages;
+        Field alpha = alpha_base;
+        std::apply([&](auto&... stage) { ((alpha = stage.get_challenges(transcript, alpha)), ...); }, stages);
+
+        ITERATE_OVER_DOMAIN_START(key->large_domain);
+        Field contribution = Field(0);
+        std::apply([&](const auto&... stage) { (stage.accumulate(polynomials, contribution, i), ...); }, stages);
+
+        // populate split quotient components
+        key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)] += contribution;
+        ITERATE_OVER_DOMAIN_END;
+
+        return alpha;
+    }
+};
+
 template <class Field, class Transcript, class Settings, template <typename, typename, typename> typename KernelBase>
 class GenericVerifierWidget {
   protected:
@@ -13,6 +13,38 @@
 
 namespace barretenberg {
 
+#ifndef __wasm__
+namespace {
+/**
+ * @brief Map `num_bytes` of `fd` at `offset` read only, followed by zeroed memory up to `capacity_bytes`.
+ *
+ * @details Mapping the whole capacity from the file would expose whatever follows the polynomial in the file, and
+ * raise SIGBUS on reading a page that lies entirely past the end of the file. So the capacity is reserved with an
+ * anonymous mapping, the file is mapped over its start, and the bytes past `num_bytes` are zeroed (which copies at
+ * most the last page of the file). The whole range is released by a single munmap.
+ */
+void* map_coefficients(int fd, size_t offset, size_t num_bytes, size_t capacity_bytes)
+{
+    void* reserved = mmap(nullptr, capacity_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == MAP_FAILED) {
+        throw_or_abort("Failed to reserve memory for a mapped polynomial");
+    }
+    if (num_bytes > 0 && mmap(reserved,
+                              num_bytes,
+                              PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_FIXED,
+                              fd,
+                              static_cast<off_t>(offset)) == MAP_FAILED) {
+        munmap(reserved, capacity_bytes);
+        throw_or_abort("Failed to mmap polynomial at offset " + std::to_string(offset));
+    }
+    memset(static_cast<uint8_t*>(reserved) + num_bytes, 0, capacity_bytes - num_bytes);
+    mprotect(reserved, capacity_bytes, PROT_READ);
+    return reserved;
+}
+} // namespace
+#endif
+
 /**
  * Constructors / Destructors
  **/
@@ -24,18 +56,35 @@ Polynomial<Fr>::Polynomial(std::string const& filename)
     if (stat(filename.c_str(), &st) != 0) {
         throw_or_abort("Filename not found: " + filename);
     }
-    size_t len = (size_t)st.st_size;
-    size_ = len / sizeof(Fr);
+    size_ = (size_t)st.st_size / sizeof(Fr);
+    const size_t len = size_ * sizeof(Fr);
     int fd = open(filename.c_str(), O_RDONLY);
 #ifndef __wasm__
-    coefficients_ = (Fr*)mmap(0, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The coefficient past the end, which a shifted polynomial reads, is zero rather than beyond the file.
+    coefficients_ = static_cast<Fr*>(map_coefficients(fd, 0, len, capacity() * sizeof(Fr)));
 #else
-    coefficients_ = allocate_aligned_memory(len);
+    coefficients_ = allocate_aligned_memory(capacity() * sizeof(Fr));
     ::read(fd, (void*)coefficients_, len);
+    zero_memory_beyond(size_);
 #endif
     close(fd);
 }
 
+template <typename Fr>
+Polynomial<Fr>::Polynomial(int fd, size_t offset, size_t initial_size)
+    : size_(initial_size)
+    , mapped_(true)
+{
+    const size_t len = size_ * sizeof(Fr);
+#ifndef __wasm__
+    coefficients_ = static_cast<Fr*>(map_coefficients(fd, offset, len, capacity() * sizeof(Fr)));
+#else
+    coefficients_ = allocate_aligned_memory(capacity() * sizeof(Fr));
+    ::pread(fd, (void*)coefficients_, len, static_cast<off_t>(offset));
+    zero_memory_beyond(size_);
+#endif
+}
+
 template <typename Fr>
 Polynomial<Fr>::Polynomial(const size_t size_)
     : coefficients_(nullptr)
@@ -151,9 +200,9 @@ template <typename Fr> void Polynomial<Fr>::free()
     if (coefficients_ != nullptr) {
 #ifndef __wasm__
         if (mapped_) {
-            munmap(coefficients_, size_ * sizeof(Fr));
+            munmap(coefficients_, capacity() * sizeof(Fr));
         } else {
-            aligned_free(coefficients_);
+            polynomial_memory::release(coefficients_);
         }
 #else
         aligned_free(coefficients_);
@@ -279,12 +328,15 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(std::span<const Fr> other
     const size_t other_size = other.size();
     ASSERT(in_place_operation_viable(other_size));
 
-    /** TODO parallelize using some kind of generic evaluation domain
-     *  we really only need to know the thread size, but we don't need all the FFT roots
-     */
-    for (size_t i = 0; i < other_size; ++i) {
-        coefficients_[i] += scaling_factor * other[i];
-    }
+    constexpr size_t min_iterations_per_chunk = 1 << 10;
+    parallel_for_range(
+        other_size,
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                coefficients_[i] += scaling_factor * other[i];
+            }
+        },
+        min_iterations_per_chunk);
 }
 
 template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(std::span<const Fr> other)
@@ -364,7 +416,7 @@ template <typename Fr> Fr Polynomial<Fr>::evaluate_mle(std::span<const Fr> evalu
     }
     Fr result = tmp[0];
     // free the temporary buffer
-    aligned_free(tmp);
+    polynomial_memory::release(tmp);
     return result;
 }
 
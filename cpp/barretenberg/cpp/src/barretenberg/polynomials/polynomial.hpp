@@ -8,13 +8,18 @@
 #include <concepts>
 #include <span>
 #include "polynomial_arithmetic.hpp"
+#include "polynomial_memory.hpp"
 
 namespace barretenberg {
 template <typename Fr> class Polynomial {
   public:
-    // Creates a read only polynomial using mmap.
+    // Creates a read only polynomial using mmap. The coefficient past the end is zero, as for any other polynomial.
     Polynomial(std::string const& filename);
 
+    // Creates a read only polynomial by mmapping `initial_size` coefficients of the open file `fd`, starting at the
+    // page aligned byte `offset`. Nothing past those coefficients is read from the file. The mapping outlives `fd`.
+    Polynomial(int fd, size_t offset, size_t initial_size);
+
     Polynomial(const size_t initial_size);
     Polynomial(const Polynomial& other, const size_t target_size = 0);
 
@@ -117,7 +122,10 @@ template <typename Fr> class Polynomial {
     // safety check for in place operations
     bool in_place_operation_viable(size_t domain_size = 0) { return !mapped() && (size() >= domain_size); }
 
-    Fr* allocate_aligned_memory(const size_t size) const { return static_cast<Fr*>(aligned_alloc(sizeof(Fr), size)); }
+    Fr* allocate_aligned_memory(const size_t size) const
+    {
+        return static_cast<Fr*>(polynomial_memory::allocate(sizeof(Fr), size));
+    }
 
     /**
      * @brief Returns an std::span of the left-shift of self.
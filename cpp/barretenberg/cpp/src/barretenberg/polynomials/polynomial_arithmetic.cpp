@@ -2,6 +2,7 @@
 #include "iterate_over_domain.hpp"
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/mem.hpp"
+#include <algorithm>
 #include <math.h>
 #include <memory.h>
 #include "barretenberg/numeric/bitop/get_msb.hpp"
@@ -118,10 +119,7 @@ void scale_by_generator(Fr* coeffs,
                         const Fr& generator_shift,
                         const size_t generator_size)
 {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < domain.num_threads; ++j) {
+    parallel_for(domain.num_threads, [&](size_t j) {
         Fr thread_shift = generator_shift.pow(static_cast<uint64_t>(j * (generator_size / domain.num_threads)));
         Fr work_generator = generator_start * thread_shift;
         const size_t offset = j * (generator_size / domain.num_threads);
@@ -130,7 +128,7 @@ void scale_by_generator(Fr* coeffs,
             target[i] = coeffs[i] * work_generator;
             work_generator *= generator_shift;
         }
-    }
+    });
 }
 /**
  * Compute multiplicative subgroup (g.X)^n.
@@ -179,127 +177,116 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
     const size_t poly_mask = poly_size - 1;
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
 
-#ifndef NO_MULTITHREADING
-#pragma omp parallel
-#endif
-    {
-// First FFT round is a special case - no need to multiply by root table, because all entries are 1.
-// We also combine the bit reversal step into the first round, to avoid a redundant round of copying data
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-        for (size_t j = 0; j < domain.num_threads; ++j) {
-            Fr temp_1;
-            Fr temp_2;
-            for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-                uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-                uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-                __builtin_prefetch(&coeffs[next_index_1]);
-                __builtin_prefetch(&coeffs[next_index_2]);
-
-                uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-                uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
-
-                size_t poly_idx_1 = swap_index_1 >> log2_poly_size;
-                size_t elem_idx_1 = swap_index_1 & poly_mask;
-                size_t poly_idx_2 = swap_index_2 >> log2_poly_size;
-                size_t elem_idx_2 = swap_index_2 & poly_mask;
-
-                Fr::__copy(coeffs[poly_idx_1][elem_idx_1], temp_1);
-                Fr::__copy(coeffs[poly_idx_2][elem_idx_2], temp_2);
-                scratch_space[i + 1] = temp_1 - temp_2;
-                scratch_space[i] = temp_1 + temp_2;
-            }
+    // First FFT round is a special case - no need to multiply by root table, because all entries are 1.
+    // We also combine the bit reversal step into the first round, to avoid a redundant round of copying data
+    parallel_for(domain.num_threads, [&](size_t j) {
+        Fr temp_1;
+        Fr temp_2;
+        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
+            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
+            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
+            __builtin_prefetch(&coeffs[next_index_1]);
+            __builtin_prefetch(&coeffs[next_index_2]);
+
+            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
+            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
+
+            size_t poly_idx_1 = swap_index_1 >> log2_poly_size;
+            size_t elem_idx_1 = swap_index_1 & poly_mask;
+            size_t poly_idx_2 = swap_index_2 >> log2_poly_size;
+            size_t elem_idx_2 = swap_index_2 & poly_mask;
+
+            Fr::__copy(coeffs[poly_idx_1][elem_idx_1], temp_1);
+            Fr::__copy(coeffs[poly_idx_2][elem_idx_2], temp_2);
+            scratch_space[i + 1] = temp_1 - temp_2;
+            scratch_space[i] = temp_1 + temp_2;
         }
+    });
 
-        // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-        // reduce + copy
-        if (domain.size <= 2) {
-            coeffs[0][0] = scratch_space[0];
-            coeffs[0][1] = scratch_space[1];
-        }
+    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
+    // reduce + copy
+    if (domain.size <= 2) {
+        coeffs[0][0] = scratch_space[0];
+        coeffs[0][1] = scratch_space[1];
+    }
 
-        // outer FFT loop
-        for (size_t m = 2; m < (domain.size); m <<= 1) {
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-            for (size_t j = 0; j < domain.num_threads; ++j) {
-                Fr temp;
-
-                // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-                // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-                // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-                // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-                // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-                // directly access the roots of unity lookup table
-                const size_t start = j * (domain.thread_size >> 1);
-                const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-                // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-                // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-                //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-                //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-                //      roots of unity
-                // i.e. each successive FFT round will double the set of roots that we need to index.
-                // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-                // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-                // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-                // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-                // iterations, we loop back to the start.
-
-                // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-                // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-                // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-                // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-                // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-                // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-                const size_t block_mask = m - 1;
-
-                // The next problem to tackle, is we now need to efficiently index the polynomial element in
-                // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-                // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-                // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-                // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-                // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-                // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-                // block_mask)`
-                const size_t index_mask = ~block_mask;
-
-                // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-                // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-                // all 1).
-                const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-                // Finally, we want to treat the final round differently from the others,
-                // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-                // `scratch_space`
-                if (m != (domain.size >> 1)) {
-                    for (size_t i = start; i < end; ++i) {
-                        size_t k1 = (i & index_mask) << 1;
-                        size_t j1 = i & block_mask;
-                        temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                        scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
-                        scratch_space[k1 + j1] += temp;
-                    }
-                } else {
-                    for (size_t i = start; i < end; ++i) {
-                        size_t k1 = (i & index_mask) << 1;
-                        size_t j1 = i & block_mask;
-
-                        size_t poly_idx_1 = (k1 + j1) >> log2_poly_size;
-                        size_t elem_idx_1 = (k1 + j1) & poly_mask;
-                        size_t poly_idx_2 = (k1 + j1 + m) >> log2_poly_size;
-                        size_t elem_idx_2 = (k1 + j1 + m) & poly_mask;
-
-                        temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                        coeffs[poly_idx_2][elem_idx_2] = scratch_space[k1 + j1] - temp;
-                        coeffs[poly_idx_1][elem_idx_1] = scratch_space[k1 + j1] + temp;
-                    }
+    // outer FFT loop
+    for (size_t m = 2; m < (domain.size); m <<= 1) {
+        parallel_for(domain.num_threads, [&](size_t j) {
+            Fr temp;
+
+            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
+            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
+            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
+            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
+
+            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
+            // directly access the roots of unity lookup table
+            const size_t start = j * (domain.thread_size >> 1);
+            const size_t end = (j + 1) * (domain.thread_size >> 1);
+
+            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
+            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
+            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
+            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
+            //      roots of unity
+            // i.e. each successive FFT round will double the set of roots that we need to index.
+            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
+            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
+            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
+            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
+            // iterations, we loop back to the start.
+
+            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
+            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
+            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
+            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
+            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
+            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
+            const size_t block_mask = m - 1;
+
+            // The next problem to tackle, is we now need to efficiently index the polynomial element in
+            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
+            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
+            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
+            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
+            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
+            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
+            // block_mask)`
+            const size_t index_mask = ~block_mask;
+
+            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
+            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
+            // all 1).
+            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+
+            // Finally, we want to treat the final round differently from the others,
+            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
+            // `scratch_space`
+            if (m != (domain.size >> 1)) {
+                for (size_t i = start; i < end; ++i) {
+                    size_t k1 = (i & index_mask) << 1;
+                    size_t j1 = i & block_mask;
+                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
+                    scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
+                    scratch_space[k1 + j1] += temp;
+                }
+            } else {
+                for (size_t i = start; i < end; ++i) {
+                    size_t k1 = (i & index_mask) << 1;
+                    size_t j1 = i & block_mask;
+
+                    size_t poly_idx_1 = (k1 + j1) >> log2_poly_size;
+                    size_t elem_idx_1 = (k1 + j1) & poly_mask;
+                    size_t poly_idx_2 = (k1 + j1 + m) >> log2_poly_size;
+                    size_t elem_idx_2 = (k1 + j1 + m) & poly_mask;
+
+                    temp = round_roots[j1] * scratch_space[k1 + j1 + m];
+                    coeffs[poly_idx_2][elem_idx_2] = scratch_space[k1 + j1] - temp;
+                    coeffs[poly_idx_1][elem_idx_1] = scratch_space[k1 + j1] + temp;
                 }
             }
-        }
+        });
     }
 }
 
@@ -307,106 +294,95 @@ template <typename Fr>
 void fft_inner_parallel(
     Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
 {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel
-#endif
-    {
-// First FFT round is a special case - no need to multiply by root table, because all entries are 1.
-// We also combine the bit reversal step into the first round, to avoid a redundant round of copying data
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-        for (size_t j = 0; j < domain.num_threads; ++j) {
-            Fr temp_1;
-            Fr temp_2;
-            for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
-                uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
-                uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
-                __builtin_prefetch(&coeffs[next_index_1]);
-                __builtin_prefetch(&coeffs[next_index_2]);
-
-                uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
-                uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
-
-                Fr::__copy(coeffs[swap_index_1], temp_1);
-                Fr::__copy(coeffs[swap_index_2], temp_2);
-                target[i + 1] = temp_1 - temp_2;
-                target[i] = temp_1 + temp_2;
-            }
+    // First FFT round is a special case - no need to multiply by root table, because all entries are 1.
+    // We also combine the bit reversal step into the first round, to avoid a redundant round of copying data
+    parallel_for(domain.num_threads, [&](size_t j) {
+        Fr temp_1;
+        Fr temp_2;
+        for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
+            uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
+            uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
+            __builtin_prefetch(&coeffs[next_index_1]);
+            __builtin_prefetch(&coeffs[next_index_2]);
+
+            uint32_t swap_index_1 = (uint32_t)reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
+            uint32_t swap_index_2 = (uint32_t)reverse_bits((uint32_t)i + 1, (uint32_t)domain.log2_size);
+
+            Fr::__copy(coeffs[swap_index_1], temp_1);
+            Fr::__copy(coeffs[swap_index_2], temp_2);
+            target[i + 1] = temp_1 - temp_2;
+            target[i] = temp_1 + temp_2;
         }
+    });
 
-        // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
-        // reduce + copy
-        if (domain.size <= 2) {
-            coeffs[0] = target[0];
-            coeffs[1] = target[1];
-        }
+    // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
+    // reduce + copy
+    if (domain.size <= 2) {
+        coeffs[0] = target[0];
+        coeffs[1] = target[1];
+    }
 
-        // outer FFT loop
-        for (size_t m = 2; m < (domain.size); m <<= 1) {
-#ifndef NO_MULTITHREADING
-#pragma omp for
-#endif
-            for (size_t j = 0; j < domain.num_threads; ++j) {
-                Fr temp;
-
-                // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-                // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-                // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-                // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-                // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-                // directly access the roots of unity lookup table
-                const size_t start = j * (domain.thread_size >> 1);
-                const size_t end = (j + 1) * (domain.thread_size >> 1);
-
-                // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-                // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-                //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-                //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-                //      roots of unity
-                // i.e. each successive FFT round will double the set of roots that we need to index.
-                // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-                // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-                // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-                // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-                // iterations, we loop back to the start.
-
-                // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-                // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-                // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-                // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-                // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-                // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-                const size_t block_mask = m - 1;
-
-                // The next problem to tackle, is we now need to efficiently index the polynomial element in
-                // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-                // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-                // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-                // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-                // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-                // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-                // block_mask)`
-                const size_t index_mask = ~block_mask;
-
-                // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-                // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-                // all 1).
-                const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-                // Finally, we want to treat the final round differently from the others,
-                // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-                // `scratch_space`
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-                    temp = round_roots[j1] * target[k1 + j1 + m];
-                    target[k1 + j1 + m] = target[k1 + j1] - temp;
-                    target[k1 + j1] += temp;
-                }
+    // outer FFT loop
+    for (size_t m = 2; m < (domain.size); m <<= 1) {
+        parallel_for(domain.num_threads, [&](size_t j) {
+            Fr temp;
+
+            // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
+            // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
+            // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
+            // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
+
+            // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
+            // directly access the roots of unity lookup table
+            const size_t start = j * (domain.thread_size >> 1);
+            const size_t end = (j + 1) * (domain.thread_size >> 1);
+
+            // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
+            // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
+            //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
+            //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
+            //      roots of unity
+            // i.e. each successive FFT round will double the set of roots that we need to index.
+            // We have already laid out the `root_table` container so that each FFT round's roots are linearly
+            // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
+            // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
+            // of size x, the first x iterations will index the subgroup elements in order, then for the next x
+            // iterations, we loop back to the start.
+
+            // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
+            // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
+            // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
+            // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
+            // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
+            // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
+            const size_t block_mask = m - 1;
+
+            // The next problem to tackle, is we now need to efficiently index the polynomial element in
+            // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
+            // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
+            // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
+            // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
+            // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
+            // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
+            // block_mask)`
+            const size_t index_mask = ~block_mask;
+
+            // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
+            // our indexer, because we don't store the precomputed root values for the 1st round (because they're
+            // all 1).
+            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+
+            // Finally, we want to treat the final round differently from the others,
+            // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
+            // `scratch_space`
+            for (size_t i = start; i < end; ++i) {
+                size_t k1 = (i & index_mask) << 1;
+                size_t j1 = i & block_mask;
+                temp = round_roots[j1] * target[k1 + j1 + m];
+                target[k1 + j1 + m] = target[k1 + j1] - temp;
+                target[k1 + j1] += temp;
             }
-        }
+        });
     }
 }
 
@@ -649,10 +625,7 @@ void coset_fft(Fr* coeffs,
     }
 
     if (domain_extension == 4) {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-        for (size_t j = 0; j < domain.num_threads; ++j) {
+        parallel_for(domain.num_threads, [&](size_t j) {
             const size_t start = j * domain.thread_size;
             const size_t end = (j + 1) * domain.thread_size;
             for (size_t i = start; i < end; ++i) {
@@ -661,7 +634,7 @@ void coset_fft(Fr* coeffs,
                 Fr::__copy(scratch_space[i + (2UL << domain.log2_size)], coeffs[(i << 2UL) + 2UL]);
                 Fr::__copy(scratch_space[i + (3UL << domain.log2_size)], coeffs[(i << 2UL) + 3UL]);
             }
-        }
+        });
         for (size_t i = 0; i < domain.size; ++i) {
             for (size_t j = 0; j < domain_extension; ++j) {
                 Fr::__copy(scratch_space[i + (j << domain.log2_size)], coeffs[(i << log2_domain_extension) + j]);
@@ -747,18 +720,12 @@ void mul(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationD
 
 template <typename Fr> Fr evaluate(const Fr* coeffs, const Fr& z, const size_t n)
 {
-#ifndef NO_MULTITHREADING
-    size_t num_threads = max_threads::compute_num_threads();
-#else
-    size_t num_threads = 1;
-#endif
+    // The final chunk absorbs the leftovers, so there is no need to round the number of threads to a power of two.
+    size_t num_threads = max_threads::compute_num_cpus();
     size_t range_per_thread = n / num_threads;
     size_t leftovers = n - (range_per_thread * num_threads);
     Fr* evaluations = new Fr[num_threads];
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < num_threads; ++j) {
+    parallel_for(num_threads, [&](size_t j) {
         Fr z_acc = z.pow(static_cast<uint64_t>(j * range_per_thread));
         size_t offset = j * range_per_thread;
         evaluations[j] = Fr::zero();
@@ -768,7 +735,7 @@ template <typename Fr> Fr evaluate(const Fr* coeffs, const Fr& z, const size_t n
             evaluations[j] += work_var;
             z_acc *= z;
         }
-    }
+    });
 
     Fr r = Fr::zero();
     for (size_t j = 0; j < num_threads; ++j) {
@@ -784,18 +751,11 @@ template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, c
     const size_t poly_size = large_n / num_polys;
     ASSERT(is_power_of_two(poly_size));
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
-#ifndef NO_MULTITHREADING
-    size_t num_threads = max_threads::compute_num_threads();
-#else
-    size_t num_threads = 1;
-#endif
+    size_t num_threads = max_threads::compute_num_cpus();
     size_t range_per_thread = large_n / num_threads;
     size_t leftovers = large_n - (range_per_thread * num_threads);
     Fr* evaluations = new Fr[num_threads];
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t j = 0; j < num_threads; ++j) {
+    parallel_for(num_threads, [&](size_t j) {
         Fr z_acc = z.pow(static_cast<uint64_t>(j * range_per_thread));
         size_t offset = j * range_per_thread;
         evaluations[j] = Fr::zero();
@@ -805,7 +765,7 @@ template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, c
             evaluations[j] += work_var;
             z_acc *= z;
         }
-    }
+    });
 
     Fr r = Fr::zero();
     for (size_t j = 0; j < num_threads; ++j) {
@@ -857,11 +817,8 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
     // Step 1: Compute the 1/denominator for each evaluation: 1 / (X_i - 1)
     Fr multiplicand = target_domain.root; // kn'th root of unity w'
 
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
     // First compute X_i - 1, i = 0,...,kn-1
-    for (size_t j = 0; j < target_domain.num_threads; ++j) {
+    parallel_for(target_domain.num_threads, [&](size_t j) {
         const Fr root_shift = multiplicand.pow(static_cast<uint64_t>(j * target_domain.thread_size));
         Fr work_root = src_domain.generator * root_shift; // g.(w')^{j*thread_size}
         size_t offset = j * target_domain.thread_size;
@@ -869,7 +826,7 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
             l_1_coefficients[i] = work_root - Fr::one(); // (w')^{j*thread_size + i}.g - 1
             work_root *= multiplicand;                   // (w')^{j*thread_size + i + 1}
         }
-    }
+    });
 
     // Compute 1/(X_i - 1) using Montgomery batch inversion
     Fr::batch_invert(l_1_coefficients, target_domain.size);
@@ -890,18 +847,80 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
     // Step 3: Construct L_1(X_i) by multiplying the 1/denominator evaluations in
     // l_1_coefficients by the numerator evaluations in subgroup_roots
     size_t subgroup_mask = subgroup_size - 1;
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-    for (size_t i = 0; i < target_domain.num_threads; ++i) {
+    parallel_for(target_domain.num_threads, [&](size_t i) {
         for (size_t j = 0; j < target_domain.thread_size; ++j) {
             size_t eval_idx = i * target_domain.thread_size + j;
             l_1_coefficients[eval_idx] *= subgroup_roots[eval_idx & subgroup_mask];
         }
-    }
+    });
     delete[] subgroup_roots;
 }
 
+template <typename Fr>
+void add_lagrange_basis_multiple(Fr* coeffs,
+                                 Fr* coset_values,
+                                 const Fr* l_1_coset_values,
+                                 const size_t index,
+                                 const Fr& delta,
+                                 const EvaluationDomain<Fr>& small_domain,
+                                 const EvaluationDomain<Fr>& large_domain)
+{
+    // L_i(X) = (1/n) * sum_j (ω^{-i}.X)^j, so coefficient j moves by delta * ω^{-ij} / n.
+    const Fr step = small_domain.root_inverse.pow(static_cast<uint64_t>(index));
+    parallel_for(small_domain.num_threads, [&](size_t j) {
+        const size_t start = j * small_domain.thread_size;
+        Fr work_root = step.pow(static_cast<uint64_t>(start)) * delta * small_domain.domain_inverse;
+        for (size_t k = start; k < start + small_domain.thread_size; ++k) {
+            coeffs[k] += work_root;
+            work_root *= step;
+        }
+    });
+
+    // L_i(X) = L_1(ω^{-i}.X), and ω is the (large / small)'th power of the large domain's root, so on the coset
+    // L_i(g.ω'^m) = L_1(g.ω'^{m - shift}).
+    const size_t shift = (large_domain.size / small_domain.size) * index;
+    parallel_for(large_domain.num_threads, [&](size_t j) {
+        const size_t start = j * large_domain.thread_size;
+        size_t source = (start + large_domain.size - shift) & (large_domain.size - 1);
+        for (size_t k = start; k < start + large_domain.thread_size; ++k) {
+            coset_values[k] += delta * l_1_coset_values[source];
+            source = (source + 1) & (large_domain.size - 1);
+        }
+    });
+}
+
+template <typename Fr>
+void rotate_lagrange_values(Fr* coeffs,
+                            Fr* coset_values,
+                            const size_t shift,
+                            const Fr& scale,
+                            const EvaluationDomain<Fr>& small_domain,
+                            const EvaluationDomain<Fr>& large_domain)
+{
+    // Coefficient j of p(ω^{-s}.X) is ω^{-sj} times that of p(X).
+    const Fr step = small_domain.root_inverse.pow(static_cast<uint64_t>(shift));
+    parallel_for(small_domain.num_threads, [&](size_t j) {
+        const size_t start = j * small_domain.thread_size;
+        Fr work_root = step.pow(static_cast<uint64_t>(start)) * scale;
+        for (size_t k = start; k < start + small_domain.thread_size; ++k) {
+            coeffs[k] *= work_root;
+            work_root *= step;
+        }
+    });
+
+    // On the coset, p(ω^{-s}.g.ω'^m) = p(g.ω'^{m - s.large/small}), a rotation of the evaluations.
+    const size_t coset_shift = ((large_domain.size / small_domain.size) * shift) & (large_domain.size - 1);
+    std::rotate(coset_values, coset_values + large_domain.size - coset_shift, coset_values + large_domain.size);
+    if (scale != Fr::one()) {
+        parallel_for(large_domain.num_threads, [&](size_t j) {
+            const size_t start = j * large_domain.thread_size;
+            for (size_t k = start; k < start + large_domain.thread_size; ++k) {
+                coset_values[k] *= scale;
+            }
+        });
+    }
+}
+
 template <typename Fr>
 void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
                                            const EvaluationDomain<Fr>& src_domain,
@@ -989,10 +1008,7 @@ void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
             }
         }
     } else {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-        for (size_t k = 0; k < target_domain.num_threads; ++k) {
+        parallel_for(target_domain.num_threads, [&](size_t k) {
             size_t offset = k * target_domain.thread_size;
             const Fr root_shift = target_domain.root.pow(static_cast<uint64_t>(offset));
             Fr work_root = src_domain.generator * root_shift;
@@ -1009,7 +1025,7 @@ void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
                     work_root *= target_domain.root;
                 }
             }
-        }
+        });
     }
     delete[] subgroup_roots;
 }
@@ -1392,6 +1408,10 @@ template void add<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 template void sub<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 template void mul<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 template void compute_lagrange_polynomial_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&);
+template void add_lagrange_basis_multiple<fr>(
+    fr*, fr*, const fr*, const size_t, const fr&, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&);
+template void rotate_lagrange_values<fr>(
+    fr*, fr*, const size_t, const fr&, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&);
 template void divide_by_pseudo_vanishing_polynomial<fr>(std::vector<fr*>,
                                                         const EvaluationDomain<fr>&,
                                                         const EvaluationDomain<fr>&,
@@ -1,5 +1,7 @@
 #pragma once
 #include "evaluation_domain.hpp"
+#include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 
 #ifndef NO_MULTITHREADING
 #include <omp.h>
@@ -99,6 +101,29 @@ void compute_lagrange_polynomial_fft(Fr* l_1_coefficients,
                                      const EvaluationDomain<Fr>& src_domain,
                                      const EvaluationDomain<Fr>& target_domain);
 
+// Add delta * L_{index}(X) to a polynomial held both as its coefficients over `small_domain` and as its coset
+// evaluations over `large_domain`. `l_1_coset_values` are the coset evaluations of L_1(X) computed by
+// compute_lagrange_polynomial_fft, which give those of L_{index}(X) by a shift. This costs O(large_domain.size), so a
+// handful of changed Lagrange values are cheaper to apply this way than by an ifft and a coset fft.
+template <typename Fr>
+void add_lagrange_basis_multiple(Fr* coeffs,
+                                 Fr* coset_values,
+                                 const Fr* l_1_coset_values,
+                                 const size_t index,
+                                 const Fr& delta,
+                                 const EvaluationDomain<Fr>& small_domain,
+                                 const EvaluationDomain<Fr>& large_domain);
+
+// Replace p(X) by scale * p(ω^{-shift}.X), in both the coefficient and coset evaluation forms. Over `small_domain` this
+// moves every value `shift` rows forward (wrapping around) and multiplies it by `scale`.
+template <typename Fr>
+void rotate_lagrange_values(Fr* coeffs,
+                            Fr* coset_values,
+                            const size_t shift,
+                            const Fr& scale,
+                            const EvaluationDomain<Fr>& small_domain,
+                            const EvaluationDomain<Fr>& large_domain);
+
 template <typename Fr>
 void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
                                            const EvaluationDomain<Fr>& src_domain,
@@ -195,16 +220,55 @@ template <typename Fr> void factor_roots(std::span<Fr> polynomial, const Fr& roo
 
         // For the simple case of one root we compute (−r)⁻¹ and
         Fr root_inverse = (-root).invert();
-        // set b₋₁ = 0
-        Fr temp = 0;
-        // We start multiplying lower coefficient by the inverse and subtracting those from highter coefficients
-        // Since (x - r) should divide the polynomial cleanly, we can guide division with lower coefficients
-        for (size_t i = 0; i < size - 1; ++i) {
-            // at the start of the loop, temp = bᵢ₋₁
-            // and we can compute bᵢ   = (aᵢ − bᵢ₋₁)⋅(−r)⁻¹
-            temp = (polynomial[i] - temp);
-            temp *= root_inverse;
-            polynomial[i] = temp;
+
+        // The recurrence bᵢ = (aᵢ − bᵢ₋₁)⋅(−r)⁻¹ is linear in bᵢ₋₁, so it can be split into chunks that run in
+        // parallel. Over a chunk [s, e), run it from b₋₁ = 0 to get b'ᵢ; then bᵢ = b'ᵢ + (r⁻¹)ⁱ⁻ˢ⁺¹⋅bₛ₋₁, where
+        // bₛ₋₁ is found from the last b' of the previous chunks. Every chunk but the first pays an extra
+        // multiplication per coefficient for the correction, so this only pays off on three or more threads.
+        constexpr size_t min_chunk_size = 1 << 12;
+        const size_t num_chunks = std::min(max_threads::compute_num_cpus(), (size - 1) / min_chunk_size);
+        if (num_chunks < 3) {
+            // set b₋₁ = 0
+            Fr temp = 0;
+            // We start multiplying lower coefficient by the inverse and subtracting those from highter coefficients
+            // Since (x - r) should divide the polynomial cleanly, we can guide division with lower coefficients
+            for (size_t i = 0; i < size - 1; ++i) {
+                // at the start of the loop, temp = bᵢ₋₁
+                // and we can compute bᵢ   = (aᵢ − bᵢ₋₁)⋅(−r)⁻¹
+                temp = (polynomial[i] - temp);
+                temp *= root_inverse;
+                polynomial[i] = temp;
+            }
+        } else {
+            const size_t chunk_size = (size - 1 + num_chunks - 1) / num_chunks;
+            auto chunk_start = [&](size_t j) { return std::min(j * chunk_size, size - 1); };
+
+            // b'ᵢ for every chunk
+            parallel_for(num_chunks, [&](size_t j) {
+                Fr temp = 0;
+                for (size_t i = chunk_start(j); i < chunk_start(j + 1); ++i) {
+                    temp = (polynomial[i] - temp);
+                    temp *= root_inverse;
+                    polynomial[i] = temp;
+                }
+            });
+
+            // bₛ₋₁ for every chunk, carried over from the previous chunk's last coefficient
+            const Fr minus_root_inverse = -root_inverse;
+            std::vector<Fr> carries(num_chunks, Fr::zero());
+            for (size_t j = 1; j < num_chunks; ++j) {
+                const size_t length = chunk_start(j) - chunk_start(j - 1);
+                carries[j] = polynomial[chunk_start(j) - 1] + minus_root_inverse.pow(length) * carries[j - 1];
+            }
+
+            // bᵢ = b'ᵢ + (r⁻¹)ⁱ⁻ˢ⁺¹⋅bₛ₋₁
+            parallel_for(num_chunks - 1, [&](size_t j) {
+                Fr correction = carries[j + 1] * minus_root_inverse;
+                for (size_t i = chunk_start(j + 1); i < chunk_start(j + 2); ++i) {
+                    polynomial[i] += correction;
+                    correction *= minus_root_inverse;
+                }
+            });
         }
     }
     polynomial[size - 1] = Fr::zero();
@@ -2,7 +2,10 @@
 #include <algorithm>
 #include "barretenberg/common/mem.hpp"
 #include <cstddef>
+#include <cstdio>
+#include <fcntl.h>
 #include <gtest/gtest.h>
+#include <unistd.h>
 #include <utility>
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
@@ -1131,6 +1134,28 @@ TEST(polynomials, factor_roots)
     test_case(3, 6);
 }
 
+TEST(polynomials, factor_roots_large)
+{
+    // Large enough for the division by a single root to be split across threads, when there are enough of them.
+    constexpr size_t N = 1 << 14;
+
+    polynomial poly(N);
+    for (size_t i = 0; i < N - 1; ++i) {
+        poly[i] = fr::random_element();
+    }
+    const fr root = fr::random_element();
+    poly[0] -= poly.evaluate(root);
+    EXPECT_EQ(poly.evaluate(root), fr::zero());
+
+    polynomial quotient(poly);
+    quotient.factor_roots(root);
+
+    // check that (t-r)q(t) == p(t)
+    fr t = fr::random_element();
+    EXPECT_EQ((t - root) * quotient.evaluate(t, N - 1), poly.evaluate(t, N));
+    EXPECT_EQ(quotient[N - 1], fr::zero());
+}
+
 TEST(polynomials, move_construct_and_assign)
 {
     // construct a poly with some arbitrary data
@@ -1194,3 +1219,39 @@ TEST(polynomials, default_construct_then_assign)
     }
     EXPECT_EQ(poly.size(), interesting_poly.size());
 }
+
+#ifndef __wasm__
+// A file of whole pages ends exactly where the polynomial does, so the coefficient past the end, which a shifted
+// polynomial reads, must come from memory other than the file.
+TEST(polynomials, mapped_polynomial_of_whole_pages)
+{
+    constexpr size_t num_coeffs = 4096 / sizeof(fr) * 2;
+    std::vector<fr> coefficients(num_coeffs);
+    for (auto& coeff : coefficients) {
+        coeff = fr::random_element();
+    }
+    const std::string path = "/tmp/bb_mapped_polynomial_test_" + std::to_string(getpid());
+    FILE* file = fopen(path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    fwrite(coefficients.data(), sizeof(fr), num_coeffs, file);
+    fclose(file);
+
+    polynomial from_file(path);
+    int fd = open(path.c_str(), O_RDONLY);
+    polynomial from_fd(fd, 4096, num_coeffs / 2);
+    close(fd);
+    unlink(path.c_str());
+
+    EXPECT_EQ(from_file.size(), num_coeffs);
+    EXPECT_TRUE(from_file.mapped());
+    for (size_t i = 0; i < num_coeffs; ++i) {
+        EXPECT_EQ(from_file[i], coefficients[i]);
+    }
+    EXPECT_EQ(from_file.data()[num_coeffs], fr(0));
+    EXPECT_EQ(from_fd.size(), num_coeffs / 2);
+    for (size_t i = 0; i < num_coeffs / 2; ++i) {
+        EXPECT_EQ(from_fd[i], coefficients[num_coeffs / 2 + i]);
+    }
+    EXPECT_EQ(from_fd.data()[num_coeffs / 2], fr(0));
+}
+#endif
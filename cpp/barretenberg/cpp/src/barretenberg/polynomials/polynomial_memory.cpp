@@ -0,0 +1,129 @@
+#include "polynomial_memory.hpp"
+#include "barretenberg/common/mem.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__linux__) && !defined(__wasm__)
+#include <map>
+#include <mutex>
+#include <sys/mman.h>
+#include <unistd.h>
+#define BB_SHARED_POLYNOMIAL_MEMORY
+#endif
+
+namespace barretenberg::polynomial_memory {
+
+namespace {
+std::atomic<bool> shared_mode = false;
+
+#ifdef BB_SHARED_POLYNOMIAL_MEMORY
+struct Region {
+    int fd;
+    size_t size;
+};
+
+// Shared allocations by start address.
+struct Registry {
+    std::mutex mutex;
+    std::map<uintptr_t, Region> regions;
+    // The size of `regions`, readable without the lock.
+    std::atomic<size_t> num_regions = 0;
+};
+
+Registry& registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+void* allocate_shared(const size_t num_bytes)
+{
+    const int fd = memfd_create("bb_polynomial", MFD_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+    if (ftruncate(fd, static_cast<off_t>(num_bytes)) != 0) {
+        close(fd);
+        return nullptr;
+    }
+    void* ptr = mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    registry().regions[reinterpret_cast<uintptr_t>(ptr)] = { fd, num_bytes };
+    registry().num_regions = registry().regions.size();
+    return ptr;
+}
+#endif
+} // namespace
+
+void set_shared(const bool shared)
+{
+    shared_mode = shared;
+}
+
+bool shared()
+{
+    return shared_mode;
+}
+
+void* allocate(const size_t alignment, const size_t num_bytes)
+{
+#ifdef BB_SHARED_POLYNOMIAL_MEMORY
+    if (shared_mode && num_bytes >= MIN_SHARED_ALLOCATION) {
+        if (void* ptr = allocate_shared(num_bytes)) {
+            return ptr;
+        }
+    }
+#endif
+    return aligned_alloc(alignment, num_bytes);
+}
+
+void release(void* ptr)
+{
+#ifdef BB_SHARED_POLYNOMIAL_MEMORY
+    // A shared allocation is registered before allocate() returns it, so when there are none `ptr` is on the heap.
+    if (registry().num_regions > 0) {
+        std::unique_lock<std::mutex> lock(registry().mutex);
+        const auto it = registry().regions.find(reinterpret_cast<uintptr_t>(ptr));
+        if (it != registry().regions.end()) {
+            const Region region = it->second;
+            registry().regions.erase(it);
+            registry().num_regions = registry().regions.size();
+            lock.unlock();
+            munmap(ptr, region.size);
+            close(region.fd);
+            return;
+        }
+    }
+#endif
+    aligned_free(ptr);
+}
+
+std::optional<SharedLocation> find_shared(const void* ptr, const size_t num_bytes)
+{
+#ifdef BB_SHARED_POLYNOMIAL_MEMORY
+    const auto address = reinterpret_cast<uintptr_t>(ptr);
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    const auto& regions = registry().regions;
+    auto it = regions.upper_bound(address);
+    if (it == regions.begin()) {
+        return std::nullopt;
+    }
+    --it;
+    const size_t offset = address - it->first;
+    if (offset > it->second.size || num_bytes > it->second.size - offset) {
+        return std::nullopt;
+    }
+    return SharedLocation{ it->second.fd, offset };
+#else
+    static_cast<void>(ptr);
+    static_cast<void>(num_bytes);
+    return std::nullopt;
+#endif
+}
+
+} // namespace barretenberg::polynomial_memory
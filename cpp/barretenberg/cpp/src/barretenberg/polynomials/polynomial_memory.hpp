@@ -0,0 +1,79 @@
+#pragma once
+#include <cstddef>
+#include <optional>
+
+/**
+ * @brief Where Polynomial coefficients are allocated.
+ *
+ * @details By default this is aligned heap memory. A prover that hands work to other processes (see
+ * proof_system/work_queue/remote_worker.hpp) can switch to shared memory instead: each large allocation is then its own
+ * memfd mapping, which another process can map from the descriptor without the data being copied. Allocations made
+ * before the switch stay on the heap, and the helpers below report them as not shared.
+ *
+ * Not available in WASM builds, where allocate() always uses the heap.
+ */
+namespace barretenberg::polynomial_memory {
+
+/**
+ * @brief Allocations smaller than this stay on the heap even in shared mode. Each shared allocation holds a file
+ * descriptor open, and copying a small polynomial costs less than handing it over.
+ */
+constexpr size_t MIN_SHARED_ALLOCATION = 1 << 16;
+
+/**
+ * @brief Allocate later polynomials in shared memory (or, with false, on the heap again).
+ */
+void set_shared(bool shared);
+
+bool shared();
+
+/**
+ * @brief Shared mode for the lifetime of the scope: the constructor switches it on and the destructor restores the mode
+ * it replaced.
+ */
+class SharedScope {
+  public:
+    SharedScope()
+        : previous(shared())
+    {
+        set_shared(true);
+    }
+    SharedScope(const SharedScope& other) = delete;
+    SharedScope(SharedScope&& other) = delete;
+    SharedScope& operator=(const SharedScope& other) = delete;
+    SharedScope& operator=(SharedScope&& other) = delete;
+    ~SharedScope() { set_shared(previous); }
+
+  private:
+    bool previous;
+};
+
+/**
+ * @brief Allocate `num_bytes` aligned to `alignment`, as aligned_alloc. Release with release().
+ *
+ * @details Shared allocations are page aligned. In shared mode, falls back to the heap if the shared memory cannot be
+ * created (e.g. when the process is out of file descriptors).
+ */
+void* allocate(size_t alignment, size_t num_bytes);
+
+/**
+ * @brief Release memory from allocate(), or from aligned_alloc. Only takes the lock on the shared allocations while
+ * some are live.
+ */
+void release(void* ptr);
+
+/**
+ * @brief The shared memory holding [ptr, ptr + num_bytes): a descriptor another process can map, and the byte offset
+ * of `ptr` within it. The descriptor stays owned by the allocation.
+ */
+struct SharedLocation {
+    int fd;
+    size_t offset;
+};
+
+/**
+ * @brief Locate [ptr, ptr + num_bytes) in shared memory, if it lies within a single shared allocation.
+ */
+std::optional<SharedLocation> find_shared(const void* ptr, size_t num_bytes);
+
+} // namespace barretenberg::polynomial_memory
@@ -1,5 +1,6 @@
 #pragma once
 #include "polynomial.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 
 namespace barretenberg {
 
@@ -12,16 +13,15 @@ template <typename B> inline void read(B& buf, polynomial& p)
     memcpy(&p[0], buf, size * sizeof(fr));
 
     if (!is_little_endian()) {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-        for (size_t i = 0; i < size; ++i) {
-            fr& c = p[i];
-            c.data[3] = __builtin_bswap64(c.data[3]);
-            c.data[2] = __builtin_bswap64(c.data[2]);
-            c.data[1] = __builtin_bswap64(c.data[1]);
-            c.data[0] = __builtin_bswap64(c.data[0]);
-        }
+        parallel_for_range(size, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                fr& c = p[i];
+                c.data[3] = __builtin_bswap64(c.data[3]);
+                c.data[2] = __builtin_bswap64(c.data[2]);
+                c.data[1] = __builtin_bswap64(c.data[1]);
+                c.data[0] = __builtin_bswap64(c.data[0]);
+            }
+        });
     }
     buf += size * sizeof(fr);
 }
@@ -52,16 +52,15 @@ inline void read(std::istream& is, polynomial& p)
     is.read((char*)&p[0], (std::streamsize)(size * sizeof(fr)));
 
     if (!is_little_endian()) {
-#ifndef NO_MULTITHREADING
-#pragma omp parallel for
-#endif
-        for (size_t i = 0; i < size; ++i) {
-            fr& c = p[i];
-            c.data[3] = __builtin_bswap64(c.data[3]);
-            c.data[2] = __builtin_bswap64(c.data[2]);
-            c.data[1] = __builtin_bswap64(c.data[1]);
-            c.data[0] = __builtin_bswap64(c.data[0]);
-        }
+        parallel_for_range(size, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                fr& c = p[i];
+                c.data[3] = __builtin_bswap64(c.data[3]);
+                c.data[2] = __builtin_bswap64(c.data[2]);
+                c.data[1] = __builtin_bswap64(c.data[1]);
+                c.data[0] = __builtin_bswap64(c.data[0]);
+            }
+        });
     }
 }
 
@@ -1,4 +1,6 @@
 #include "ultra_circuit_constructor.hpp"
+#include "barretenberg/common/counting_sort.hpp"
+#include "barretenberg/common/thread_pool.hpp"
 #include <unordered_set>
 #include <unordered_map>
 
@@ -651,27 +653,47 @@ void UltraCircuitConstructor::create_new_range_constraint(const uint32_t variabl
     list.variable_indices.emplace_back(variable_index);
 }
 
-void UltraCircuitConstructor::process_range_list(const RangeList& list)
+/**
+ * @brief Collect the values of the variables in a range list, in increasing order.
+ *
+ * @details This only reads witnesses, so the lists can be sorted concurrently. Satisfiable lists hold values no larger
+ * than their target range, which is usually at most DEFAULT_PLOOKUP_RANGE_SIZE, so they are counting sorted in time
+ * linear in the list size. Values from a wider range than that (or from an unsatisfiable list) fall back to std::sort
+ * when the range dwarfs the list.
+ */
+std::vector<uint64_t> UltraCircuitConstructor::sort_range_list(const RangeList& list) const
 {
-    assert_valid_variables(list.variable_indices);
-
-    ASSERT(list.variable_indices.size() > 0);
-    // go over variables
-    // for each variable, create mirror variable with same value - with tau tag
-    // need to make sure that, in original list, increments of at most 3
     std::vector<uint64_t> sorted_list;
     sorted_list.reserve(list.variable_indices.size());
+    uint64_t max_value = 0;
     for (const auto variable_index : list.variable_indices) {
         const auto& field_element = get_variable(variable_index);
         const uint64_t shrinked_value = field_element.from_montgomery_form().data[0];
         sorted_list.emplace_back(shrinked_value);
+        max_value = std::max(max_value, shrinked_value);
     }
 
-#ifdef NO_TBB
-    std::sort(sorted_list.begin(), sorted_list.end());
-#else
-    std::sort(std::execution::par_unseq, sorted_list.begin(), sorted_list.end());
-#endif
+    if (max_value <= std::max(static_cast<uint64_t>(DEFAULT_PLOOKUP_RANGE_SIZE), uint64_t(sorted_list.size()))) {
+        counting_sort(sorted_list, max_value);
+    } else {
+        std::sort(sorted_list.begin(), sorted_list.end());
+    }
+    return sorted_list;
+}
+
+void UltraCircuitConstructor::process_range_list(const RangeList& list)
+{
+    process_range_list(list, sort_range_list(list));
+}
+
+void UltraCircuitConstructor::process_range_list(const RangeList& list, const std::vector<uint64_t>& sorted_list)
+{
+    assert_valid_variables(list.variable_indices);
+
+    ASSERT(list.variable_indices.size() > 0);
+    // go over variables
+    // for each variable, create mirror variable with same value - with tau tag
+    // need to make sure that, in original list, increments of at most 3
     std::vector<uint32_t> indices;
 
     // list must be padded to a multipe of 4 and larger than 4 (gate_width)
@@ -692,8 +714,17 @@ void UltraCircuitConstructor::process_range_list(const RangeList& list)
 
 void UltraCircuitConstructor::process_range_lists()
 {
-    for (const auto& i : range_lists)
-        process_range_list(i.second);
+    // Sort every list up front, in parallel: adding the sorted values to the circuit has to be done in order.
+    std::vector<const RangeList*> lists;
+    for (const auto& i : range_lists) {
+        lists.push_back(&i.second);
+    }
+    std::vector<std::vector<uint64_t>> sorted_lists(lists.size());
+    parallel_for(lists.size(), [&](size_t i) { sorted_lists[i] = sort_range_list(*lists[i]); });
+
+    for (size_t i = 0; i < lists.size(); ++i) {
+        process_range_list(*lists[i], sorted_lists[i]);
+    }
 }
 
 /*
@@ -2081,6 +2112,33 @@ uint32_t UltraCircuitConstructor::read_ROM_array(const size_t rom_id, const uint
 //     return value_witnesses;
 // }
 
+namespace {
+/**
+ * @brief Order ROM records by index. Indices are bounded by the array size, so this is a counting sort (which keeps
+ * reads of the same cell in the order they were made).
+ */
+void sort_ROM_records(RomTranscript& rom_array)
+{
+    if (std::is_sorted(rom_array.records.begin(), rom_array.records.end())) {
+        return;
+    }
+    counting_sort(rom_array.records, rom_array.state.size(), [](const auto& record) { return record.index; });
+}
+
+/**
+ * @brief Order RAM records by index, then timestamp: a counting sort on the timestamps (bounded by the number of
+ * accesses), followed by a stable one on the indices (bounded by the array size).
+ */
+void sort_RAM_records(RamTranscript& ram_array)
+{
+    if (std::is_sorted(ram_array.records.begin(), ram_array.records.end())) {
+        return;
+    }
+    counting_sort(ram_array.records, ram_array.access_count, [](const auto& record) { return record.timestamp; });
+    counting_sort(ram_array.records, ram_array.state.size(), [](const auto& record) { return record.index; });
+}
+} // namespace
+
 /**
  * @brief Compute additional gates required to validate ROM reads. Called when generating the proving key
  *
@@ -2102,11 +2160,7 @@ void UltraCircuitConstructor::process_ROM_array(const size_t rom_id, const size_
         }
     }
 
-#ifdef NO_TBB
-    std::sort(rom_array.records.begin(), rom_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, rom_array.records.begin(), rom_array.records.end());
-#endif
+    sort_ROM_records(rom_array);
 
     for (const RomRecord& record : rom_array.records) {
         const auto index = record.index;
@@ -2188,11 +2242,7 @@ void UltraCircuitConstructor::process_RAM_array(const size_t ram_id, const size_
         }
     }
 
-#ifdef NO_TBB
-    std::sort(ram_array.records.begin(), ram_array.records.end());
-#else
-    std::sort(std::execution::par_unseq, ram_array.records.begin(), ram_array.records.end());
-#endif
+    sort_RAM_records(ram_array);
 
     // Iterate over all but final RAM record.
     for (size_t i = 0; i < ram_array.records.size(); ++i) {
@@ -2310,12 +2360,16 @@ void UltraCircuitConstructor::process_RAM_array(const size_t ram_id, const size_
 
 void UltraCircuitConstructor::process_ROM_arrays(const size_t gate_offset_from_public_inputs)
 {
+    // Arrays are sorted in parallel here; process_ROM_array then only re-sorts an array if it had to fill in
+    // uninitialized cells.
+    parallel_for(rom_arrays.size(), [&](size_t i) { sort_ROM_records(rom_arrays[i]); });
     for (size_t i = 0; i < rom_arrays.size(); ++i) {
         process_ROM_array(i, gate_offset_from_public_inputs);
     }
 }
 void UltraCircuitConstructor::process_RAM_arrays(const size_t gate_offset_from_public_inputs)
 {
+    parallel_for(ram_arrays.size(), [&](size_t i) { sort_RAM_records(ram_arrays[i]); });
     for (size_t i = 0; i < ram_arrays.size(); ++i) {
         process_RAM_array(i, gate_offset_from_public_inputs);
     }
@@ -0,0 +1,480 @@
+#ifndef __wasm__
+#include "remote_worker.hpp"
+
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/polynomials/evaluation_domain.hpp"
+#include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include "barretenberg/polynomials/polynomial_memory.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <map>
+#include <optional>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <utility>
+
+namespace proof_system::plonk::remote {
+
+namespace {
+
+/**
+ * @brief Sent once by the prover after connecting, together with the shared segment's file descriptor.
+ */
+struct Handshake {
+    uint64_t segment_size;
+};
+
+std::atomic<size_t> segment_counter = 0;
+
+void check(bool condition, const std::string& what)
+{
+    if (!condition) {
+        throw_or_abort("remote worker: " + what + ": " + std::strerror(errno));
+    }
+}
+
+/**
+ * @brief Log why the worker cannot serve, for run_worker to return false.
+ */
+bool report_failure(const std::string& what)
+{
+    info("remote worker: ", what, ": ", std::strerror(errno));
+    return false;
+}
+
+std::optional<sockaddr_un> make_address(const std::string& socket_path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        errno = ENAMETOOLONG;
+        return std::nullopt;
+    }
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+    return address;
+}
+
+bool read_exact(int fd, void* data, size_t num_bytes)
+{
+    auto* ptr = static_cast<uint8_t*>(data);
+    while (num_bytes > 0) {
+        ssize_t result = ::read(fd, ptr, num_bytes);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            return false;
+        }
+        ptr += result;
+        num_bytes -= static_cast<size_t>(result);
+    }
+    return true;
+}
+
+bool write_exact(int fd, const void* data, size_t num_bytes)
+{
+    const auto* ptr = static_cast<const uint8_t*>(data);
+    while (num_bytes > 0) {
+        ssize_t result = ::write(fd, ptr, num_bytes);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            return false;
+        }
+        ptr += result;
+        num_bytes -= static_cast<size_t>(result);
+    }
+    return true;
+}
+
+/**
+ * @brief Write `num_bytes` to the socket, passing the descriptor `fd` along with them unless it is negative. Returns
+ * false if the connection failed.
+ */
+bool send_message(int socket_fd, const void* data, size_t num_bytes, int fd)
+{
+    if (fd < 0) {
+        return write_exact(socket_fd, data, num_bytes);
+    }
+    iovec payload{ const_cast<void*>(data), num_bytes };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr message{};
+    message.msg_iov = &payload;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(header), &fd, sizeof(int));
+    ssize_t sent = 0;
+    do {
+        sent = ::sendmsg(socket_fd, &message, 0);
+    } while (sent < 0 && errno == EINTR);
+    if (sent <= 0) {
+        return false;
+    }
+    // The descriptor went with the first byte; any remainder is plain data.
+    return write_exact(socket_fd, static_cast<const uint8_t*>(data) + sent, num_bytes - static_cast<size_t>(sent));
+}
+
+/**
+ * @brief Read `num_bytes` from the socket, and the descriptor passed along with them if there is one (otherwise `fd`
+ * is set to -1). Returns false if the connection was closed.
+ */
+bool receive_message(int socket_fd, void* data, size_t num_bytes, int& fd)
+{
+    fd = -1;
+    iovec payload{ data, num_bytes };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr message{};
+    message.msg_iov = &payload;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    ssize_t received = 0;
+    do {
+        received = ::recvmsg(socket_fd, &message, MSG_CMSG_CLOEXEC);
+    } while (received < 0 && errno == EINTR);
+    if (received <= 0) {
+        return false;
+    }
+    for (cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header)) {
+        if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SCM_RIGHTS) {
+            std::memcpy(&fd, CMSG_DATA(header), sizeof(int));
+        }
+    }
+    if (read_exact(socket_fd, static_cast<uint8_t*>(data) + received, num_bytes - static_cast<size_t>(received))) {
+        return true;
+    }
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+    return false;
+}
+
+/**
+ * @brief A read only mapping of the start of another process's memory, from a descriptor passed with a request.
+ */
+class ReceivedMemory {
+  public:
+    ReceivedMemory(int fd, size_t num_bytes)
+        : fd(fd)
+    {
+        struct stat status {};
+        if (fd < 0 || ::fstat(fd, &status) != 0 || static_cast<size_t>(status.st_size) < num_bytes || num_bytes == 0) {
+            return;
+        }
+        // MAP_POPULATE sets up the page tables in one go; the pages themselves are already resident in the prover.
+        void* ptr = ::mmap(nullptr, num_bytes, PROT_READ, MAP_SHARED | MAP_POPULATE, fd, 0);
+        if (ptr != MAP_FAILED) {
+            data = ptr;
+            size = num_bytes;
+        }
+    }
+    ReceivedMemory(const ReceivedMemory& other) = delete;
+    ReceivedMemory& operator=(const ReceivedMemory& other) = delete;
+    ~ReceivedMemory()
+    {
+        if (data != nullptr) {
+            ::munmap(data, size);
+        }
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+
+    [[nodiscard]] bool valid() const { return data != nullptr; }
+    barretenberg::fr* elements() { return static_cast<barretenberg::fr*>(data); }
+
+  private:
+    int fd;
+    void* data = nullptr;
+    size_t size = 0;
+};
+
+class Worker {
+  public:
+    explicit Worker(std::shared_ptr<ProverReferenceString> reference_string)
+        : reference_string(std::move(reference_string))
+    {}
+
+    /**
+     * @brief Execute `request` on the shared segment, or on the memory whose descriptor `fd` came with it (which is
+     * closed afterwards).
+     */
+    Response execute(const Request& request, SharedSegment& segment, int fd)
+    {
+        Response response{ .status = 0, .padding = 0, .result = barretenberg::g1::affine_element::infinity() };
+        if (request.type == RequestType::SHARED_SCALAR_MULTIPLICATION) {
+            using barretenberg::fr;
+            constexpr uint64_t max_elements = std::numeric_limits<uint64_t>::max() / sizeof(fr);
+            const bool in_range = request.offset <= max_elements && request.size <= max_elements - request.offset;
+            const size_t num_bytes = in_range ? static_cast<size_t>(request.offset + request.size) * sizeof(fr) : 0;
+            ReceivedMemory memory(fd, num_bytes);
+            if (!memory.valid()) {
+                response.status = 1;
+                return response;
+            }
+            return scalar_multiplication(memory.elements() + request.offset, static_cast<size_t>(request.size));
+        }
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        const size_t capacity = segment.size() / sizeof(barretenberg::fr);
+        if (request.offset > capacity || request.size > capacity - request.offset) {
+            response.status = 1;
+            return response;
+        }
+        barretenberg::fr* operand = segment.elements() + request.offset;
+        switch (request.type) {
+        case RequestType::SCALAR_MULTIPLICATION: {
+            response = scalar_multiplication(operand, static_cast<size_t>(request.size));
+            break;
+        }
+        case RequestType::SMALL_FFT: {
+            barretenberg::polynomial_arithmetic::coset_fft_with_generator_shift(
+                operand, get_domain(static_cast<size_t>(request.size)), request.constant);
+            break;
+        }
+        case RequestType::IFFT: {
+            barretenberg::polynomial_arithmetic::ifft(operand, get_domain(static_cast<size_t>(request.size)));
+            break;
+        }
+        case RequestType::SHARED_SCALAR_MULTIPLICATION:
+        case RequestType::SHUTDOWN: {
+            break;
+        }
+        }
+        return response;
+    }
+
+  private:
+    Response scalar_multiplication(barretenberg::fr* scalars, const size_t msm_size)
+    {
+        Response response{ .status = 0, .padding = 0, .result = barretenberg::g1::affine_element::infinity() };
+        if (msm_size > reference_string->get_monomial_size()) {
+            response.status = 1;
+            return response;
+        }
+        barretenberg::scalar_multiplication::pippenger_runtime_state state(msm_size);
+        response.result = barretenberg::g1::affine_element(barretenberg::scalar_multiplication::pippenger_unsafe(
+            scalars, reference_string->get_monomial_points(), msm_size, state));
+        return response;
+    }
+
+    const barretenberg::evaluation_domain& get_domain(const size_t size)
+    {
+        auto it = domains.find(size);
+        if (it == domains.end()) {
+            it = domains.emplace(size, barretenberg::evaluation_domain(size, size)).first;
+            it->second.compute_lookup_table();
+        }
+        return it->second;
+    }
+
+    std::shared_ptr<ProverReferenceString> reference_string;
+    std::map<size_t, barretenberg::evaluation_domain> domains;
+};
+
+} // namespace
+
+SharedSegment::SharedSegment(const size_t num_bytes)
+    : size_(num_bytes)
+{
+    // Create, then immediately unlink, a POSIX shared memory object: it lives on for as long as a descriptor or a
+    // mapping refers to it, and can only be reached by processes we hand the descriptor to.
+    const std::string name = "/bb_work_queue_" + std::to_string(::getpid()) + "_" + std::to_string(segment_counter++);
+    fd_ = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    check(fd_ >= 0, "shm_open");
+    ::shm_unlink(name.c_str());
+    check(::ftruncate(fd_, static_cast<off_t>(size_)) == 0, "ftruncate");
+    data_ = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    check(data_ != MAP_FAILED, "mmap");
+}
+
+SharedSegment::SharedSegment(const int fd, const size_t num_bytes)
+    : fd_(fd)
+{
+    struct stat status {};
+    if (fd_ < 0 || ::fstat(fd_, &status) != 0 || static_cast<size_t>(status.st_size) < num_bytes || num_bytes == 0) {
+        return;
+    }
+    void* ptr = ::mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (ptr != MAP_FAILED) {
+        data_ = ptr;
+        size_ = num_bytes;
+    }
+}
+
+SharedSegment::SharedSegment(SharedSegment&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1))
+    , size_(std::exchange(other.size_, 0))
+    , data_(std::exchange(other.data_, nullptr))
+{}
+
+SharedSegment& SharedSegment::operator=(SharedSegment&& other) noexcept
+{
+    std::swap(fd_, other.fd_);
+    std::swap(size_, other.size_);
+    std::swap(data_, other.data_);
+    return *this;
+}
+
+SharedSegment::~SharedSegment()
+{
+    if (data_ != nullptr) {
+        ::munmap(data_, size_);
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+WorkerConnection::WorkerConnection(const std::string& socket_path, const size_t num_elements)
+    : segment(num_elements * sizeof(barretenberg::fr))
+{
+    socket_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    check(socket_fd >= 0, "socket");
+    const std::optional<sockaddr_un> address = make_address(socket_path);
+    if (!address.has_value() ||
+        ::connect(socket_fd, reinterpret_cast<const sockaddr*>(&*address), sizeof(sockaddr_un)) != 0) {
+        const int error = errno;
+        ::close(socket_fd);
+        errno = error;
+        check(false, "connect to " + socket_path);
+    }
+    const Handshake handshake{ segment.size() };
+    check(send_message(socket_fd, &handshake, sizeof(handshake), segment.fd()), "send handshake");
+}
+
+WorkerConnection::~WorkerConnection()
+{
+    if (socket_fd >= 0) {
+        ::close(socket_fd);
+    }
+}
+
+Response WorkerConnection::transact(const Request& request, const int fd)
+{
+    check(send_message(socket_fd, &request, sizeof(request), fd), "send request");
+    Response response{};
+    check(read_exact(socket_fd, &response, sizeof(response)), "read response");
+    if (response.status != 0) {
+        throw_or_abort("remote worker: request rejected");
+    }
+    return response;
+}
+
+barretenberg::g1::affine_element WorkerConnection::scalar_multiplication(const size_t offset, const size_t num_scalars)
+{
+    return transact({ RequestType::SCALAR_MULTIPLICATION, 0, offset, num_scalars, barretenberg::fr(0) }).result;
+}
+
+barretenberg::g1::affine_element WorkerConnection::scalar_multiplication(const int memory_fd,
+                                                                       const size_t offset,
+                                                                       const size_t num_scalars)
+{
+    return transact({ RequestType::SHARED_SCALAR_MULTIPLICATION, 0, offset, num_scalars, barretenberg::fr(0) },
+                    memory_fd)
+        .result;
+}
+
+void WorkerConnection::small_fft(const size_t offset, const size_t size, const barretenberg::fr& generator_shift)
+{
+    transact({ RequestType::SMALL_FFT, 0, offset, size, generator_shift });
+}
+
+void WorkerConnection::ifft(const size_t offset, const size_t size)
+{
+    transact({ RequestType::IFFT, 0, offset, size, barretenberg::fr(0) });
+}
+
+void WorkerConnection::shutdown()
+{
+    transact({ RequestType::SHUTDOWN, 0, 0, 0, barretenberg::fr(0) });
+}
+
+WorkerPool::WorkerPool(const std::vector<std::string>& socket_paths, const size_t num_elements_per_worker)
+{
+    for (const auto& path : socket_paths) {
+        connections.emplace_back(std::make_unique<WorkerConnection>(path, num_elements_per_worker));
+    }
+}
+
+bool run_worker(const std::string& socket_path, std::shared_ptr<ProverReferenceString> reference_string)
+{
+    Worker worker(std::move(reference_string));
+
+    const int listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        return report_failure("socket");
+    }
+    ::unlink(socket_path.c_str());
+    const std::optional<sockaddr_un> address = make_address(socket_path);
+    if (!address.has_value() ||
+        ::bind(listen_fd, reinterpret_cast<const sockaddr*>(&*address), sizeof(sockaddr_un)) != 0 ||
+        ::listen(listen_fd, 16) != 0) {
+        const int error = errno;
+        ::close(listen_fd);
+        errno = error;
+        return report_failure("listen on " + socket_path);
+    }
+
+    bool running = true;
+    bool served = true;
+    while (running) {
+        const int connection_fd = ::accept(listen_fd, nullptr, nullptr);
+        if (connection_fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            served = report_failure("accept");
+            break;
+        }
+        // A connection that does not follow the protocol is dropped; the worker goes on serving the others.
+        Handshake handshake{};
+        int segment_fd = -1;
+        if (!receive_message(connection_fd, &handshake, sizeof(handshake), segment_fd) || segment_fd < 0) {
+            ::close(connection_fd);
+            continue;
+        }
+        SharedSegment segment(segment_fd, static_cast<size_t>(handshake.segment_size));
+        if (!segment.valid()) {
+            ::close(connection_fd);
+            continue;
+        }
+
+        Request request{};
+        int request_fd = -1;
+        while (receive_message(connection_fd, &request, sizeof(request), request_fd)) {
+            Response response = worker.execute(request, segment, request_fd);
+            if (!write_exact(connection_fd, &response, sizeof(response))) {
+                break;
+            }
+            if (request.type == RequestType::SHUTDOWN) {
+                running = false;
+                break;
+            }
+        }
+        ::close(connection_fd);
+    }
+    ::close(listen_fd);
+    ::unlink(socket_path.c_str());
+    return served;
+}
+
+} // namespace proof_system::plonk::remote
+#endif
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/curves/bn254/g1.hpp"
+#include "barretenberg/polynomials/polynomial_memory.hpp"
+#include "barretenberg/srs/reference_string/reference_string.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Native counterpart of the WASM work queue c_binds.
+ *
+ * @details A prover process posts work_queue items (multi-scalar multiplications, small coset FFTs and IFFTs) to a set
+ * of local worker processes. The prover and each worker share a memory segment, created by the prover and handed to
+ * the worker over a Unix domain socket (SCM_RIGHTS). Polynomials are written to the segment once and operated on in
+ * place by the worker, so only fixed-size request/response headers cross the socket. The scalars of a multiplication
+ * are not copied at all when they live in shared polynomial memory (see WorkerPool): the worker maps them directly.
+ * Each worker process holds its own SRS mapping, which lets an operator pin workers to NUMA nodes (e.g. with numactl)
+ * and spread a single proof over several processes. bb_worker is the worker executable.
+ *
+ * Not available in WASM builds.
+ */
+namespace proof_system::plonk::remote {
+
+/**
+ * SHARED_SCALAR_MULTIPLICATION is a scalar multiplication whose scalars are not in the shared segment but in the memory
+ * whose descriptor is passed along with the request (see polynomial_memory.hpp).
+ */
+enum class RequestType : uint32_t { SCALAR_MULTIPLICATION, SMALL_FFT, IFFT, SHUTDOWN, SHARED_SCALAR_MULTIPLICATION };
+
+/**
+ * @brief Request sent from the prover to a worker. `offset` and `size` locate the operand in the shared segment (or in
+ * the memory passed with a SHARED_SCALAR_MULTIPLICATION), in units of field elements.
+ */
+struct Request {
+    RequestType type;
+    uint32_t padding;
+    uint64_t offset;
+    uint64_t size;
+    barretenberg::fr constant;
+};
+
+/**
+ * @brief Response sent from a worker to the prover. `result` is only meaningful for scalar multiplications; FFT results
+ * are written back into the shared segment.
+ */
+struct Response {
+    uint32_t status;
+    uint32_t padding;
+    barretenberg::g1::affine_element result;
+};
+
+/**
+ * @brief An anonymous shared memory segment that can be mapped by another process via its file descriptor.
+ */
+class SharedSegment {
+  public:
+    explicit SharedSegment(size_t num_bytes);
+    /**
+     * @brief Map the first `num_bytes` of the segment behind `fd`, which the segment takes ownership of. If `fd` is not
+     * a segment of at least that size, or cannot be mapped, the result is not valid().
+     */
+    SharedSegment(int fd, size_t num_bytes);
+    SharedSegment(const SharedSegment& other) = delete;
+    SharedSegment(SharedSegment&& other) noexcept;
+    SharedSegment& operator=(const SharedSegment& other) = delete;
+    SharedSegment& operator=(SharedSegment&& other) noexcept;
+    ~SharedSegment();
+
+    [[nodiscard]] bool valid() const { return data_ != nullptr; }
+    [[nodiscard]] int fd() const { return fd_; }
+    [[nodiscard]] size_t size() const { return size_; }
+    barretenberg::fr* elements() { return static_cast<barretenberg::fr*>(data_); }
+
+  private:
+    int fd_ = -1;
+    size_t size_ = 0;
+    void* data_ = nullptr;
+};
+
+/**
+ * @brief A prover-side connection to a single worker process.
+ */
+class WorkerConnection {
+  public:
+    /**
+     * @brief Connect to the worker listening on `socket_path` and share a segment large enough for `num_elements`
+     * field elements with it.
+     */
+    WorkerConnection(const std::string& socket_path, size_t num_elements);
+    WorkerConnection(const WorkerConnection& other) = delete;
+    WorkerConnection(WorkerConnection&& other) = delete;
+    WorkerConnection& operator=(const WorkerConnection& other) = delete;
+    WorkerConnection& operator=(WorkerConnection&& other) = delete;
+    ~WorkerConnection();
+
+    barretenberg::fr* buffer() { return segment.elements(); }
+    [[nodiscard]] size_t capacity() const { return segment.size() / sizeof(barretenberg::fr); }
+
+    barretenberg::g1::affine_element scalar_multiplication(size_t offset, size_t num_scalars);
+
+    /**
+     * @brief Multiply scalars that live in other shared memory, e.g. a polynomial allocated by
+     * barretenberg::polynomial_memory in shared mode: `num_scalars` field elements starting `offset` elements into the
+     * memory of `memory_fd`. The worker maps the memory for the duration of the request, so nothing is copied.
+     */
+    barretenberg::g1::affine_element scalar_multiplication(int memory_fd, size_t offset, size_t num_scalars);
+    void small_fft(size_t offset, size_t size, const barretenberg::fr& generator_shift);
+    void ifft(size_t offset, size_t size);
+
+    /**
+     * @brief Ask the worker process to exit once it has replied.
+     */
+    void shutdown();
+
+  private:
+    Response transact(const Request& request, int fd = -1);
+
+    int socket_fd = -1;
+    SharedSegment segment;
+};
+
+/**
+ * @brief A set of worker connections that work_queue::process_queue can distribute items across.
+ *
+ * @details Each connection is used by at most one thread at a time; items are assigned to connections by the shared
+ * thread pool.
+ *
+ * While a pool exists, polynomials are allocated in shared memory (barretenberg::polynomial_memory::SharedScope), so
+ * that the scalars of multiplications reach the workers without a copy. Create it before the proving key and witness
+ * polynomials; scalars in memory allocated earlier are copied into the segment instead. Destroying the pool restores
+ * the allocation mode it found.
+ */
+class WorkerPool {
+  public:
+    WorkerPool(const std::vector<std::string>& socket_paths, size_t num_elements_per_worker);
+
+    [[nodiscard]] size_t size() const { return connections.size(); }
+    WorkerConnection& get(size_t index) { return *connections[index]; }
+
+  private:
+    // Declared first so that it also ends shared mode when connecting to a worker throws.
+    barretenberg::polynomial_memory::SharedScope shared_scope;
+    std::vector<std::unique_ptr<WorkerConnection>> connections;
+};
+
+/**
+ * @brief Serve work items on `socket_path` until a SHUTDOWN request is received.
+ *
+ * @details Connections are served one at a time. A connection that breaks the protocol (e.g. a handshake whose segment
+ * cannot be mapped) is dropped and the worker goes on to the next. Evaluation domains are constructed on first use for
+ * each size and cached for the lifetime of the worker.
+ *
+ * @return true once a SHUTDOWN request has been served; false, with the reason logged, if the socket cannot be set up
+ * or stops accepting connections.
+ */
+bool run_worker(const std::string& socket_path, std::shared_ptr<ProverReferenceString> reference_string);
+
+} // namespace proof_system::plonk::remote
@@ -0,0 +1,199 @@
+#include "remote_worker.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/pippenger.hpp"
+#include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+namespace proof_system::plonk::remote {
+
+using namespace barretenberg;
+
+namespace {
+class RandomReferenceString : public ProverReferenceString {
+  public:
+    explicit RandomReferenceString(size_t num_points)
+        : num_points(num_points)
+        , points(scalar_multiplication::point_table_alloc<g1::affine_element>(num_points))
+    {
+        for (size_t i = 0; i < num_points; ++i) {
+            points[i] = g1::affine_element(g1::element::random_element());
+        }
+        scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+    }
+    ~RandomReferenceString() override { aligned_free(points); }
+
+    g1::affine_element* get_monomial_points() override { return points; }
+    size_t get_monomial_size() const override { return num_points; }
+
+  private:
+    size_t num_points;
+    g1::affine_element* points;
+};
+
+std::unique_ptr<WorkerConnection> connect_with_retry(const std::string& path, size_t num_elements)
+{
+    // The worker may not be listening yet.
+    for (size_t attempt = 0; attempt < 100; ++attempt) {
+        try {
+            return std::make_unique<WorkerConnection>(path, num_elements);
+        } catch (std::runtime_error&) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    return std::make_unique<WorkerConnection>(path, num_elements);
+}
+
+/**
+ * @brief Connect to the worker on `path` and send it a handshake announcing a segment of `segment_size` bytes, passing
+ * the descriptor of `segment` (which may be smaller) along with it. Returns the connected socket.
+ */
+int send_handshake(const std::string& path, const uint64_t segment_size, const SharedSegment& segment)
+{
+    const int socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    for (size_t attempt = 0; attempt < 100; ++attempt) {
+        if (connect(socket_fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    iovec payload{ const_cast<uint64_t*>(&segment_size), sizeof(segment_size) };
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr message{};
+    message.msg_iov = &payload;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int));
+    const int fd = segment.fd();
+    std::memcpy(CMSG_DATA(header), &fd, sizeof(int));
+    EXPECT_EQ(sendmsg(socket_fd, &message, 0), static_cast<ssize_t>(sizeof(segment_size)));
+    return socket_fd;
+}
+} // namespace
+
+TEST(remote_worker, matches_local_computation)
+{
+    constexpr size_t n = 256;
+    const std::string path = "/tmp/bb_remote_worker_test_" + std::to_string(getpid()) + ".sock";
+    auto crs = std::make_shared<RandomReferenceString>(n);
+    std::thread worker([&]() { run_worker(path, crs); });
+
+    auto connection = connect_with_retry(path, 2 * n);
+    ASSERT_GE(connection->capacity(), 2 * n);
+
+    // Multi-scalar multiplication
+    std::vector<fr> scalars(n);
+    for (auto& scalar : scalars) {
+        scalar = fr::random_element();
+    }
+    memcpy((void*)connection->buffer(), (void*)&scalars[0], n * sizeof(fr));
+    g1::affine_element remote_commitment = connection->scalar_multiplication(0, n);
+    scalar_multiplication::pippenger_runtime_state state(n);
+    g1::affine_element local_commitment(
+        scalar_multiplication::pippenger_unsafe(&scalars[0], crs->get_monomial_points(), n, state));
+    EXPECT_EQ(remote_commitment, local_commitment);
+
+    // Coset FFT with a generator shift, at a non-zero offset in the shared segment
+    evaluation_domain domain(n, n);
+    domain.compute_lookup_table();
+    const fr shift = fr::random_element();
+    std::vector<fr> coefficients(n);
+    for (auto& coefficient : coefficients) {
+        coefficient = fr::random_element();
+    }
+    memcpy((void*)(connection->buffer() + n), (void*)&coefficients[0], n * sizeof(fr));
+    connection->small_fft(n, n, shift);
+    std::vector<fr> expected(coefficients);
+    polynomial_arithmetic::coset_fft_with_generator_shift(&expected[0], domain, shift);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(connection->buffer()[n + i], expected[i]);
+    }
+
+    // IFFT
+    memcpy((void*)connection->buffer(), (void*)&coefficients[0], n * sizeof(fr));
+    connection->ifft(0, n);
+    expected = coefficients;
+    polynomial_arithmetic::ifft(&expected[0], domain);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(connection->buffer()[i], expected[i]);
+    }
+
+    connection->shutdown();
+    worker.join();
+}
+
+// A connection announcing a larger segment than it passes is dropped, and the worker goes on serving.
+TEST(remote_worker, drops_malformed_connection)
+{
+    constexpr size_t n = 16;
+    const std::string path = "/tmp/bb_remote_worker_test_" + std::to_string(getpid()) + ".sock";
+    auto crs = std::make_shared<RandomReferenceString>(n);
+    bool served = false;
+    std::thread worker([&]() { served = run_worker(path, crs); });
+
+    SharedSegment small_segment(n * sizeof(fr));
+    const int malformed = send_handshake(path, 1UL << 40, small_segment);
+    uint64_t unused = 0;
+    EXPECT_EQ(read(malformed, &unused, sizeof(unused)), 0);
+    close(malformed);
+
+    auto connection = connect_with_retry(path, n);
+    for (size_t i = 0; i < n; ++i) {
+        connection->buffer()[i] = fr::random_element();
+    }
+    scalar_multiplication::pippenger_runtime_state state(n);
+    const g1::affine_element expected(
+        scalar_multiplication::pippenger_unsafe(connection->buffer(), crs->get_monomial_points(), n, state));
+    EXPECT_EQ(connection->scalar_multiplication(0, n), expected);
+
+    connection->shutdown();
+    worker.join();
+    EXPECT_TRUE(served);
+}
+
+TEST(remote_worker, reports_unusable_socket_path)
+{
+    auto crs = std::make_shared<RandomReferenceString>(1);
+    EXPECT_FALSE(run_worker("/tmp/" + std::string(200, 'x') + ".sock", crs));
+}
+
+TEST(remote_worker, pool_scopes_shared_memory)
+{
+    constexpr size_t n = 16;
+    const std::string path = "/tmp/bb_remote_worker_test_" + std::to_string(getpid()) + ".sock";
+    auto crs = std::make_shared<RandomReferenceString>(n);
+    std::thread worker([&]() { run_worker(path, crs); });
+
+    ASSERT_FALSE(polynomial_memory::shared());
+    // The worker may not be listening yet: a pool that fails to connect must not leave shared mode on either.
+    std::unique_ptr<WorkerPool> pool;
+    for (size_t attempt = 0; attempt < 100 && pool == nullptr; ++attempt) {
+        try {
+            pool = std::make_unique<WorkerPool>(std::vector<std::string>{ path }, n);
+        } catch (std::runtime_error&) {
+            EXPECT_FALSE(polynomial_memory::shared());
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    ASSERT_NE(pool, nullptr);
+    EXPECT_TRUE(polynomial_memory::shared());
+
+    pool->get(0).shutdown();
+    pool.reset();
+    worker.join();
+    EXPECT_FALSE(polynomial_memory::shared());
+}
+
+} // namespace proof_system::plonk::remote
@@ -1,7 +1,10 @@
 #include "work_queue.hpp"
+#include "remote_worker.hpp"
 
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include "barretenberg/polynomials/polynomial_memory.hpp"
 
 namespace proof_system::plonk {
 
@@ -194,6 +197,12 @@ void work_queue::add_to_queue(const work_item& item)
 
 void work_queue::process_queue()
 {
+#ifndef __wasm__
+    if (remote_workers != nullptr && remote_workers->size() > 0) {
+        process_queue_remotely();
+        return;
+    }
+#endif
     for (const auto& item : work_item_queue) {
         switch (item.work_type) {
         // most expensive op
@@ -273,6 +282,106 @@ void work_queue::process_queue()
     work_item_queue = std::vector<work_item>();
 }
 
+#ifndef __wasm__
+/**
+ * @brief Process the queue on out-of-process workers.
+ *
+ * @details Items are dealt round-robin to the workers, which run concurrently. Each worker processes its items one at a
+ * time, reusing the start of its shared segment as scratch space, so the segment must hold 4n field elements (the four
+ * n-sized coset FFTs that make up an FFT item). Results are gathered first and only then written to the transcript and
+ * polynomial store, because neither is safe to mutate concurrently.
+ */
+void work_queue::process_queue_remotely()
+{
+    using namespace barretenberg;
+    struct Result {
+        g1::affine_element commitment;
+        polynomial data;
+    };
+    const size_t n = key->circuit_size;
+    const size_t num_workers = remote_workers->size();
+    std::vector<Result> results(work_item_queue.size());
+
+    parallel_for(num_workers, [&](size_t worker_index) {
+        auto& connection = remote_workers->get(worker_index);
+        fr* buffer = connection.buffer();
+        for (size_t i = worker_index; i < work_item_queue.size(); i += num_workers) {
+            const auto& item = work_item_queue[i];
+            switch (item.work_type) {
+            case WorkType::SCALAR_MULTIPLICATION: {
+                auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
+                // Scalars in shared polynomial memory are read by the worker where they are. Others (polynomials
+                // allocated before the worker pool existed, or too small to be shared) are copied into the segment.
+                const auto shared = polynomial_memory::find_shared(item.mul_scalars, msm_size * sizeof(fr));
+                if (shared && shared->offset % sizeof(fr) == 0) {
+                    results[i].commitment =
+                        connection.scalar_multiplication(shared->fd, shared->offset / sizeof(fr), msm_size);
+                    break;
+                }
+                ASSERT(msm_size <= connection.capacity());
+                memcpy((void*)buffer, (void*)item.mul_scalars, msm_size * sizeof(fr));
+                results[i].commitment = connection.scalar_multiplication(0, msm_size);
+                break;
+            }
+            case WorkType::FFT: {
+                // Split the 4n coset FFT into four n-sized FFTs over the cosets {1, ω, ω², ω³}.g of the small domain.
+                ASSERT(4 * n <= connection.capacity());
+                const polynomial& wire = key->polynomial_store.get(item.tag);
+                fr shift = fr(1);
+                for (size_t j = 0; j < 4; ++j) {
+                    memcpy((void*)(buffer + j * n), (void*)&wire[0], n * sizeof(fr));
+                    connection.small_fft(j * n, n, shift);
+                    shift *= key->large_domain.root;
+                }
+                polynomial wire_fft(4 * n + 4);
+                for (size_t j = 0; j < 4; ++j) {
+                    for (size_t k = 0; k < n; ++k) {
+                        wire_fft[4 * k + j] = buffer[j * n + k];
+                    }
+                    wire_fft[4 * n + j] = buffer[j * n];
+                }
+                results[i].data = std::move(wire_fft);
+                break;
+            }
+            case WorkType::IFFT: {
+                ASSERT(n <= connection.capacity());
+                const polynomial& wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
+                memcpy((void*)buffer, (void*)&wire_lagrange[0], n * sizeof(fr));
+                connection.ifft(0, n);
+                polynomial wire_monomial(n);
+                memcpy((void*)&wire_monomial[0], (void*)buffer, n * sizeof(fr));
+                results[i].data = std::move(wire_monomial);
+                break;
+            }
+            default: {
+            }
+            }
+        }
+    });
+
+    for (size_t i = 0; i < work_item_queue.size(); ++i) {
+        const auto& item = work_item_queue[i];
+        switch (item.work_type) {
+        case WorkType::SCALAR_MULTIPLICATION: {
+            transcript->add_element(item.tag, results[i].commitment.to_buffer());
+            break;
+        }
+        case WorkType::FFT: {
+            key->polynomial_store.put(item.tag + "_fft", std::move(results[i].data));
+            break;
+        }
+        case WorkType::IFFT: {
+            key->polynomial_store.put(item.tag, std::move(results[i].data));
+            break;
+        }
+        default: {
+        }
+        }
+    }
+    work_item_queue = std::vector<work_item>();
+}
+#endif
+
 std::vector<work_queue::work_item> work_queue::get_queue() const
 {
     return work_item_queue;
@@ -4,6 +4,10 @@
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 
 namespace proof_system::plonk {
+namespace remote {
+class WorkerPool;
+} // namespace remote
+
 // TODO(Cody): Template by flavor?
 class work_queue {
 
@@ -60,9 +64,18 @@ class work_queue {
 
     std::vector<work_item> get_queue() const;
 
+    /**
+     * @brief Execute subsequent calls to process_queue() on out-of-process workers (see remote_worker.hpp).
+     * Passing nullptr reverts to processing the queue locally. The pool must outlive its use by this queue.
+     */
+    void set_remote_workers(remote::WorkerPool* workers) { remote_workers = workers; }
+
   private:
+    void process_queue_remotely();
+
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
+    remote::WorkerPool* remote_workers = nullptr;
 };
 } // namespace proof_system::plonk
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "pedersen.hpp"
 #include "pedersen_plookup.hpp"
+#include "barretenberg/stdlib/hash/pedersen/pedersen_plookup.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen_lookup.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen_lookup.hpp"
@@ -76,6 +77,38 @@ TEST(stdlib_pedersen, test_compress_many_plookup)
     EXPECT_EQ(proof_result, true);
 }
 
+TEST(stdlib_pedersen, test_hash_pair_plookup)
+{
+    UltraComposer composer = UltraComposer();
+
+    const fr left_in = fr::random_element();
+    const fr right_in = fr::random_element();
+    const size_t hash_index = engine.get_random_uint8() % crypto::pedersen_hash::lookup::PEDERSEN_IV_TABLE_SIZE;
+
+    field_ct left = witness_ct(&composer, left_in);
+    field_ct right = witness_ct(&composer, right_in);
+
+    field_ct result = stdlib::pedersen_plookup_hash<UltraComposer>::hash_pair(left, right, hash_index);
+    field_ct result_multiple = stdlib::pedersen_plookup_hash<UltraComposer>::hash_multiple({ left, right }, hash_index);
+    field_ct result_constant = stdlib::pedersen_plookup_hash<UltraComposer>::hash_pair(left_in, right, hash_index);
+
+    fr expected = crypto::pedersen_hash::lookup::hash_multiple({ left_in, right_in }, hash_index);
+
+    EXPECT_EQ(result.get_value(), expected);
+    EXPECT_EQ(result_multiple.get_value(), expected);
+    EXPECT_EQ(result_constant.get_value(), expected);
+
+    auto prover = composer.create_prover();
+
+    printf("composer gates = %zu\n", composer.get_num_gates());
+    auto verifier = composer.create_verifier();
+
+    auto proof = prover.construct_proof();
+
+    bool proof_result = verifier.verify_proof(proof);
+    EXPECT_EQ(proof_result, true);
+}
+
 TEST(stdlib_pedersen, test_merkle_damgard_compress_plookup)
 {
     UltraComposer composer = UltraComposer();
@@ -561,6 +561,23 @@ field_t<C> pedersen_hash<C>::hash_multiple(const std::vector<field_t>& inputs,
     return result.x;
 }
 
+/**
+ * Hash two field elements (a Merkle tree node from its children), with the same result as
+ * hash_multiple({ left, right }, hash_index, validate_inputs_in_field).
+ */
+template <typename C>
+field_t<C> pedersen_hash<C>::hash_pair(const field_t& left,
+                                       const field_t& right,
+                                       const size_t hash_index,
+                                       const bool validate_inputs_in_field)
+{
+    if constexpr (C::type == ComposerType::PLOOKUP && C::merkle_hash_type == merkle::HashType::LOOKUP_PEDERSEN) {
+        return pedersen_plookup_hash<C>::hash_pair(left, right, hash_index);
+    }
+
+    return hash_multiple({ left, right }, hash_index, validate_inputs_in_field);
+}
+
 INSTANTIATE_STDLIB_TYPE(pedersen_hash);
 
 } // namespace stdlib
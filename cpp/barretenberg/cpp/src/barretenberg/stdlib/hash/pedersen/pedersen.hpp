@@ -40,6 +40,11 @@ template <typename ComposerContext> class pedersen_hash {
     static field_t hash_multiple(const std::vector<field_t>& in,
                                  const size_t hash_index = 0,
                                  const bool validate_inputs_in_field = true);
+
+    static field_t hash_pair(const field_t& left,
+                             const field_t& right,
+                             const size_t hash_index = 0,
+                             const bool validate_inputs_in_field = true);
 };
 
 EXTERN_STDLIB_TYPE(pedersen_hash);
@@ -86,10 +86,12 @@ template <typename C> point<C> pedersen_plookup_hash<C>::hash_single(const field
         return { field_t(ctx, hash_native.x), field_t(ctx, hash_native.y) };
     }
 
-    // Slice the input scalar in lower 126 and higher 128 bits.
+    // Slice the input scalar in lower 126 and higher 128 bits. The lookups below constrain y_lo to 126 bits and y_hi to
+    // 128 bits, deriving y_lo from the scalar ties the slices to it.
     C* ctx = scalar.get_context();
-    const field_t y_hi = witness_t(ctx, uint256_t(scalar.get_value()).slice(126, 256));
-    const field_t y_lo = witness_t(ctx, uint256_t(scalar.get_value()).slice(0, 126));
+    const uint256_t scalar_raw(scalar.get_value());
+    const field_t y_hi = witness_t(ctx, scalar_raw.slice(126, 256));
+    const field_t y_lo = scalar - y_hi * field_t(ctx, fr(uint256_t(1) << 126));
 
     ReadData<field_t> lookup_hi, lookup_lo;
     if (parity) {
@@ -100,16 +102,8 @@ template <typename C> point<C> pedersen_plookup_hash<C>::hash_single(const field
         lookup_hi = plookup_read::get_lookup_accumulators(MultiTableId::PEDERSEN_LEFT_HI, y_hi);
     }
 
-    // Check if (r_hi - y_hi) is 128 bits and if (r_hi - y_hi) == 0, then
-    // (r_lo - y_lo) must be 126 bits.
-    constexpr uint256_t modulus = fr::modulus;
-    const field_t r_lo = witness_t(ctx, modulus.slice(0, 126));
-    const field_t r_hi = witness_t(ctx, modulus.slice(126, 256));
-
-    const field_t term_hi = r_hi - y_hi;
-    const field_t term_lo = (r_lo - y_lo) * field_t(term_hi == field_t(0));
-    term_hi.normalize().create_range_constraint(128);
-    term_lo.normalize().create_range_constraint(126);
+    // Check that y_hi * 2^126 + y_lo < r, so that the slices are the canonical ones of the scalar
+    field_t::assert_canonical_limbs(y_lo, y_hi, 126, "pedersen_plookup: scalar slices not canonical");
 
     const size_t num_lookups_lo = lookup_lo[ColumnIdx::C1].size();
     const size_t num_lookups_hi = lookup_hi[ColumnIdx::C1].size();
@@ -158,6 +152,39 @@ field_t<C> pedersen_plookup_hash<C>::hash_multiple(const std::vector<field_t>& i
     return add_points(p1, p2).x;
 }
 
+/**
+ * Hash two field elements, with the same result as hash_multiple({ left, right }, hash_index).
+ *
+ * This is the hash of every level of a Merkle path. The IV and the number of inputs are known, so their halves of the
+ * first and last compressions are fixed points: they are added with one (fused) ecc add gate each as constant
+ * witnesses, instead of going through the division of add_points with a constant point. Only left, right and the two
+ * intermediate results are sliced and looked up.
+ */
+template <typename C>
+field_t<C> pedersen_plookup_hash<C>::hash_pair(const field_t& left, const field_t& right, const size_t hash_index)
+{
+    C* ctx = left.get_context() ? left.get_context() : right.get_context();
+    if (left.is_constant() && right.is_constant()) {
+        return field_t(ctx,
+                       crypto::pedersen_hash::lookup::hash_multiple({ left.get_value(), right.get_value() }, hash_index));
+    }
+
+    const auto constant_point = [ctx](const grumpkin::g1::element& native) {
+        const grumpkin::g1::affine_element normalized(native);
+        return point{ field_t::from_witness_index(ctx, ctx->put_constant_variable(normalized.x)),
+                      field_t::from_witness_index(ctx, ctx->put_constant_variable(normalized.y)) };
+    };
+    const grumpkin::fq iv = crypto::pedersen_hash::lookup::get_iv_table()[hash_index].x;
+    const point iv_point = constant_point(crypto::pedersen_hash::lookup::hash_single(iv, false));
+    const point num_inputs_point = constant_point(crypto::pedersen_hash::lookup::hash_single(grumpkin::fq(2), true));
+
+    // The point being added to is always the output of the previous ecc add gate, so that the two gates are fused.
+    field_t result = add_points(hash_single(left, true), iv_point).x;
+    const point p2 = hash_single(result, false);
+    result = add_points(hash_single(right, true), p2).x;
+    return add_points(hash_single(result, false), num_inputs_point).x;
+}
+
 template class pedersen_plookup_hash<plonk::UltraComposer>;
 
 } // namespace stdlib
@@ -26,6 +26,8 @@ template <typename ComposerContext> class pedersen_plookup_hash {
     static point hash_single(const field_t& in, const bool parity);
 
     static field_t hash_multiple(const std::vector<field_t>& in, const size_t hash_index = 0);
+
+    static field_t hash_pair(const field_t& left, const field_t& right, const size_t hash_index = 0);
 };
 
 extern template class pedersen_plookup_hash<plonk::UltraComposer>;
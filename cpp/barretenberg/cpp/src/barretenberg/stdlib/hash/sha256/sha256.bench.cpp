@@ -84,4 +84,41 @@ void verify_proofs_bench(State& state) noexcept
 }
 BENCHMARK(verify_proofs_bench)->DenseRange(START_BYTES, MAX_BYTES, BYTES_PER_CHUNK);
 
+/**
+ * Gate counts (the `gates` counter) of hashing a number of field elements with the plookup SHA-256, as the base rollup
+ * does with its 22 calldata fields: through a byte array, and with the field element input.
+ */
+template <typename Hash> void report_field_hash_gates(State& state, Hash&& hash)
+{
+    for (auto _ : state) {
+        plonk::UltraComposer composer = plonk::UltraComposer();
+        std::vector<stdlib::field_t<plonk::UltraComposer>> input;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            input.push_back(stdlib::witness_t<plonk::UltraComposer>(&composer, barretenberg::fr::random_element()));
+        }
+        hash(input);
+        state.counters["gates"] = static_cast<double>(composer.get_num_gates());
+    }
+}
+
+void sha256_fields_via_byte_array(State& state) noexcept
+{
+    report_field_hash_gates(state, [](const std::vector<stdlib::field_t<plonk::UltraComposer>>& input) {
+        stdlib::byte_array<plonk::UltraComposer> bytes(input[0].get_context());
+        for (const auto& element : input) {
+            bytes.write(stdlib::byte_array<plonk::UltraComposer>(element));
+        }
+        stdlib::sha256<plonk::UltraComposer>(stdlib::packed_byte_array<plonk::UltraComposer>(bytes));
+    });
+}
+BENCHMARK(sha256_fields_via_byte_array)->Arg(1)->Arg(2)->Arg(22)->Iterations(1)->Unit(kMillisecond);
+
+void sha256_fields(State& state) noexcept
+{
+    report_field_hash_gates(state, [](const std::vector<stdlib::field_t<plonk::UltraComposer>>& input) {
+        stdlib::sha256_plookup::sha256(input);
+    });
+}
+BENCHMARK(sha256_fields)->Arg(1)->Arg(2)->Arg(22)->Iterations(1)->Unit(kMillisecond);
+
 BENCHMARK_MAIN();
@@ -201,6 +201,65 @@ TEST(stdlib_sha256, test_plookup_55_bytes)
     EXPECT_EQ(proof_result, true);
 }
 
+TEST(stdlib_sha256, test_plookup_field_elements)
+{
+    typedef stdlib::field_t<plonk::UltraComposer> field_pt;
+    typedef stdlib::witness_t<plonk::UltraComposer> witness_pt;
+
+    // 1 and 2 elements fit in one block, 22 elements (the base rollup's calldata) take 12 blocks
+    for (const size_t num_elements : { 1UL, 2UL, 22UL }) {
+        plonk::UltraComposer composer = UltraComposer();
+
+        std::vector<field_pt> input;
+        std::vector<uint8_t> input_buf;
+        for (size_t i = 0; i < num_elements; ++i) {
+            // include the largest field element, whose encoding is closest to not being canonical
+            const fr element = (i == 1) ? fr(-1) : fr::random_element();
+            input.push_back(witness_pt(&composer, element));
+            const auto element_buf = element.to_buffer();
+            input_buf.insert(input_buf.end(), element_buf.begin(), element_buf.end());
+        }
+
+        const auto output = stdlib::sha256_plookup::sha256(input).get_value();
+        const auto expected = sha256::sha256(input_buf);
+        EXPECT_EQ(std::vector<uint8_t>(output.begin(), output.end()),
+                  std::vector<uint8_t>(expected.begin(), expected.end()));
+        printf("%zu elements: composer gates = %zu\n", num_elements, composer.get_num_gates());
+
+        auto prover = composer.create_prover();
+        auto verifier = composer.create_verifier();
+        plonk::proof proof = prover.construct_proof();
+        bool proof_result = verifier.verify_proof(proof);
+        EXPECT_EQ(proof_result, true);
+    }
+}
+
+TEST(stdlib_sha256, test_plookup_non_canonical_field_encoding)
+{
+    typedef stdlib::field_t<plonk::UltraComposer> field_pt;
+    typedef stdlib::witness_t<plonk::UltraComposer> witness_pt;
+
+    // x + r still fits in 256 bits and recomposes to x in the field, so only the canonical-limbs check rejects it
+    const fr x = fr::random_element();
+    for (const uint256_t& encoding : { uint256_t(x), uint256_t(x) + fr::modulus }) {
+        plonk::UltraComposer composer = UltraComposer();
+
+        const field_pt input(witness_pt(&composer, x));
+        std::array<field_pt, 8> words;
+        for (size_t i = 0; i < 8; ++i) {
+            words[i] = witness_pt(&composer, fr(encoding.slice(32 * (7 - i), 32 * (8 - i))));
+        }
+        stdlib::sha256_plookup::assert_words_encode_field(words, input);
+
+        const bool canonical = encoding == uint256_t(x);
+        EXPECT_EQ(composer.failed(), !canonical);
+        auto prover = composer.create_prover();
+        auto verifier = composer.create_verifier();
+        plonk::proof proof = prover.construct_proof();
+        EXPECT_EQ(verifier.verify_proof(proof), canonical);
+    }
+}
+
 TEST(stdlib_sha256, test_55_bytes)
 {
     // 55 bytes is the largest number of bytes that can be hashed in a single block,
@@ -242,8 +242,17 @@ field_t<plonk::UltraComposer> add_normalize(const field_t<plonk::UltraComposer>&
     return result;
 }
 
-std::array<field_t<plonk::UltraComposer>, 8> sha256_block(const std::array<field_t<plonk::UltraComposer>, 8>& h_init,
-                                                          const std::array<field_t<plonk::UltraComposer>, 16>& input)
+/**
+ * Applies the SHA-256 compression function to one block.
+ *
+ * Only the working variables b, c, f and g need a sparse form before the first round: majority() and choose() map
+ * a and e themselves, and d and h are only ever added. The 32-bit range constraints on the outputs are only needed if
+ * this is the last block: otherwise the next block maps outputs 0, 1, 2 (majority) and 4, 5, 6 (choose) into sparse
+ * form with lookups that already constrain them to 32 bits, so only outputs 3 and 7 are range constrained.
+ */
+std::array<field_t<plonk::UltraComposer>, 8> compress(const std::array<field_t<plonk::UltraComposer>, 8>& h_init,
+                                                      const std::array<field_t<plonk::UltraComposer>, 16>& input,
+                                                      const bool is_last_block)
 {
     typedef field_t<plonk::UltraComposer> field_pt;
 
@@ -261,14 +270,14 @@ std::array<field_t<plonk::UltraComposer>, 8> sha256_block(const std::array<field
     /**
      * Initialize round variables with previous block output
      **/
-    auto a = map_into_maj_sparse_form(h_init[0]);
+    sparse_value a(h_init[0]);
     auto b = map_into_maj_sparse_form(h_init[1]);
     auto c = map_into_maj_sparse_form(h_init[2]);
-    auto d = map_into_maj_sparse_form(h_init[3]);
-    auto e = map_into_choose_sparse_form(h_init[4]);
+    sparse_value d(h_init[3]);
+    sparse_value e(h_init[4]);
     auto f = map_into_choose_sparse_form(h_init[5]);
     auto g = map_into_choose_sparse_form(h_init[6]);
-    auto h = map_into_choose_sparse_form(h_init[7]);
+    sparse_value h(h_init[7]);
 
     /**
      * Extend witness
@@ -313,12 +322,44 @@ std::array<field_t<plonk::UltraComposer>, 8> sha256_block(const std::array<field
      * compression function because the outputs of the lookup table ensures that the output is contrained to 32 bits.
      */
     for (size_t i = 0; i < 8; i++) {
-        output[i].create_range_constraint(32);
+        if (is_last_block || i == 3 || i == 7) {
+            output[i].create_range_constraint(32);
+        }
     }
 
     return output;
 }
 
+std::array<field_t<plonk::UltraComposer>, 8> sha256_block(const std::array<field_t<plonk::UltraComposer>, 8>& h_init,
+                                                          const std::array<field_t<plonk::UltraComposer>, 16>& input)
+{
+    return compress(h_init, input, true);
+}
+
+/**
+ * Hashes a message that is already padded and split into 32-bit words, 16 per block.
+ */
+std::array<field_t<plonk::UltraComposer>, 8> sha256_padded_words(
+    const std::vector<field_t<plonk::UltraComposer>>& words)
+{
+    typedef field_t<plonk::UltraComposer> field_pt;
+
+    constexpr size_t slices_per_block = 16;
+    ASSERT(words.size() % slices_per_block == 0);
+    const size_t num_blocks = words.size() / slices_per_block;
+
+    std::array<field_pt, 8> rolling_hash;
+    prepare_constants(rolling_hash);
+    for (size_t i = 0; i < num_blocks; ++i) {
+        std::array<field_pt, 16> hash_input;
+        for (size_t j = 0; j < 16; ++j) {
+            hash_input[j] = words[i * slices_per_block + j];
+        }
+        rolling_hash = compress(rolling_hash, hash_input, i == num_blocks - 1);
+    }
+    return rolling_hash;
+}
+
 packed_byte_array<plonk::UltraComposer> sha256(const packed_byte_array<plonk::UltraComposer>& input)
 {
     typedef field_t<plonk::UltraComposer> field_pt;
@@ -343,17 +384,94 @@ packed_byte_array<plonk::UltraComposer> sha256(const packed_byte_array<plonk::Ul
 
     const auto slices = message_schedule.to_unverified_byte_slices(4);
 
-    constexpr size_t slices_per_block = 16;
+    const auto rolling_hash = sha256_padded_words(slices);
 
-    std::array<field_pt, 8> rolling_hash;
-    prepare_constants(rolling_hash);
-    for (size_t i = 0; i < num_blocks; ++i) {
-        std::array<field_pt, 16> hash_input;
-        for (size_t j = 0; j < 16; ++j) {
-            hash_input[j] = slices[i * slices_per_block + j];
-        }
-        rolling_hash = sha256_block(rolling_hash, hash_input);
+    std::vector<field_pt> output(rolling_hash.begin(), rolling_hash.end());
+    return packed_byte_array<plonk::UltraComposer>(output, 4);
+}
+
+/**
+ * Constrains `words` to be the 8 32-bit words of the 32-byte big-endian encoding of `input` (as `fr::to_buffer`), and
+ * that encoding to be canonical, i.e. smaller than the modulus. Without the second check the words of input + r would
+ * also pass.
+ *
+ * The words are not range constrained here: see `sha256(const std::vector<field_t<plonk::UltraComposer>>&)`.
+ */
+void assert_words_encode_field(const std::array<field_t<plonk::UltraComposer>, 8>& words,
+                               const field_t<plonk::UltraComposer>& input)
+{
+    typedef field_t<plonk::UltraComposer> field_pt;
+
+    plonk::UltraComposer* ctx = input.get_context();
+    field_pt hi(ctx, 0);
+    field_pt lo(ctx, 0);
+    for (size_t i = 0; i < 4; ++i) {
+        const field_pt shift(ctx, fr(uint256_t(1) << (32 * (3 - i))));
+        hi += words[i] * shift;
+        lo += words[i + 4] * shift;
     }
+    const field_pt limb_shift(ctx, fr(uint256_t(1) << 128));
+    input.assert_equal(lo + hi * limb_shift, "sha256: words do not match field element");
+    field_pt::assert_canonical_limbs(lo, hi, 128, "sha256: field element encoding not canonical");
+}
+
+/**
+ * Splits a field element into the 8 32-bit words of its 32-byte big-endian encoding, constrained by
+ * assert_words_encode_field.
+ */
+std::array<field_t<plonk::UltraComposer>, 8> convert_field_into_words(const field_t<plonk::UltraComposer>& input)
+{
+    typedef field_t<plonk::UltraComposer> field_pt;
+    typedef witness_t<plonk::UltraComposer> witness_pt;
+
+    plonk::UltraComposer* ctx = input.get_context();
+    const uint256_t value(input.get_value());
+
+    std::array<field_pt, 8> words;
+    for (size_t i = 0; i < 8; ++i) {
+        const uint256_t word = value.slice(32 * (7 - i), 32 * (8 - i));
+        words[i] = input.is_constant() ? field_pt(ctx, fr(word)) : field_pt(witness_pt(ctx, fr(word)));
+    }
+    if (!input.is_constant()) {
+        assert_words_encode_field(words, input);
+    }
+    return words;
+}
+
+/**
+ * Hashes the concatenated 32-byte big-endian encodings of `input`, without going through a byte array: every field
+ * element is split straight into message words.
+ *
+ * The words are range constrained by the message schedule: extend_witness() maps words 1 to 15 of every block into
+ * sparse form with a lookup that constrains them to 32 bits. Only the first word of every block needs an explicit
+ * range constraint.
+ */
+packed_byte_array<plonk::UltraComposer> sha256(const std::vector<field_t<plonk::UltraComposer>>& input)
+{
+    typedef field_t<plonk::UltraComposer> field_pt;
+
+    plonk::UltraComposer* ctx = nullptr;
+    std::vector<field_pt> words;
+    for (const auto& element : input) {
+        ctx = ctx ? ctx : element.get_context();
+        const auto element_words = convert_field_into_words(element);
+        words.insert(words.end(), element_words.begin(), element_words.end());
+    }
+
+    // Padding: a 1 bit, zeros up to 448 bits mod 512, and the message length in bits as a 64-bit integer
+    const uint64_t message_bits = input.size() * 256;
+    words.push_back(field_pt(ctx, 0x80000000ULL));
+    while (words.size() % 16 != 14) {
+        words.push_back(field_pt(ctx, 0));
+    }
+    words.push_back(field_pt(ctx, message_bits >> 32));
+    words.push_back(field_pt(ctx, message_bits & 0xffffffffULL));
+
+    for (size_t i = 0; i < words.size(); i += 16) {
+        words[i].create_range_constraint(32, "sha256: message word too large");
+    }
+
+    const auto rolling_hash = sha256_padded_words(words);
 
     std::vector<field_pt> output(rolling_hash.begin(), rolling_hash.end());
     return packed_byte_array<plonk::UltraComposer>(output, 4);
@@ -85,7 +85,14 @@ field_t<plonk::UltraComposer> majority(sparse_value& a, const sparse_value& b, c
 std::array<field_t<plonk::UltraComposer>, 8> sha256_block(const std::array<field_t<plonk::UltraComposer>, 8>& h_init,
                                                           const std::array<field_t<plonk::UltraComposer>, 16>& input);
 
+void assert_words_encode_field(const std::array<field_t<plonk::UltraComposer>, 8>& words,
+                               const field_t<plonk::UltraComposer>& input);
+
+std::array<field_t<plonk::UltraComposer>, 8> convert_field_into_words(const field_t<plonk::UltraComposer>& input);
+
 packed_byte_array<plonk::UltraComposer> sha256(const packed_byte_array<plonk::UltraComposer>& input);
+
+packed_byte_array<plonk::UltraComposer> sha256(const std::vector<field_t<plonk::UltraComposer>>& input);
 } // namespace sha256_plookup
 } // namespace stdlib
 } // namespace proof_system::plonk
@@ -63,6 +63,31 @@ inline fr zero_hash_at_height(size_t height)
     return current;
 }
 
+/**
+ * Returns the roots of all subtrees of `tree` at `height`, from left to right, i.e. every node of the tree at that
+ * height. These are the `subtree_roots` expected by the batched membership gadgets in membership.hpp.
+ *
+ * The hash path of a leaf holds, at every height, the leaf's ancestor and its sibling. So one hash path per pair of
+ * subtrees is enough.
+ */
+template <typename Tree> std::vector<fr> get_subtree_roots(Tree& tree, size_t height)
+{
+    const size_t depth = tree.get_hash_path(0).size();
+    ASSERT(height <= depth);
+    if (height == depth) {
+        return { tree.root() };
+    }
+    const size_t num_subtrees = 1UL << (depth - height);
+    std::vector<fr> roots;
+    roots.reserve(num_subtrees);
+    for (size_t i = 0; i < num_subtrees; i += 2) {
+        const auto path = tree.get_hash_path(i << height);
+        roots.push_back(path[height].first);
+        roots.push_back(path[height].second);
+    }
+    return roots;
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
@@ -0,0 +1,55 @@
+#include "membership.hpp"
+#include <benchmark/benchmark.h>
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
+
+using namespace benchmark;
+using namespace proof_system::plonk::stdlib::merkle_tree;
+
+namespace {
+using Composer = proof_system::plonk::UltraComposer;
+using field_ct = proof_system::plonk::stdlib::field_t<Composer>;
+using witness_ct = proof_system::plonk::stdlib::witness_t<Composer>;
+using bool_ct = proof_system::plonk::stdlib::bool_t<Composer>;
+using pedersen_hash_ct = proof_system::plonk::stdlib::pedersen_hash<Composer>;
+
+constexpr size_t DEPTH = 32;
+
+/**
+ * Gates per level (the `gates_per_level` counter) of computing a root from a leaf and its hash path of `DEPTH` levels,
+ * with `hash_pair` hashing the two children at each level. A first level is hashed before counting, so that the rows
+ * of the lookup tables are not part of the count.
+ */
+template <typename HashPair> void report_gates_per_level(State& state, HashPair&& hash_pair)
+{
+    for (auto _ : state) {
+        Composer composer = Composer();
+        field_ct current = witness_ct(&composer, fr::random_element());
+        current = hash_pair(current, witness_ct(&composer, fr::random_element()));
+        const size_t num_gates_before = composer.get_num_gates();
+        for (size_t i = 0; i < DEPTH; ++i) {
+            const bool_ct is_right = witness_ct(&composer, i & 1);
+            const field_ct sibling = witness_ct(&composer, fr::random_element());
+            const field_ct left = field_ct::conditional_assign(is_right, sibling, current);
+            const field_ct right = field_ct::conditional_assign(is_right, current, sibling);
+            current = hash_pair(left, right);
+        }
+        state.counters["gates_per_level"] =
+            static_cast<double>(composer.get_num_gates() - num_gates_before) / static_cast<double>(DEPTH);
+    }
+}
+} // namespace
+
+void hash_path_level_hash_multiple(State& state) noexcept
+{
+    report_gates_per_level(state, [](const field_ct& left, const field_ct& right) {
+        return pedersen_hash_ct::hash_multiple({ left, right });
+    });
+}
+BENCHMARK(hash_path_level_hash_multiple)->Iterations(1)->Unit(kMillisecond);
+
+void hash_path_level_hash_pair(State& state) noexcept
+{
+    report_gates_per_level(
+        state, [](const field_ct& left, const field_ct& right) { return pedersen_hash_ct::hash_pair(left, right); });
+}
+BENCHMARK(hash_path_level_hash_pair)->Iterations(1)->Unit(kMillisecond);
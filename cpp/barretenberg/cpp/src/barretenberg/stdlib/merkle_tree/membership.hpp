@@ -3,6 +3,8 @@
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/byte_array/byte_array.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include "barretenberg/stdlib/primitives/memory/ram_table.hpp"
+#include "barretenberg/stdlib/primitives/memory/rom_table.hpp"
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -10,26 +12,21 @@ namespace merkle_tree {
 
 template <typename ComposerContext> using bit_vector = std::vector<bool_t<ComposerContext>>;
 /**
- * Checks if the subtree is correctly inserted at a specified index in a Merkle tree.
+ * Computes the root of a Merkle tree from the root of one of its subtrees and its hash path.
  *
- * @param root: The root of the latest state of the merkle tree,
- * @param hashes: The hash path from any leaf in the subtree to the root, it doesn't matter if this hash path is
- * computed before or after updating the tree,
+ * @param hashes: The hash path from any leaf in the subtree to the root,
  * @param value: The value of the subtree root,
  * @param index: The index of any leaf in the subtree,
  * @param at_height: The height of the subtree,
  * @param is_updating_tree: set to true if we're updating the tree.
  * @tparam Composer: type of composer.
- *
- * @see Check full documentation: https://hackmd.io/2zyJc6QhRuugyH8D78Tbqg?view
  */
 template <typename Composer>
-bool_t<Composer> check_subtree_membership(field_t<Composer> const& root,
-                                          hash_path<Composer> const& hashes,
-                                          field_t<Composer> const& value,
-                                          bit_vector<Composer> const& index,
-                                          size_t at_height,
-                                          bool const is_updating_tree = false)
+field_t<Composer> compute_root_from_subtree(hash_path<Composer> const& hashes,
+                                           field_t<Composer> const& value,
+                                           bit_vector<Composer> const& index,
+                                           size_t at_height,
+                                           bool const is_updating_tree = false)
 {
     auto current = value;
     for (size_t i = at_height; i < hashes.size(); ++i) {
@@ -43,10 +40,34 @@ bool_t<Composer> check_subtree_membership(field_t<Composer> const& root,
         // current iff path_bit If either of these does not hold, then the final computed merkle root will not match
         field_t<Composer> left = field_t<Composer>::conditional_assign(path_bit, hashes[i].first, current);
         field_t<Composer> right = field_t<Composer>::conditional_assign(path_bit, current, hashes[i].second);
-        current = pedersen_hash<Composer>::hash_multiple({ left, right }, 0, is_updating_tree);
+        current = pedersen_hash<Composer>::hash_pair(left, right, 0, is_updating_tree);
     }
+    return current;
+}
 
-    return (current == root);
+/**
+ * Checks if the subtree is correctly inserted at a specified index in a Merkle tree.
+ *
+ * @param root: The root of the latest state of the merkle tree,
+ * @param hashes: The hash path from any leaf in the subtree to the root, it doesn't matter if this hash path is
+ * computed before or after updating the tree,
+ * @param value: The value of the subtree root,
+ * @param index: The index of any leaf in the subtree,
+ * @param at_height: The height of the subtree,
+ * @param is_updating_tree: set to true if we're updating the tree.
+ * @tparam Composer: type of composer.
+ *
+ * @see Check full documentation: https://hackmd.io/2zyJc6QhRuugyH8D78Tbqg?view
+ */
+template <typename Composer>
+bool_t<Composer> check_subtree_membership(field_t<Composer> const& root,
+                                          hash_path<Composer> const& hashes,
+                                          field_t<Composer> const& value,
+                                          bit_vector<Composer> const& index,
+                                          size_t at_height,
+                                          bool const is_updating_tree = false)
+{
+    return (compute_root_from_subtree(hashes, value, index, at_height, is_updating_tree) == root);
 }
 
 /**
@@ -228,7 +249,7 @@ template <typename Composer> field_t<Composer> compute_tree_root(std::vector<fie
     while (layer.size() > 1) {
         std::vector<field_t<Composer>> next_layer(layer.size() / 2);
         for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = pedersen_hash<Composer>::hash_multiple({ layer[i * 2], layer[i * 2 + 1] });
+            next_layer[i] = pedersen_hash<Composer>::hash_pair(layer[i * 2], layer[i * 2 + 1]);
         }
         layer = std::move(next_layer);
     }
@@ -289,6 +310,170 @@ void batch_update_membership(field_t<Composer> const& new_root,
         new_root, rollup_root, old_root, old_path, zero_subtree_root, start_index.decompose_into_bits(), height, msg);
 }
 
+/**
+ * Computes the root of the subtree at `height` that contains a leaf, from the leaf's value and hash path.
+ *
+ * @param hashes: The hash path of the leaf (only the first `height` levels are used),
+ * @param value: The value of the leaf,
+ * @param index: The index of the leaf in the tree,
+ * @param height: The height of the subtree,
+ * @param is_updating_tree: set to true if we're updating the tree.
+ * @tparam Composer: type of composer.
+ */
+template <typename Composer>
+field_t<Composer> compute_subtree_root(hash_path<Composer> const& hashes,
+                                       field_t<Composer> const& value,
+                                       bit_vector<Composer> const& index,
+                                       size_t height,
+                                       bool const is_updating_tree = false)
+{
+    auto current = value;
+    for (size_t i = 0; i < height; ++i) {
+        field_t<Composer> left = field_t<Composer>::conditional_assign(index[i], hashes[i].first, current);
+        field_t<Composer> right = field_t<Composer>::conditional_assign(index[i], current, hashes[i].second);
+        current = pedersen_hash<Composer>::hash_pair(left, right, 0, is_updating_tree);
+    }
+    return current;
+}
+
+/**
+ * Returns the position of a leaf's subtree among the `num_subtrees` subtrees at `height`, i.e. the value of the bits
+ * of the leaf's index above `height`.
+ */
+template <typename Composer>
+field_t<Composer> get_subtree_position(bit_vector<Composer> const& index, size_t height, size_t num_subtrees)
+{
+    field_t<Composer> position(0);
+    for (size_t i = numeric::get_msb(num_subtrees); i > 0; --i) {
+        position = position + position + field_t<Composer>(index[height + i - 1]);
+    }
+    return position;
+}
+
+/**
+ * Checks if a set of values are all in a Merkle tree, at the given indices.
+ *
+ * Checking each value with `check_membership` hashes a full root path per value, although the paths share their upper
+ * levels. Here the tree is split at a height h: the 2^t = `subtree_roots.size()` nodes at that height are hashed into
+ * the root once (2^t - 1 hashes), and every value is only hashed up to the root of its subtree (h hashes), which is
+ * then looked up among the subtree roots. For n values in a tree of depth d this costs n * (d - t) + 2^t - 1 hashes
+ * instead of n * d; with 2^t close to n it saves roughly n * (log2(n) - 1) hashes.
+ *
+ * @param root: The root of the merkle tree,
+ * @param values: The values of the leaves,
+ * @param paths: The hash paths of the leaves (only the first h levels are used),
+ * @param indices: The indices of the leaves in the tree,
+ * @param subtree_roots: The roots of all subtrees at height h, left to right (see `get_subtree_roots`). Their number
+ * must be a power of two.
+ * @tparam Composer: type of composer.
+ */
+template <typename Composer>
+bool_t<Composer> check_batch_membership(field_t<Composer> const& root,
+                                        std::vector<field_t<Composer>> const& values,
+                                        std::vector<hash_path<Composer>> const& paths,
+                                        std::vector<bit_vector<Composer>> const& indices,
+                                        std::vector<field_t<Composer>> const& subtree_roots)
+{
+    ASSERT(values.size() == paths.size() && values.size() == indices.size());
+    const size_t num_subtrees = subtree_roots.size();
+    ASSERT(num_subtrees > 0 && (num_subtrees & (num_subtrees - 1)) == 0);
+    const size_t height = indices.empty() ? 0 : indices[0].size() - numeric::get_msb(num_subtrees);
+
+    std::vector<field_t<Composer>> positions;
+    for (const auto& index : indices) {
+        positions.push_back(get_subtree_position(index, height, num_subtrees));
+    }
+    std::vector<field_t<Composer>> expected_subtree_roots;
+    if constexpr (Composer::type == ComposerType::PLOOKUP) {
+        rom_table<Composer> table(subtree_roots);
+        for (const auto& position : positions) {
+            expected_subtree_roots.push_back(table[position]);
+        }
+    } else {
+        for (const auto& position : positions) {
+            field_t<Composer> selected(0);
+            for (size_t j = 0; j < num_subtrees; ++j) {
+                selected += field_t<Composer>(position == field_t<Composer>(j)) * subtree_roots[j];
+            }
+            expected_subtree_roots.push_back(selected);
+        }
+    }
+
+    bool_t<Composer> is_member = compute_tree_root(subtree_roots) == root;
+    for (size_t i = 0; i < values.size(); ++i) {
+        const auto subtree_root = compute_subtree_root(paths[i], values[i], indices[i], height);
+        is_member = is_member && (subtree_root == expected_subtree_roots[i]);
+    }
+    return is_member;
+}
+
+/**
+ * Asserts if a set of values are all in a Merkle tree, at the given indices. See `check_batch_membership`.
+ */
+template <typename Composer>
+void assert_check_batch_membership(field_t<Composer> const& root,
+                                   std::vector<field_t<Composer>> const& values,
+                                   std::vector<hash_path<Composer>> const& paths,
+                                   std::vector<bit_vector<Composer>> const& indices,
+                                   std::vector<field_t<Composer>> const& subtree_roots,
+                                   std::string const& msg = "assert_check_batch_membership")
+{
+    auto exists = check_batch_membership(root, values, paths, indices, subtree_roots);
+    exists.assert_equal(true, msg);
+}
+
+/**
+ * Asserts if the state transitions on updating multiple existing leaves with new values, and returns the new root.
+ *
+ * Checks the same as `update_memberships`, sharing the upper levels of the tree between the updates as in
+ * `check_batch_membership`: the old root is checked against the subtree roots at height h once, every update then
+ * replaces the root of its subtree in a RAM table (after checking the old value against it), and the new root is
+ * hashed from the final subtree roots once. Needs RAM tables, i.e. UltraComposer.
+ *
+ * @param old_root: The root of the merkle tree before it was updated,
+ * @param new_values: The new values that are inserted in the existing leaves,
+ * @param old_values: The values of the existing leaves that were updated,
+ * @param old_paths: The hash path from the given index right before a given existing leaf is updated (only the
+ * first h levels are used),
+ * @param old_indicies: Indices of the existing leaves that need to be updated,
+ * @param old_subtree_roots: The roots of all subtrees at height h before any update, left to right (see
+ * `get_subtree_roots`). Their number must be a power of two.
+ * @tparam Composer: type of composer.
+ */
+template <typename Composer>
+field_t<Composer> batch_update_memberships(field_t<Composer> const& old_root,
+                                           std::vector<field_t<Composer>> const& new_values,
+                                           std::vector<field_t<Composer>> const& old_values,
+                                           std::vector<hash_path<Composer>> const& old_paths,
+                                           std::vector<bit_vector<Composer>> const& old_indicies,
+                                           std::vector<field_t<Composer>> const& old_subtree_roots)
+{
+    static_assert(Composer::type == ComposerType::PLOOKUP,
+                  "batch_update_memberships needs RAM tables, use update_memberships instead");
+    ASSERT(new_values.size() == old_values.size() && new_values.size() == old_paths.size() &&
+           new_values.size() == old_indicies.size());
+    const size_t num_subtrees = old_subtree_roots.size();
+    ASSERT(num_subtrees > 0 && (num_subtrees & (num_subtrees - 1)) == 0);
+    const size_t height = old_indicies.empty() ? 0 : old_indicies[0].size() - numeric::get_msb(num_subtrees);
+
+    compute_tree_root(old_subtree_roots).assert_equal(old_root, "batch_update_memberships_old_root");
+
+    ram_table<Composer> subtree_roots(old_subtree_roots);
+    for (size_t i = 0; i < new_values.size(); ++i) {
+        const auto position = get_subtree_position(old_indicies[i], height, num_subtrees);
+        const auto old_subtree_root = compute_subtree_root(old_paths[i], old_values[i], old_indicies[i], height);
+        subtree_roots.read(position).assert_equal(old_subtree_root, "batch_update_memberships_old_value");
+        // As in `update_membership`, hashing the new value with the old path checks that only this leaf changes
+        subtree_roots.write(position, compute_subtree_root(old_paths[i], new_values[i], old_indicies[i], height, true));
+    }
+
+    std::vector<field_t<Composer>> new_subtree_roots;
+    for (size_t j = 0; j < num_subtrees; ++j) {
+        new_subtree_roots.push_back(subtree_roots.read(field_t<Composer>(j)));
+    }
+    return compute_tree_root(new_subtree_roots);
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
@@ -273,3 +273,149 @@ TEST(stdlib_merkle_tree, test_update_memberships)
     bool result = verifier.verify_proof(proof);
     EXPECT_EQ(result, true);
 }
+
+TEST(stdlib_merkle_tree, test_check_batch_membership)
+{
+    constexpr size_t depth = 5;
+    constexpr size_t height = 3;
+    MemoryStore store;
+    MerkleTree tree(store, depth);
+
+    Composer composer = Composer();
+
+    std::vector<fr> filled_values;
+    for (size_t i = 0; i < (1UL << depth); i++) {
+        filled_values.push_back(fr::random_element());
+        tree.update_element(i, filled_values[i]);
+    }
+
+    const std::vector<size_t> indices = { 0, 3, 9, 17, 30, 31 };
+    std::vector<field_ct> values_ct;
+    std::vector<hash_path<Composer>> paths_ct;
+    std::vector<bit_vector<Composer>> indices_ct;
+    for (const auto index : indices) {
+        values_ct.push_back(witness_ct(&composer, filled_values[index]));
+        paths_ct.push_back(create_witness_hash_path(composer, tree.get_hash_path(index)));
+        indices_ct.push_back(field_ct(witness_ct(&composer, uint256_t(index))).decompose_into_bits(depth));
+    }
+    std::vector<field_ct> subtree_roots_ct;
+    for (const auto& subtree_root : get_subtree_roots(tree, height)) {
+        subtree_roots_ct.push_back(witness_ct(&composer, subtree_root));
+    }
+    ASSERT_EQ(subtree_roots_ct.size(), 1UL << (depth - height));
+
+    field_ct root = witness_ct(&composer, tree.root());
+    bool_ct is_member = check_batch_membership(root, values_ct, paths_ct, indices_ct, subtree_roots_ct);
+    EXPECT_EQ(is_member.get_value(), true);
+
+    // a value that is not in the tree at its index
+    values_ct[3] = witness_ct(&composer, filled_values[16]);
+    bool_ct is_member_ = check_batch_membership(root, values_ct, paths_ct, indices_ct, subtree_roots_ct);
+    EXPECT_EQ(is_member_.get_value(), false);
+
+    auto prover = composer.create_prover();
+    printf("composer gates = %zu\n", composer.get_num_gates());
+    auto verifier = composer.create_verifier();
+    plonk::proof proof = prover.construct_proof();
+    bool result = verifier.verify_proof(proof);
+    EXPECT_EQ(result, true);
+}
+
+TEST(stdlib_merkle_tree, test_assert_check_batch_membership_fail)
+{
+    constexpr size_t depth = 4;
+    constexpr size_t height = 2;
+    MemoryStore store;
+    MerkleTree tree(store, depth);
+
+    Composer composer = Composer();
+
+    std::vector<fr> filled_values;
+    for (size_t i = 0; i < (1UL << depth); i++) {
+        filled_values.push_back(fr::random_element());
+        tree.update_element(i, filled_values[i]);
+    }
+
+    // the subtree roots of another tree
+    MemoryStore other_store;
+    MerkleTree other_tree(other_store, depth);
+    other_tree.update_element(0, fr::random_element());
+
+    const std::vector<size_t> indices = { 1, 6 };
+    std::vector<field_ct> values_ct;
+    std::vector<hash_path<Composer>> paths_ct;
+    std::vector<bit_vector<Composer>> indices_ct;
+    for (const auto index : indices) {
+        values_ct.push_back(witness_ct(&composer, filled_values[index]));
+        paths_ct.push_back(create_witness_hash_path(composer, tree.get_hash_path(index)));
+        indices_ct.push_back(field_ct(witness_ct(&composer, uint256_t(index))).decompose_into_bits(depth));
+    }
+    std::vector<field_ct> subtree_roots_ct;
+    for (const auto& subtree_root : get_subtree_roots(other_tree, height)) {
+        subtree_roots_ct.push_back(witness_ct(&composer, subtree_root));
+    }
+
+    field_ct root = witness_ct(&composer, tree.root());
+    assert_check_batch_membership(root, values_ct, paths_ct, indices_ct, subtree_roots_ct);
+
+    auto prover = composer.create_prover();
+    auto verifier = composer.create_verifier();
+    plonk::proof proof = prover.construct_proof();
+    bool result = verifier.verify_proof(proof);
+    EXPECT_EQ(result, false);
+}
+
+TEST(stdlib_merkle_tree, test_batch_update_memberships)
+{
+    using UltraComposer = proof_system::plonk::UltraComposer;
+    using field_ult = proof_system::plonk::stdlib::field_t<UltraComposer>;
+    using witness_ult = proof_system::plonk::stdlib::witness_t<UltraComposer>;
+
+    constexpr size_t depth = 5;
+    constexpr size_t height = 2;
+    MemoryStore store;
+    MerkleTree tree(store, depth);
+
+    UltraComposer composer = UltraComposer();
+
+    constexpr size_t filled = (1UL << depth) / 2;
+    std::vector<fr> values(1UL << depth, fr::zero());
+    for (size_t i = 0; i < filled; i++) {
+        values[i] = fr::random_element();
+        tree.update_element(i, values[i]);
+    }
+
+    // old state
+    field_ult old_root_ct = witness_ult(&composer, tree.root());
+    std::vector<field_ult> old_subtree_roots_ct;
+    for (const auto& subtree_root : get_subtree_roots(tree, height)) {
+        old_subtree_roots_ct.push_back(witness_ult(&composer, subtree_root));
+    }
+
+    // updates, including two in the same subtree and two of the same leaf
+    const std::vector<size_t> old_indices = { 0, 2, 5, 13, 2, 20 };
+    std::vector<field_ult> new_values_ct;
+    std::vector<field_ult> old_values_ct;
+    std::vector<hash_path<UltraComposer>> old_hash_paths_ct;
+    std::vector<bit_vector<UltraComposer>> old_indices_ct;
+    for (const auto index : old_indices) {
+        const fr new_value = fr::random_element();
+        old_values_ct.push_back(witness_ult(&composer, values[index]));
+        old_hash_paths_ct.push_back(create_witness_hash_path(composer, tree.get_hash_path(index)));
+        old_indices_ct.push_back(field_ult(witness_ult(&composer, uint256_t(index))).decompose_into_bits(depth));
+        new_values_ct.push_back(witness_ult(&composer, new_value));
+        values[index] = new_value;
+        tree.update_element(index, new_value);
+    }
+
+    field_ult new_root = batch_update_memberships(
+        old_root_ct, new_values_ct, old_values_ct, old_hash_paths_ct, old_indices_ct, old_subtree_roots_ct);
+    EXPECT_EQ(new_root.get_value(), tree.root());
+
+    auto prover = composer.create_prover();
+    printf("composer gates = %zu\n", composer.get_num_gates());
+    auto verifier = composer.create_verifier();
+    plonk::proof proof = prover.construct_proof();
+    bool result = verifier.verify_proof(proof);
+    EXPECT_EQ(result, true);
+}
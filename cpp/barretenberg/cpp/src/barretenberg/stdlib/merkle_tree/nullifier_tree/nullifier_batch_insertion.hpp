@@ -0,0 +1,272 @@
+#pragma once
+#include "../membership.hpp"
+#include "nullifier_memory_tree.hpp"
+
+namespace proof_system::plonk {
+namespace stdlib {
+namespace merkle_tree {
+
+template <typename Composer> struct nullifier_leaf_ct {
+    field_t<Composer> value;
+    field_t<Composer> nextIndex;
+    field_t<Composer> nextValue;
+
+    field_t<Composer> hash() const { return pedersen_hash<Composer>::hash_multiple({ value, nextIndex, nextValue }); }
+};
+
+/**
+ * Circuit version of `nullifier_batch_insertion_witness`.
+ */
+template <typename Composer> struct nullifier_batch_insertion_witness_ct {
+    std::vector<field_t<Composer>> sorted_values;
+    std::vector<field_t<Composer>> sorted_indices;
+    std::vector<nullifier_leaf_ct<Composer>> low_leaves;
+    std::vector<field_t<Composer>> low_leaf_indices;
+    std::vector<hash_path<Composer>> low_leaf_paths;
+    std::vector<bool_t<Composer>> low_leaf_is_pending;
+    hash_path<Composer> subtree_path;
+};
+
+template <typename Composer>
+nullifier_batch_insertion_witness_ct<Composer> create_witness_batch_insertion(
+    Composer& ctx, nullifier_batch_insertion_witness const& input)
+{
+    nullifier_batch_insertion_witness_ct<Composer> result;
+    for (size_t i = 0; i < input.sorted_values.size(); ++i) {
+        result.sorted_values.push_back(witness_t<Composer>(&ctx, input.sorted_values[i]));
+        result.sorted_indices.push_back(witness_t<Composer>(&ctx, fr(input.sorted_indices[i])));
+        const auto& low_leaf = input.low_leaves[i];
+        result.low_leaves.push_back({ witness_t<Composer>(&ctx, low_leaf.value),
+                                      witness_t<Composer>(&ctx, fr(low_leaf.nextIndex)),
+                                      witness_t<Composer>(&ctx, low_leaf.nextValue) });
+        result.low_leaf_indices.push_back(witness_t<Composer>(&ctx, fr(input.low_leaf_indices[i])));
+        result.low_leaf_paths.push_back(create_witness_hash_path(ctx, input.low_leaf_paths[i]));
+        const bool is_pending = input.low_leaf_is_pending[i];
+        result.low_leaf_is_pending.push_back(witness_t<Composer>(&ctx, is_pending));
+    }
+    result.subtree_path = create_witness_hash_path(ctx, input.subtree_path);
+    return result;
+}
+
+/**
+ * Splits `value` into 128-bit limbs (lo, hi), and checks that hi * 2^128 + lo is the canonical representative of
+ * `value`, i.e. is smaller than the modulus. Values can then be compared as integers via their limbs.
+ */
+template <typename Composer> std::array<field_t<Composer>, 2> split_into_canonical_limbs(field_t<Composer> const& value)
+{
+    const uint256_t native = value.get_value();
+    if (value.is_constant()) {
+        return { field_t<Composer>(native.slice(0, 128)), field_t<Composer>(native.slice(128, 256)) };
+    }
+    Composer* ctx = value.get_context();
+    const field_t<Composer> shift(ctx, fr(uint256_t(1) << 128));
+
+    const field_t<Composer> lo = witness_t<Composer>(ctx, fr(native.slice(0, 128)));
+    const field_t<Composer> hi = witness_t<Composer>(ctx, fr(native.slice(128, 256)));
+    lo.create_range_constraint(128, "split_into_canonical_limbs: lo too large");
+    hi.create_range_constraint(128, "split_into_canonical_limbs: hi too large");
+    value.assert_equal(lo + hi * shift, "split_into_canonical_limbs: limbs do not match value");
+    field_t<Composer>::assert_canonical_limbs(lo, hi, 128, "split_into_canonical_limbs: value not canonical");
+    return { lo, hi };
+}
+
+/**
+ * Asserts that a < b as integers, given their canonical limbs, if `predicate` is true.
+ */
+template <typename Composer>
+void assert_limbs_less_than(std::array<field_t<Composer>, 2> const& a,
+                            std::array<field_t<Composer>, 2> const& b,
+                            bool_t<Composer> const& predicate,
+                            std::string const& msg)
+{
+    using field_ct = field_t<Composer>;
+    // If the predicate is false, compare 0 < 1 instead
+    const field_ct a_lo = field_ct::conditional_assign(predicate, a[0], 0);
+    const field_ct a_hi = field_ct::conditional_assign(predicate, a[1], 0);
+    const field_ct b_lo = field_ct::conditional_assign(predicate, b[0], 1);
+    const field_ct b_hi = field_ct::conditional_assign(predicate, b[1], 0);
+    Composer* ctx = predicate.get_context();
+    const field_ct shift(ctx, fr(uint256_t(1) << 128));
+
+    // b - a - 1 >= 0, by schoolbook subtraction on the limbs
+    const bool needs_borrow = uint256_t(b_lo.get_value()) <= uint256_t(a_lo.get_value());
+    const bool_t<Composer> borrow = witness_t<Composer>(ctx, needs_borrow);
+    const field_ct d_lo = b_lo - a_lo - 1 + field_ct(borrow) * shift;
+    const field_ct d_hi = b_hi - a_hi - field_ct(borrow);
+    d_lo.create_range_constraint(128, msg);
+    d_hi.create_range_constraint(128, msg);
+}
+
+/**
+ * Root of a subtree of empty nullifier leaves, computed with the hash the circuit uses.
+ */
+template <typename Composer> fr compute_empty_nullifier_subtree_root(size_t height)
+{
+    const auto hash = [](std::vector<fr> const& inputs) {
+        if constexpr (Composer::type == ComposerType::PLOOKUP &&
+                      Composer::merkle_hash_type == merkle::HashType::LOOKUP_PEDERSEN) {
+            return crypto::pedersen_hash::lookup::hash_multiple(inputs);
+        } else {
+            return crypto::pedersen_hash::hash_multiple(inputs);
+        }
+    };
+    fr current = hash({ 0, 0, 0 });
+    for (size_t i = 0; i < height; ++i) {
+        current = hash({ current, current });
+    }
+    return current;
+}
+
+/**
+ * Asserts the insertion of a batch of values into an indexed (nullifier) tree, and returns the new root.
+ *
+ * Inserting the values one by one costs, per value, a membership check of its low leaf, a root recomputation for the
+ * updated low leaf and another one for the new leaf, and a search of the values inserted before it for a low leaf
+ * that is not in the tree yet. Here, the batch (a power of two of values) is inserted as one subtree of new leaves:
+ *
+ * 1. The prover supplies the batch in ascending order, zeros first. Its order is checked once, with one comparison
+ *    per value, and it is checked to be a permutation of `values` (a ROM table lookup per value on Ultra): every
+ *    sorted value is one of the values, the non-zero sorted values are distinct, and both have the same number of
+ *    zeros. Sorting also rejects duplicates within the batch.
+ * 2. The low leaf of each non-zero value is either a leaf of the tree, which is checked against the current root and
+ *    updated to point to the value (two root computations), or, if `low_leaf_is_pending`, the previous value of the
+ *    batch. Either way the value has to be strictly between the low leaf's value and its next value (unless the low
+ *    leaf is the last one). A low leaf in the tree with value 0 has to be the first leaf, so empty leaves cannot be
+ *    used as low leaves.
+ * 3. The new leaves replace an empty subtree at `start_index`, which has to be a multiple of the batch size, using
+ *    one hash path for the subtree.
+ *
+ * Zero values are not inserted: their leaves in the subtree stay empty.
+ *
+ * @param old_root: The root of the tree before the insertion,
+ * @param start_index: The index of the first leaf of the subtree the batch is inserted in,
+ * @param values: The values to insert, in any order,
+ * @param witness: See `nullifier_batch_insertion_witness` and `NullifierMemoryTree::batch_update`.
+ * @tparam Composer: type of composer.
+ */
+template <typename Composer>
+field_t<Composer> batch_insert_nullifiers(field_t<Composer> const& old_root,
+                                          field_t<Composer> const& start_index,
+                                          std::vector<field_t<Composer>> const& values,
+                                          nullifier_batch_insertion_witness_ct<Composer> const& witness)
+{
+    using field_ct = field_t<Composer>;
+    using bool_ct = bool_t<Composer>;
+    const size_t batch_size = values.size();
+    ASSERT(numeric::is_power_of_two(batch_size));
+    ASSERT(witness.sorted_values.size() == batch_size && witness.sorted_indices.size() == batch_size &&
+           witness.low_leaves.size() == batch_size && witness.low_leaf_indices.size() == batch_size &&
+           witness.low_leaf_paths.size() == batch_size && witness.low_leaf_is_pending.size() == batch_size);
+    const size_t subtree_height = numeric::get_msb(batch_size);
+    const size_t depth = witness.subtree_path.size();
+    const auto& sorted_values = witness.sorted_values;
+
+    // 1. `sorted_values` is `values` in ascending order
+    std::vector<field_ct> permuted_values;
+    if constexpr (Composer::type == ComposerType::PLOOKUP) {
+        rom_table<Composer> table(values);
+        for (const auto& index : witness.sorted_indices) {
+            permuted_values.push_back(table[index]);
+        }
+    } else {
+        for (const auto& index : witness.sorted_indices) {
+            field_ct selected(0);
+            for (size_t j = 0; j < batch_size; ++j) {
+                selected += field_ct(index == field_ct(j)) * values[j];
+            }
+            permuted_values.push_back(selected);
+        }
+    }
+    std::vector<bool_ct> is_zero;
+    std::vector<std::array<field_ct, 2>> limbs;
+    field_ct num_zero_values(0);
+    field_ct num_zero_sorted_values(0);
+    for (size_t i = 0; i < batch_size; ++i) {
+        sorted_values[i].assert_equal(permuted_values[i], "batch_insert_nullifiers: values not permuted");
+        is_zero.push_back(sorted_values[i].is_zero());
+        num_zero_values += field_ct(values[i].is_zero());
+        num_zero_sorted_values += field_ct(is_zero[i]);
+        limbs.push_back(split_into_canonical_limbs(sorted_values[i]));
+        if (i > 0) {
+            assert_limbs_less_than(limbs[i - 1], limbs[i], !is_zero[i - 1], "batch_insert_nullifiers: not sorted");
+        }
+    }
+    num_zero_values.assert_equal(num_zero_sorted_values, "batch_insert_nullifiers: values not permuted");
+
+    // 2. Update the low leaves
+    const auto start_index_bits = start_index.decompose_into_bits(depth);
+    for (size_t i = 0; i < subtree_height; ++i) {
+        start_index_bits[i].assert_equal(false, "batch_insert_nullifiers: subtree not aligned");
+    }
+    witness.low_leaf_is_pending[0].assert_equal(false, "batch_insert_nullifiers: no pending low leaf");
+
+    field_ct current_root = old_root;
+    std::vector<nullifier_leaf_ct<Composer>> new_leaves;
+    for (size_t i = 0; i < batch_size; ++i) {
+        const field_ct& value = sorted_values[i];
+        const field_ct new_index = start_index + field_ct(i);
+        const bool_ct& is_pending = witness.low_leaf_is_pending[i];
+        if (i > 0) {
+            (is_pending && is_zero[i - 1]).assert_equal(false, "batch_insert_nullifiers: pending low leaf is zero");
+        }
+        const bool_ct in_tree = !is_zero[i] && !is_pending;
+
+        // The low leaf in the tree is in the current tree, and is not an empty leaf
+        const auto& tree_low_leaf = witness.low_leaves[i];
+        const auto& low_leaf_index = witness.low_leaf_indices[i];
+        const auto& low_leaf_path = witness.low_leaf_paths[i];
+        const auto low_leaf_index_bits = low_leaf_index.decompose_into_bits(depth);
+        field_ct::conditional_assign(in_tree && tree_low_leaf.value.is_zero(), low_leaf_index, 0)
+            .assert_is_zero("batch_insert_nullifiers: empty low leaf");
+        const auto low_leaf_root =
+            compute_root_from_subtree(low_leaf_path, tree_low_leaf.hash(), low_leaf_index_bits, 0);
+        field_ct::conditional_assign(in_tree, low_leaf_root, current_root)
+            .assert_equal(current_root, "batch_insert_nullifiers: low leaf not in tree");
+        const nullifier_leaf_ct<Composer> updated_low_leaf = { tree_low_leaf.value, new_index, value };
+        const auto updated_root =
+            compute_root_from_subtree(low_leaf_path, updated_low_leaf.hash(), low_leaf_index_bits, 0, true);
+        current_root = field_ct::conditional_assign(in_tree, updated_root, current_root);
+
+        // The value goes between the low leaf and its next value
+        nullifier_leaf_ct<Composer> low_leaf = tree_low_leaf;
+        if (i > 0) {
+            auto& previous = new_leaves[i - 1];
+            low_leaf = { field_ct::conditional_assign(is_pending, previous.value, tree_low_leaf.value),
+                         field_ct::conditional_assign(is_pending, previous.nextIndex, tree_low_leaf.nextIndex),
+                         field_ct::conditional_assign(is_pending, previous.nextValue, tree_low_leaf.nextValue) };
+            previous.nextIndex = field_ct::conditional_assign(is_pending, new_index, previous.nextIndex);
+            previous.nextValue = field_ct::conditional_assign(is_pending, value, previous.nextValue);
+        }
+        assert_limbs_less_than(split_into_canonical_limbs(low_leaf.value),
+                               limbs[i],
+                               !is_zero[i],
+                               "batch_insert_nullifiers: low leaf too large");
+        assert_limbs_less_than(limbs[i],
+                               split_into_canonical_limbs(low_leaf.nextValue),
+                               !is_zero[i] && !low_leaf.nextValue.is_zero(),
+                               "batch_insert_nullifiers: next value too small");
+        new_leaves.push_back({ value,
+                               field_ct::conditional_assign(is_zero[i], 0, low_leaf.nextIndex),
+                               field_ct::conditional_assign(is_zero[i], 0, low_leaf.nextValue) });
+    }
+
+    // 3. Replace the empty subtree at `start_index` with the new leaves
+    const field_ct empty_subtree_root(compute_empty_nullifier_subtree_root<Composer>(subtree_height));
+    assert_check_subtree_membership(current_root,
+                                    witness.subtree_path,
+                                    empty_subtree_root,
+                                    start_index_bits,
+                                    subtree_height,
+                                    false,
+                                    "batch_insert_nullifiers: subtree not empty");
+    std::vector<field_ct> new_leaf_hashes;
+    for (const auto& leaf : new_leaves) {
+        new_leaf_hashes.push_back(leaf.hash());
+    }
+    return compute_root_from_subtree(
+        witness.subtree_path, compute_tree_root(new_leaf_hashes), start_index_bits, subtree_height, true);
+}
+
+} // namespace merkle_tree
+} // namespace stdlib
+} // namespace proof_system::plonk
@@ -0,0 +1,150 @@
+#include "nullifier_batch_insertion.hpp"
+#include <gtest/gtest.h>
+#include "barretenberg/stdlib/types/types.hpp"
+
+using namespace barretenberg;
+using namespace proof_system::plonk::stdlib::types;
+using namespace proof_system::plonk::stdlib::merkle_tree;
+
+namespace {
+
+fr compute_root_from_leaves(std::vector<nullifier_leaf> leaves, const size_t depth)
+{
+    leaves.resize(1UL << depth, { 0, 0, 0 });
+    std::vector<fr> hashes;
+    for (const auto& leaf : leaves) {
+        hashes.push_back(leaf.hash());
+    }
+    return compute_tree_root_native(hashes);
+}
+
+struct BatchInsertion {
+    fr old_root;
+    fr new_root;
+    nullifier_batch_insertion_witness witness;
+};
+
+// A tree holding 15 and 50, into which a batch exercising low leaves in the tree and pending ones is inserted
+BatchInsertion insert_batch(NullifierMemoryTree& tree)
+{
+    tree.update_element(50);
+    tree.update_element(15);
+    const fr old_root = tree.root();
+    const auto witness = tree.batch_update({ 40, 0, 12, 60, 45, 0, 17, 13 });
+    return { old_root, tree.root(), witness };
+}
+
+bool prove_batch_insertion(BatchInsertion const& insertion, std::vector<fr> const& values, fr* new_root = nullptr)
+{
+    Composer composer = Composer();
+    field_ct old_root = witness_ct(&composer, insertion.old_root);
+    field_ct start_index = witness_ct(&composer, fr(insertion.witness.start_index));
+    std::vector<field_ct> values_ct;
+    for (const auto& value : values) {
+        values_ct.push_back(witness_ct(&composer, value));
+    }
+    const auto witness = create_witness_batch_insertion(composer, insertion.witness);
+
+    field_ct root = batch_insert_nullifiers(old_root, start_index, values_ct, witness);
+    if (new_root != nullptr) {
+        *new_root = root.get_value();
+    }
+
+    auto prover = composer.create_prover();
+    printf("composer gates = %zu\n", composer.get_num_gates());
+    auto verifier = composer.create_verifier();
+    plonk::proof proof = prover.construct_proof();
+    return verifier.verify_proof(proof);
+}
+
+} // namespace
+
+TEST(stdlib_nullifier_tree, test_native_batch_update)
+{
+    constexpr size_t depth = 3;
+    NullifierMemoryTree tree(depth);
+
+    /**
+     * Insert 30, 0, 10, 20: the leaves 1 to 3 are skipped so the batch is aligned, the batch is inserted sorted, and
+     * only the first leaf of the tree is a low leaf (of 10), the low leaves of 20 and 30 are in the batch.
+     *
+     *  index     0       1       2       3        4       5       6       7
+     *  ---------------------------------------------------------------------
+     *  val       0       0       0       0        0       10      20      30
+     *  nextIdx   5       0       0       0        0       6       7       0
+     *  nextVal   10      0       0       0        0       20      30      0
+     */
+    const auto witness = tree.batch_update({ 30, 0, 10, 20 });
+    EXPECT_EQ(witness.start_index, 4);
+    EXPECT_EQ(witness.sorted_values, std::vector<fr>({ 0, 10, 20, 30 }));
+    EXPECT_EQ(witness.sorted_indices, std::vector<size_t>({ 1, 2, 3, 0 }));
+    EXPECT_EQ(witness.low_leaf_is_pending, std::vector<bool>({ false, false, true, true }));
+    EXPECT_EQ(witness.low_leaf_indices[1], 0);
+
+    const std::vector<nullifier_leaf> expected = {
+        { 0, 5, 10 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 }, { 10, 6, 20 }, { 20, 7, 30 }, { 30, 0, 0 },
+    };
+    EXPECT_EQ(tree.get_leaves(), expected);
+    EXPECT_EQ(tree.root(), compute_root_from_leaves(expected, depth));
+}
+
+TEST(stdlib_nullifier_tree, test_native_batch_update_rejects_repeated_values)
+{
+    NullifierMemoryTree tree(4);
+    tree.update_element(15);
+    const fr root = tree.root();
+    const auto leaves = tree.get_leaves();
+
+    // The circuit rejects both batches, so the native tree must not compute a root for them either
+    EXPECT_THROW(tree.batch_update({ 40, 0, 12, 40 }), std::runtime_error);
+    EXPECT_THROW(tree.batch_update({ 40, 0, 15, 20 }), std::runtime_error);
+    EXPECT_EQ(tree.root(), root);
+    EXPECT_EQ(tree.get_leaves(), leaves);
+
+    // Repeated zeros are not inserted, so they are allowed
+    tree.batch_update({ 40, 0, 0, 20 });
+    EXPECT_EQ(tree.root(), compute_root_from_leaves(tree.get_leaves(), 4));
+}
+
+TEST(stdlib_nullifier_tree, test_batch_insert_nullifiers)
+{
+    NullifierMemoryTree tree(5);
+    const auto insertion = insert_batch(tree);
+    EXPECT_EQ(insertion.witness.start_index, 8);
+    EXPECT_EQ(insertion.new_root, compute_root_from_leaves(tree.get_leaves(), 5));
+
+    fr new_root;
+    EXPECT_TRUE(prove_batch_insertion(insertion, { 40, 0, 12, 60, 45, 0, 17, 13 }, &new_root));
+    EXPECT_EQ(new_root, insertion.new_root);
+}
+
+TEST(stdlib_nullifier_tree, test_batch_insert_nullifiers_not_sorted_fails)
+{
+    NullifierMemoryTree tree(5);
+    auto insertion = insert_batch(tree);
+
+    // 12 and 13 swapped
+    std::swap(insertion.witness.sorted_values[2], insertion.witness.sorted_values[3]);
+    std::swap(insertion.witness.sorted_indices[2], insertion.witness.sorted_indices[3]);
+    EXPECT_FALSE(prove_batch_insertion(insertion, { 40, 0, 12, 60, 45, 0, 17, 13 }));
+}
+
+TEST(stdlib_nullifier_tree, test_batch_insert_nullifiers_wrong_low_leaf_fails)
+{
+    NullifierMemoryTree tree(5);
+    auto insertion = insert_batch(tree);
+
+    // 17 goes between 15 and 50, not after 13
+    ASSERT_EQ(insertion.witness.sorted_values[4], 17);
+    insertion.witness.low_leaf_is_pending[4] = true;
+    EXPECT_FALSE(prove_batch_insertion(insertion, { 40, 0, 12, 60, 45, 0, 17, 13 }));
+}
+
+TEST(stdlib_nullifier_tree, test_batch_insert_nullifiers_not_a_permutation_fails)
+{
+    NullifierMemoryTree tree(5);
+    const auto insertion = insert_batch(tree);
+
+    // 60 is not inserted
+    EXPECT_FALSE(prove_batch_insertion(insertion, { 40, 0, 12, 61, 45, 0, 17, 13 }));
+}
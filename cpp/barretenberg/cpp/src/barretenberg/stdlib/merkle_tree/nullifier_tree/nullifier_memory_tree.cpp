@@ -1,5 +1,8 @@
 #include "nullifier_memory_tree.hpp"
 #include "../hash.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <numeric>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -60,6 +63,93 @@ fr NullifierMemoryTree::update_element(fr const& value)
     return root;
 }
 
+/**
+ * Inserts a batch of values as one subtree, and returns what `batch_insert_nullifiers` needs to prove the insertion.
+ *
+ * The number of values must be a power of two. Empty leaves are skipped until the next leaf index is a multiple of it,
+ * so the subtree is aligned. Zero values are not inserted: their leaves in the subtree stay empty.
+ *
+ * Every other value must be new, as `batch_insert_nullifiers` requires: a value that is already in the tree, or that
+ * appears twice in the batch, throws (aborts in WASM) before the tree is modified.
+ */
+nullifier_batch_insertion_witness NullifierMemoryTree::batch_update(std::vector<fr> const& values)
+{
+    const size_t batch_size = values.size();
+    ASSERT(numeric::is_power_of_two(batch_size));
+
+    nullifier_batch_insertion_witness witness;
+    witness.sorted_indices.resize(batch_size);
+    std::iota(witness.sorted_indices.begin(), witness.sorted_indices.end(), 0);
+    std::sort(witness.sorted_indices.begin(), witness.sorted_indices.end(), [&](size_t lhs, size_t rhs) {
+        return uint256_t(values[lhs]) < uint256_t(values[rhs]);
+    });
+    // find_closest_leaf only sees the leaves already in the tree, so duplicates within the batch are found sorted
+    for (size_t i = 0; i < batch_size; ++i) {
+        const fr value = values[witness.sorted_indices[i]];
+        if (value == 0) {
+            continue;
+        }
+        if (i > 0 && values[witness.sorted_indices[i - 1]] == value) {
+            throw_or_abort("NullifierMemoryTree::batch_update: value appears twice in the batch");
+        }
+        if (find_closest_leaf(leaves_, value).second) {
+            throw_or_abort("NullifierMemoryTree::batch_update: value already in the tree");
+        }
+    }
+
+    const nullifier_leaf zero_leaf = { 0, 0, 0 };
+    while (leaves_.size() % batch_size != 0) {
+        leaves_.push_back(zero_leaf);
+    }
+    const size_t start_index = leaves_.size();
+    ASSERT(start_index + batch_size <= total_size_);
+    witness.start_index = start_index;
+
+    std::vector<nullifier_leaf> new_leaves;
+    for (size_t i = 0; i < batch_size; ++i) {
+        const fr value = values[witness.sorted_indices[i]];
+        witness.sorted_values.push_back(value);
+
+        // The previous value of the batch is the low leaf if it sits between the low leaf in the tree and `value`
+        const size_t current = find_closest_leaf(leaves_, value).first;
+        const bool is_pending =
+            value != 0 && i > 0 && uint256_t(new_leaves[i - 1].value) > uint256_t(leaves_[current].value);
+        witness.low_leaf_is_pending.push_back(is_pending);
+
+        if (value == 0 || is_pending) {
+            witness.low_leaves.push_back(zero_leaf);
+            witness.low_leaf_indices.push_back(0);
+            witness.low_leaf_paths.push_back(get_hash_path(0));
+        } else {
+            witness.low_leaves.push_back(leaves_[current]);
+            witness.low_leaf_indices.push_back(current);
+            witness.low_leaf_paths.push_back(get_hash_path(current));
+        }
+
+        if (value == 0) {
+            new_leaves.push_back(zero_leaf);
+        } else if (is_pending) {
+            const nullifier_leaf low_leaf = new_leaves[i - 1];
+            new_leaves.push_back({ .value = value, .nextIndex = low_leaf.nextIndex, .nextValue = low_leaf.nextValue });
+            new_leaves[i - 1].nextIndex = start_index + i;
+            new_leaves[i - 1].nextValue = value;
+        } else {
+            auto& low_leaf = leaves_[current];
+            new_leaves.push_back({ .value = value, .nextIndex = low_leaf.nextIndex, .nextValue = low_leaf.nextValue });
+            low_leaf.nextIndex = start_index + i;
+            low_leaf.nextValue = value;
+            update_element(current, low_leaf.hash());
+        }
+    }
+
+    witness.subtree_path = get_hash_path(start_index);
+    for (size_t i = 0; i < batch_size; ++i) {
+        leaves_.push_back(new_leaves[i]);
+        update_element(start_index + i, new_leaves[i].hash());
+    }
+    return witness;
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
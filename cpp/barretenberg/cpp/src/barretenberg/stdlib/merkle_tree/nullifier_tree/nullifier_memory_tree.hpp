@@ -9,6 +9,26 @@ namespace merkle_tree {
 
 using namespace barretenberg;
 
+/**
+ * The values the prover supplies to `batch_insert_nullifiers` (see nullifier_batch_insertion.hpp) for inserting a
+ * batch of values at once, as computed by `NullifierMemoryTree::batch_update`.
+ *
+ * The batch is inserted in ascending order (zeros, which are not inserted, first) as one subtree starting at
+ * `start_index`: `sorted_values[i] == values[sorted_indices[i]]` ends up at `start_index + i`. The low leaf of each
+ * value is either a leaf of the tree, given with its index and its hash path right before it is updated, or, if
+ * `low_leaf_is_pending[i]`, the previous value of the batch (the corresponding low leaf entries are then unused).
+ */
+struct nullifier_batch_insertion_witness {
+    index_t start_index;
+    std::vector<fr> sorted_values;
+    std::vector<size_t> sorted_indices;
+    std::vector<nullifier_leaf> low_leaves;
+    std::vector<index_t> low_leaf_indices;
+    std::vector<fr_hash_path> low_leaf_paths;
+    std::vector<bool> low_leaf_is_pending;
+    fr_hash_path subtree_path;
+};
+
 /**
  * An NullifierMemoryTree is structured just like a usual merkle tree:
  *
@@ -77,6 +97,8 @@ class NullifierMemoryTree : public MemoryTree {
 
     fr update_element(fr const& value);
 
+    nullifier_batch_insertion_witness batch_update(std::vector<fr> const& values);
+
     const std::vector<barretenberg::fr>& get_hashes() { return hashes_; }
     const std::vector<nullifier_leaf>& get_leaves() { return leaves_; }
     const nullifier_leaf& get_leaf(size_t index) { return leaves_[index]; }
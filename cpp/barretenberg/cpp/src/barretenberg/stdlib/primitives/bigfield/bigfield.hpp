@@ -437,6 +437,19 @@ template <typename Composer, typename T> class bigfield {
     static std::pair<uint512_t, uint512_t> compute_quotient_remainder_values(const bigfield& a,
                                                                              const bigfield& b,
                                                                              const std::vector<bigfield>& to_add);
+    /**
+     * @brief Compute the quotient and remainder of \sum as[i] * bs[i] + \sum to_add by the target modulus
+     *
+     * @details The remainder is accumulated natively in Montgomery form. The quotient then follows by exact division:
+     * sum - remainder is a multiple of the modulus, so multiplying it by the inverse of the modulus mod 2^512 recovers
+     * the quotient mod 2^512 (the same value as the low half of a uint1024_t divmod). Neither step needs the full
+     * 1024-bit product sum.
+     */
+    static std::pair<uint512_t, uint512_t> compute_quotient_remainder_values(const std::vector<uint512_t>& as,
+                                                                             const std::vector<uint512_t>& bs,
+                                                                             const std::vector<uint512_t>& to_add);
+    static native reduce_to_native(const uint512_t& value);
+    static uint512_t compute_exact_quotient_value(const uint512_t& multiple_of_modulus);
     /**
      * @brief Compute the maximum possible value of quotient of a*b+\sum(to_add)
      *
@@ -838,6 +838,55 @@ template <typename Composer> class stdlib_bigfield : public testing::Test {
         EXPECT_EQ(proof_result, true);
     }
 
+    // Operands whose values exceed the modulus, mixed with constants, exercise the quotient and remainder computation on
+    // inputs that are not canonical field elements
+    static void test_unreduced_operands()
+    {
+        auto composer = Composer();
+        const size_t num_terms = 4;
+        // (value + 1) + (p - 1) is congruent to value, but its integer value exceeds the modulus
+        const auto create_unreduced_witness = [&composer](const fq& value) {
+            return fq_ct::create_from_u512_as_witness(&composer, uint256_t(value + fq(1))) +
+                   fq_ct::create_from_u512_as_witness(&composer, uint256_t(-fq(1)));
+        };
+        std::vector<fq_ct> lefts;
+        std::vector<fq_ct> rights;
+        std::vector<fq_ct> to_add;
+        fq left_values[num_terms];
+        fq right_values[num_terms];
+        fq to_add_values[num_terms];
+        fq expected_mult_madd(0);
+        for (size_t i = 0; i < num_terms; ++i) {
+            left_values[i] = fq::random_element();
+            right_values[i] = fq::random_element();
+            to_add_values[i] = fq::random_element();
+            lefts.emplace_back(create_unreduced_witness(left_values[i]));
+            // Every other right hand side is a constant, so that mult_madd has to fold constant products
+            rights.emplace_back((i & 1) ? fq_ct(&composer, uint256_t(right_values[i]))
+                                        : create_unreduced_witness(right_values[i]));
+            to_add.emplace_back(create_unreduced_witness(to_add_values[i]));
+            expected_mult_madd += left_values[i] * right_values[i] + to_add_values[i];
+        }
+        EXPECT_GT(lefts[0].get_value(), uint512_t(fq::modulus));
+
+        const fq_ct madd_result = lefts[0].madd(rights[0], { to_add[0], to_add[1] });
+        const fq_ct sqradd_result = lefts[1].sqradd({ to_add[2] });
+        const fq_ct mult_madd_result = fq_ct::mult_madd(lefts, rights, to_add);
+        const fq_ct div_result = fq_ct::div_check_denominator_nonzero({ lefts[2], lefts[3] }, rights[0]);
+
+        const auto as_fq = [](const fq_ct& x) { return fq((x.get_value() % uint512_t(fq::modulus)).lo); };
+        EXPECT_EQ(as_fq(madd_result), left_values[0] * right_values[0] + to_add_values[0] + to_add_values[1]);
+        EXPECT_EQ(as_fq(sqradd_result), left_values[1].sqr() + to_add_values[2]);
+        EXPECT_EQ(as_fq(mult_madd_result), expected_mult_madd);
+        EXPECT_EQ(as_fq(div_result), (left_values[2] + left_values[3]) / right_values[0]);
+
+        auto prover = composer.create_prover();
+        auto verifier = composer.create_verifier();
+        plonk::proof proof = prover.construct_proof();
+        bool proof_result = verifier.verify_proof(proof);
+        EXPECT_EQ(proof_result, true);
+    }
+
     static void test_conditional_select_regression()
     {
         auto composer = Composer();
@@ -893,6 +942,10 @@ TYPED_TEST(stdlib_bigfield, div_without_denominator_check)
 {
     TestFixture::test_div();
 }
+TYPED_TEST(stdlib_bigfield, unreduced_operands)
+{
+    TestFixture::test_unreduced_operands();
+}
 TYPED_TEST(stdlib_bigfield, add_and_div)
 {
     TestFixture::test_add_and_div();
@@ -778,16 +778,18 @@ bigfield<C, T> bigfield<C, T>::internal_div(const std::vector<bigfield>& numerat
 
     // a / b = c
     // => c * b = a mod p
-    const uint1024_t left = uint1024_t(numerator_values);
-    const uint1024_t right = uint1024_t(denominator.get_value());
-    const uint1024_t modulus(target_basis.modulus);
-    uint512_t inverse_value = right.lo.invmod(target_basis.modulus).lo;
-    uint1024_t inverse_1024(inverse_value);
-    inverse_value = ((left * inverse_1024) % modulus).lo;
-
-    const uint1024_t quotient_1024 =
-        (uint1024_t(inverse_value) * right + unreduced_zero().get_value() - left) / modulus;
-    const uint512_t quotient_value = quotient_1024.lo;
+    // The inverse is computed in the native field. A denominator that is zero mod p has no inverse; we then fall back to
+    // zero, which leaves the multiply-add below unsatisfiable, as it should be.
+    const uint512_t right = denominator.get_value();
+    const native denominator_native = reduce_to_native(right);
+    const uint512_t inverse_value =
+        denominator_native.is_zero()
+            ? uint512_t(0)
+            : uint512_t(static_cast<uint256_t>(reduce_to_native(numerator_values) / denominator_native));
+
+    // inverse * right + 0 - left is a multiple of the modulus, so the quotient is an exact division
+    const uint512_t quotient_value =
+        compute_exact_quotient_value(inverse_value * right + unreduced_zero().get_value() - numerator_values);
 
     bigfield inverse;
     bigfield quotient;
@@ -898,36 +900,34 @@ template <typename C, typename T> bigfield<C, T> bigfield<C, T>::sqradd(const st
 
     C* ctx = context;
 
-    uint512_t add_values(0);
+    std::vector<uint512_t> add_values;
     bool add_constant = true;
     for (const auto& add_element : to_add) {
         add_element.reduction_check();
-        add_values += add_element.get_value();
+        add_values.push_back(add_element.get_value());
         add_constant = add_constant && (add_element.is_constant());
     }
 
-    const uint1024_t left(get_value());
-    const uint1024_t right(get_value());
-    const uint1024_t add_right(add_values);
-    const uint1024_t modulus(target_basis.modulus);
+    const uint512_t value = get_value();
 
     bigfield remainder;
     bigfield quotient;
     if (is_constant()) {
         if (add_constant) {
 
-            const auto [quotient_1024, remainder_1024] = (left * right + add_right).divmod(modulus);
-            remainder = bigfield(ctx, uint256_t(remainder_1024.lo.lo));
+            const auto [quotient_value, remainder_value] =
+                compute_quotient_remainder_values({ value }, { value }, add_values);
+            remainder = bigfield(ctx, uint256_t(remainder_value.lo));
             return remainder;
         } else {
 
-            const auto [quotient_1024, remainder_1024] = (left * right).divmod(modulus);
+            const auto [quotient_value, remainder_value] = compute_quotient_remainder_values({ value }, { value }, {});
             std::vector<bigfield> new_to_add;
             for (auto& add_element : to_add) {
                 new_to_add.push_back(add_element);
             }
 
-            new_to_add.push_back(bigfield(ctx, remainder_1024.lo.lo));
+            new_to_add.push_back(bigfield(ctx, remainder_value.lo));
             return sum(new_to_add);
         }
     } else {
@@ -940,9 +940,8 @@ template <typename C, typename T> bigfield<C, T> bigfield<C, T>::sqradd(const st
             self_reduce();
             return sqradd(to_add);
         }
-        const auto [quotient_1024, remainder_1024] = (left * right + add_right).divmod(modulus);
-        uint512_t quotient_value = quotient_1024.lo;
-        uint256_t remainder_value = remainder_1024.lo.lo;
+        const auto [quotient_value, remainder_value] =
+            compute_quotient_remainder_values({ value }, { value }, add_values);
 
         quotient = create_from_u512_as_witness(ctx, quotient_value, false, num_quotient_bits);
         remainder = create_from_u512_as_witness(ctx, remainder_value);
@@ -966,24 +965,17 @@ bigfield<C, T> bigfield<C, T>::madd(const bigfield& to_mul, const std::vector<bi
     reduction_check();
     to_mul.reduction_check();
 
-    uint512_t add_values(0);
+    std::vector<uint512_t> add_values;
     bool add_constant = true;
 
     for (const auto& add_element : to_add) {
         add_element.reduction_check();
-        add_values += add_element.get_value();
+        add_values.push_back(add_element.get_value());
         add_constant = add_constant && (add_element.is_constant());
     }
 
-    const uint1024_t left(get_value());
-    const uint1024_t mul_right(to_mul.get_value());
-    const uint1024_t add_right(add_values);
-    const uint1024_t modulus(target_basis.modulus);
-
-    const auto [quotient_1024, remainder_1024] = (left * mul_right + add_right).divmod(modulus);
-
-    const uint512_t quotient_value = quotient_1024.lo;
-    const uint512_t remainder_value = remainder_1024.lo;
+    const auto [quotient_value, remainder_value] =
+        compute_quotient_remainder_values({ get_value() }, { to_mul.get_value() }, add_values);
 
     bigfield remainder;
     bigfield quotient;
@@ -1167,9 +1159,8 @@ bigfield<C, T> bigfield<C, T>::mult_madd(const std::vector<bigfield>& mul_left,
 
     const size_t number_of_products = mul_left.size();
 
-    const uint1024_t modulus(target_basis.modulus);
     uint1024_t worst_case_product_sum(0);
-    uint1024_t add_right_constant_sum(0);
+    std::vector<uint512_t> add_right_constants;
 
     // First we do all constant optimizations
     bool add_constant = true;
@@ -1178,7 +1169,7 @@ bigfield<C, T> bigfield<C, T>::mult_madd(const std::vector<bigfield>& mul_left,
     for (const auto& add_element : to_add) {
         add_element.reduction_check();
         if (add_element.is_constant()) {
-            add_right_constant_sum += uint1024_t(add_element.get_value());
+            add_right_constants.push_back(add_element.get_value());
         } else {
             add_constant = false;
             new_to_add.push_back(add_element);
@@ -1187,15 +1178,16 @@ bigfield<C, T> bigfield<C, T>::mult_madd(const std::vector<bigfield>& mul_left,
 
     // Compute the product sum
     // Optimize constant use
-    uint1024_t sum_of_constant_products(0);
+    std::vector<uint512_t> constant_products_left;
+    std::vector<uint512_t> constant_products_right;
     std::vector<bigfield> new_input_left;
     std::vector<bigfield> new_input_right;
     bool product_sum_constant = true;
     for (size_t i = 0; i < number_of_products; i++) {
         if (mutable_mul_left[i].is_constant() && mutable_mul_right[i].is_constant()) {
             // If constant, just add to the sum
-            sum_of_constant_products +=
-                uint1024_t(mutable_mul_left[i].get_value()) * uint1024_t(mutable_mul_right[i].get_value());
+            constant_products_left.push_back(mutable_mul_left[i].get_value());
+            constant_products_right.push_back(mutable_mul_right[i].get_value());
         } else {
             // If not, add to nonconstant sum and remember the elements
             new_input_left.push_back(mutable_mul_left[i]);
@@ -1221,17 +1213,18 @@ bigfield<C, T> bigfield<C, T>::mult_madd(const std::vector<bigfield>& mul_left,
             }
         }
     }
+    // Compute the constant term we're adding
+    const auto [_, constant_part_remainder] =
+        compute_quotient_remainder_values(constant_products_left, constant_products_right, add_right_constants);
+    const uint256_t constant_part_remainder_256 = constant_part_remainder.lo;
+
     if (product_sum_constant) {
         if (add_constant) {
             // Simply return the constant, no need unsafe_multiply_add
-            const auto [quotient_1024, remainder_1024] =
-                (sum_of_constant_products + add_right_constant_sum).divmod(modulus);
-            ASSERT(!fix_remainder_to_zero || remainder_1024 == 0);
-            return bigfield(ctx, uint256_t(remainder_1024.lo.lo));
+            ASSERT(!fix_remainder_to_zero || constant_part_remainder_256 == 0);
+            return bigfield(ctx, constant_part_remainder_256);
         } else {
-            const auto [quotient_1024, remainder_1024] =
-                (sum_of_constant_products + add_right_constant_sum).divmod(modulus);
-            uint256_t remainder_value = remainder_1024.lo.lo;
+            const uint256_t remainder_value = constant_part_remainder_256;
             bigfield result;
             if (remainder_value == uint256_t(0)) {
                 // No need to add extra term to new_to_add
@@ -1251,20 +1244,16 @@ bigfield<C, T> bigfield<C, T>::mult_madd(const std::vector<bigfield>& mul_left,
 
     // Now that we know that there is at least 1 non-constant multiplication, we can start estimating reductions, etc
 
-    // Compute the constant term we're adding
-    const auto [_, constant_part_remainder_1024] = (sum_of_constant_products + add_right_constant_sum).divmod(modulus);
-    const uint256_t constant_part_remainder_256 = constant_part_remainder_1024.lo.lo;
-
     if (constant_part_remainder_256 != uint256_t(0)) {
         new_to_add.push_back(bigfield(ctx, constant_part_remainder_256));
     }
     // Compute added sum
-    uint1024_t add_right_final_sum(0);
+    std::vector<uint512_t> add_right_final_values;
     uint1024_t add_right_maximum(0);
     for (const auto& add_element : new_to_add) {
         // Technically not needed, but better to leave just in case
         add_element.reduction_check();
-        add_right_final_sum += uint1024_t(add_element.get_value());
+        add_right_final_values.push_back(add_element.get_value());
 
         add_right_maximum += uint1024_t(add_element.get_maximum_value());
     }
@@ -1280,25 +1269,26 @@ bigfield<C, T> bigfield<C, T>::mult_madd(const std::vector<bigfield>& mul_left,
     // We've collapsed all constants, checked if we can compute the sum of products in the worst case, time to check if
     // we need to reduce something
     perform_reductions_for_mult_madd(new_input_left, new_input_right, new_to_add);
-    uint1024_t sum_of_products_final(0);
+    std::vector<uint512_t> left_values;
+    std::vector<uint512_t> right_values;
     for (size_t i = 0; i < final_number_of_products; i++) {
-        sum_of_products_final += uint1024_t(new_input_left[i].get_value()) * uint1024_t(new_input_right[i].get_value());
+        left_values.push_back(new_input_left[i].get_value());
+        right_values.push_back(new_input_right[i].get_value());
     }
 
     // Get the number of range proof bits for the quotient
     const size_t num_quotient_bits = get_quotient_max_bits({ DEFAULT_MAXIMUM_REMAINDER });
 
     // Compute the quotient and remainder
-    const auto [quotient_1024, remainder_1024] = (sum_of_products_final + add_right_final_sum).divmod(modulus);
+    const auto [quotient_value, remainder_value] =
+        compute_quotient_remainder_values(left_values, right_values, add_right_final_values);
 
     // If we are establishing an identity and the remainder has to be zero, we need to check, that it actually is
 
     if (fix_remainder_to_zero) {
         // This is not the only check. Circuit check is coming later :)
-        ASSERT(remainder_1024.lo == uint512_t(0));
+        ASSERT(remainder_value == uint512_t(0));
     }
-    const uint512_t quotient_value = quotient_1024.lo;
-    const uint512_t remainder_value = remainder_1024.lo;
 
     bigfield remainder;
     bigfield quotient;
@@ -2799,20 +2789,63 @@ std::pair<uint512_t, uint512_t> bigfield<C, T>::compute_quotient_remainder_value
                                                                                   const bigfield& b,
                                                                                   const std::vector<bigfield>& to_add)
 {
-    uint512_t add_values(0);
+    std::vector<uint512_t> add_values;
     for (const auto& add_element : to_add) {
         add_element.reduction_check();
-        add_values += add_element.get_value();
+        add_values.push_back(add_element.get_value());
     }
+    return compute_quotient_remainder_values({ a.get_value() }, { b.get_value() }, add_values);
+}
 
-    const uint1024_t left(a.get_value());
-    const uint1024_t right(b.get_value());
-    const uint1024_t add_right(add_values);
-    const uint1024_t modulus(target_basis.modulus);
+template <typename C, typename T>
+std::pair<uint512_t, uint512_t> bigfield<C, T>::compute_quotient_remainder_values(const std::vector<uint512_t>& as,
+                                                                                  const std::vector<uint512_t>& bs,
+                                                                                  const std::vector<uint512_t>& to_add)
+{
+    ASSERT(as.size() == bs.size());
+    // All arithmetic on the full value wraps mod 2^512, which is enough to recover the quotient mod 2^512
+    uint512_t sum(0);
+    native remainder(0);
+    for (size_t i = 0; i < as.size(); i++) {
+        sum += as[i] * bs[i];
+        remainder += reduce_to_native(as[i]) * reduce_to_native(bs[i]);
+    }
+    for (const auto& add_element : to_add) {
+        sum += add_element;
+        remainder += reduce_to_native(add_element);
+    }
+    const uint512_t remainder_value(static_cast<uint256_t>(remainder));
+    return { compute_exact_quotient_value(sum - remainder_value), remainder_value };
+}
 
-    const auto [quotient_1024, remainder_1024] = (left * right + add_right).divmod(modulus);
+/**
+ * @brief Reduce a 512-bit value modulo the target modulus, as lo + hi * (2^256 mod p) in the native field
+ */
+template <typename C, typename T> typename bigfield<C, T>::native bigfield<C, T>::reduce_to_native(const uint512_t& value)
+{
+    // The uint256_t constructor of the native field reduces any 256-bit input, and 2^256 - p = 2^256 mod p
+    static constexpr native two_pow_256 = native(uint256_t(0) - modulus);
+    return native(value.lo) + native(value.hi) * two_pow_256;
+}
 
-    return { quotient_1024.lo, remainder_1024.lo };
+/**
+ * @brief Divide a multiple of the target modulus by the modulus, mod 2^512
+ *
+ * @details Since the modulus is odd it is invertible mod 2^512, so q * p = x (mod 2^512) gives q = x * p^{-1}.
+ * The inverse is computed once, by Newton iteration: every step x = x * (2 - p * x) doubles the number of correct low
+ * bits, starting from 3 (p * p = 1 mod 8 for any odd p).
+ */
+template <typename C, typename T>
+uint512_t bigfield<C, T>::compute_exact_quotient_value(const uint512_t& multiple_of_modulus)
+{
+    static const uint512_t modulus_inverse = []() {
+        uint512_t inverse = modulus_u512;
+        for (size_t correct_bits = 3; correct_bits < 512; correct_bits *= 2) {
+            inverse = inverse * (uint512_t(2) - modulus_u512 * inverse);
+        }
+        return inverse;
+    }();
+    return multiple_of_modulus * modulus_inverse;
 }
 
 template <typename C, typename T>
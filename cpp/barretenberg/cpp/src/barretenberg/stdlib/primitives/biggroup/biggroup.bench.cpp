@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/plonk/composer/ultra_composer.hpp"
+#include "barretenberg/stdlib/primitives/curves/bn254.hpp"
+
+using namespace benchmark;
+using namespace proof_system::plonk;
+
+using Curve = stdlib::bn254<UltraComposer>;
+using element_ct = Curve::g1_ct;
+using scalar_ct = Curve::fr_ct;
+
+namespace {
+
+/**
+ * Each benchmark builds one multi-scalar multiplication circuit in an UltraComposer and reports its gate count (the
+ * `gates` counter), alongside the time it takes to construct the circuit. The shapes mirror the ones used by the
+ * recursive verifier: up to a few dozen points with 128-bit scalars, and a handful of points with full-width scalars.
+ */
+struct MsmInputs {
+    UltraComposer composer;
+    std::vector<element_ct> points;
+    std::vector<scalar_ct> scalars;
+
+    MsmInputs(const size_t num_points, const bool short_scalars)
+    {
+        for (size_t i = 0; i < num_points; ++i) {
+            uint256_t scalar = barretenberg::fr::random_element();
+            if (short_scalars) {
+                scalar.data[2] = 0;
+                scalar.data[3] = 0;
+            }
+            const Curve::g1::affine_element point(Curve::g1::element::random_element());
+            points.emplace_back(element_ct::from_witness(&composer, point));
+            scalars.emplace_back(scalar_ct::from_witness(&composer, barretenberg::fr(scalar)));
+        }
+    }
+};
+
+template <typename Fn> void report_msm_gates(State& state, const bool short_scalars, Fn&& msm)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        MsmInputs inputs(static_cast<size_t>(state.range(0)), short_scalars);
+        const size_t gates_before = inputs.composer.get_num_gates();
+        state.ResumeTiming();
+
+        msm(inputs);
+
+        state.PauseTiming();
+        state.counters["gates"] = static_cast<double>(inputs.composer.get_num_gates() - gates_before);
+        state.ResumeTiming();
+    }
+}
+
+void batch_mul_128_bit(State& state) noexcept
+{
+    report_msm_gates(state, true, [](MsmInputs& inputs) { element_ct::batch_mul(inputs.points, inputs.scalars, 128); });
+}
+
+void wnaf_batch_mul_128_bit(State& state) noexcept
+{
+    report_msm_gates(
+        state, true, [](MsmInputs& inputs) { element_ct::wnaf_batch_mul<128>(inputs.points, inputs.scalars); });
+}
+
+template <size_t wnaf_size> void bn254_endo_wnaf_batch_mul_128_bit(State& state) noexcept
+{
+    report_msm_gates(state, true, [](MsmInputs& inputs) {
+        element_ct::bn254_endo_wnaf_batch_mul<wnaf_size>({}, {}, inputs.points, inputs.scalars);
+    });
+}
+
+void bn254_endo_batch_mul_254_bit(State& state) noexcept
+{
+    report_msm_gates(state, false, [](MsmInputs& inputs) {
+        element_ct::bn254_endo_batch_mul(inputs.points, inputs.scalars, {}, {}, 128);
+    });
+}
+
+template <size_t wnaf_size> void bn254_endo_wnaf_batch_mul_254_bit(State& state) noexcept
+{
+    report_msm_gates(state, false, [](MsmInputs& inputs) {
+        element_ct::bn254_endo_wnaf_batch_mul<wnaf_size>(inputs.points, inputs.scalars, {}, {});
+    });
+}
+
+} // namespace
+
+BENCHMARK(batch_mul_128_bit)->RangeMultiplier(2)->Range(2, 32)->Iterations(1)->Unit(kMillisecond);
+// One to three points is the verifier's rhs MSM, which picks between these two methods by its number of points.
+BENCHMARK(wnaf_batch_mul_128_bit)
+    ->DenseRange(1, 3)
+    ->RangeMultiplier(2)
+    ->Range(4, 32)
+    ->Iterations(1)
+    ->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(bn254_endo_wnaf_batch_mul_128_bit, 4)
+    ->DenseRange(1, 3)
+    ->RangeMultiplier(2)
+    ->Range(4, 32)
+    ->Iterations(1)
+    ->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(bn254_endo_wnaf_batch_mul_128_bit, 5)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->Iterations(1)
+    ->Unit(kMillisecond);
+BENCHMARK(bn254_endo_batch_mul_254_bit)->DenseRange(1, 4)->Iterations(1)->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(bn254_endo_wnaf_batch_mul_254_bit, 4)->DenseRange(1, 4)->Iterations(1)->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(bn254_endo_wnaf_batch_mul_254_bit, 5)->DenseRange(1, 4)->Iterations(1)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
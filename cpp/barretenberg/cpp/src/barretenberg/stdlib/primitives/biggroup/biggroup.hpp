@@ -210,6 +210,19 @@ template <class Composer, class Fq, class Fr, class NativeGroup> class element {
                                                        const Fr& generator_scalar,
                                                        const size_t max_num_small_bits);
 
+    /**
+     * ROM-table Straus multi-scalar multiplication over the BN254 curve (falls back to `bn254_endo_batch_mul` if the
+     * composer does not support ROM tables). Big scalars are split into two 128-bit scalars with the curve
+     * endomorphism, small scalars must be at most 128 bits. See `wnaf_table_plookup` for the point tables.
+     **/
+    template <size_t wnaf_size = 4,
+              typename X = NativeGroup,
+              typename = typename std::enable_if_t<std::is_same<X, barretenberg::g1>::value>>
+    static element bn254_endo_wnaf_batch_mul(const std::vector<element>& big_points,
+                                             const std::vector<Fr>& big_scalars,
+                                             const std::vector<element>& small_points,
+                                             const std::vector<Fr>& small_scalars);
+
     template <typename X = NativeGroup, typename = typename std::enable_if_t<std::is_same<X, secp256k1::g1>::value>>
     static element secp256k1_ecdsa_mul(const element& pubkey, const Fr& u1, const Fr& u2);
 
@@ -279,6 +292,34 @@ template <class Composer, class Fq, class Fr, class NativeGroup> class element {
         std::array<twin_rom_table<Composer>, 5> coordinates;
     };
 
+    /**
+     * ROM table of the odd multiples -(2^wnaf_size - 1) * P, ..., -P, P, ..., (2^wnaf_size - 1) * P of a point P,
+     * indexed by the (offset) wNAF entries produced by `compute_wnaf<max_num_bits, wnaf_size>`.
+     * four_bit_table_plookup is the wnaf_size = 4 case.
+     **/
+    template <size_t wnaf_size,
+              typename = typename std::enable_if<std::is_same<Composer, plonk::UltraComposer>::value>>
+    struct wnaf_table_plookup {
+        static constexpr size_t table_size = 1ULL << wnaf_size;
+        wnaf_table_plookup(){};
+        wnaf_table_plookup(const element& input);
+        wnaf_table_plookup(const std::array<element, table_size>& entries);
+
+        wnaf_table_plookup(const wnaf_table_plookup& other) = default;
+        wnaf_table_plookup& operator=(const wnaf_table_plookup& other) = default;
+
+        // Table of -\lambda * P, where \lambda is the cube root of unity of the scalar field. Its entries are derived
+        // from ours with one multiplication each: \lambda * (x, y) = (\beta * x, y)
+        wnaf_table_plookup endomorphism_table() const;
+
+        // The point P itself, needed to correct for the wNAF skew
+        const element& base_point() const { return element_table[table_size / 2]; }
+
+        element operator[](const field_t<Composer>& index) const;
+        std::array<element, table_size> element_table;
+        std::array<twin_rom_table<Composer>, 5> coordinates;
+    };
+
     template <typename = typename std::enable_if<std::is_same<Composer, plonk::UltraComposer>::value>>
     struct eight_bit_fixed_base_table {
         enum CurveType { BN254, SECP256K1, SECP256R1 };
@@ -678,6 +678,63 @@ template <typename TestType> class stdlib_biggroup : public testing::Test {
         EXPECT_VERIFICATION(composer);
     }
 
+    static void test_bn254_endo_wnaf_batch_mul()
+    {
+        const size_t num_big_points = 2;
+        const size_t num_small_points = 3;
+        auto composer = Composer("../srs_db/ignition/");
+        std::vector<affine_element> big_points;
+        std::vector<fr> big_scalars;
+        std::vector<affine_element> small_points;
+        std::vector<fr> small_scalars;
+
+        for (size_t i = 0; i < num_big_points; ++i) {
+            big_points.push_back(affine_element(element::random_element()));
+            big_scalars.push_back(fr::random_element());
+        }
+        for (size_t i = 0; i < num_small_points; ++i) {
+            small_points.push_back(affine_element(element::random_element()));
+            uint256_t scalar_raw = fr::random_element();
+            scalar_raw.data[2] = 0ULL;
+            scalar_raw.data[3] = 0ULL;
+            small_scalars.push_back(fr(scalar_raw));
+        }
+
+        std::vector<element_ct> big_circuit_points;
+        std::vector<scalar_ct> big_circuit_scalars;
+        std::vector<element_ct> small_circuit_points;
+        std::vector<scalar_ct> small_circuit_scalars;
+        for (size_t i = 0; i < num_big_points; ++i) {
+            big_circuit_points.push_back(element_ct::from_witness(&composer, big_points[i]));
+            big_circuit_scalars.push_back(scalar_ct::from_witness(&composer, big_scalars[i]));
+        }
+        for (size_t i = 0; i < num_small_points; ++i) {
+            small_circuit_points.push_back(element_ct::from_witness(&composer, small_points[i]));
+            small_circuit_scalars.push_back(scalar_ct::from_witness(&composer, small_scalars[i]));
+        }
+
+        element_ct result_point = element_ct::bn254_endo_wnaf_batch_mul(
+            big_circuit_points, big_circuit_scalars, small_circuit_points, small_circuit_scalars);
+
+        element expected_point = g1::one;
+        expected_point.self_set_infinity();
+        for (size_t i = 0; i < num_big_points; ++i) {
+            expected_point += (element(big_points[i]) * big_scalars[i]);
+        }
+        for (size_t i = 0; i < num_small_points; ++i) {
+            expected_point += (element(small_points[i]) * small_scalars[i]);
+        }
+
+        expected_point = expected_point.normalize();
+        fq result_x(result_point.x.get_value().lo);
+        fq result_y(result_point.y.get_value().lo);
+
+        EXPECT_EQ(result_x, expected_point.x);
+        EXPECT_EQ(result_y, expected_point.y);
+
+        EXPECT_VERIFICATION(composer);
+    }
+
     static void test_mixed_mul_bn254_endo()
     {
         Composer composer = Composer("../srs_db/ignition");
@@ -967,6 +1024,14 @@ HEAVY_TYPED_TEST(stdlib_biggroup, bn254_endo_batch_mul)
         GTEST_SKIP();
     }
 }
+HEAVY_TYPED_TEST(stdlib_biggroup, bn254_endo_wnaf_batch_mul)
+{
+    if constexpr (TypeParam::Curve::type == CurveType::BN254 && !TypeParam::use_bigfield) {
+        TestFixture::test_bn254_endo_wnaf_batch_mul();
+    } else {
+        GTEST_SKIP();
+    }
+}
 HEAVY_TYPED_TEST(stdlib_biggroup, mixed_mul_bn254_endo)
 {
     if constexpr (TypeParam::Curve::type == CurveType::BN254 && !TypeParam::use_bigfield) {
@@ -975,6 +1040,12 @@ HEAVY_TYPED_TEST(stdlib_biggroup, mixed_mul_bn254_endo)
         GTEST_SKIP();
     }
 }
+// The ROM-table path of bn254_endo_wnaf_batch_mul needs an UltraComposer with native scalars, which is not among the
+// TestTypes above
+HEAVY_TEST(stdlib_biggroup_ultra, bn254_endo_wnaf_batch_mul)
+{
+    stdlib_biggroup<TestType<stdlib::bn254<plonk::UltraComposer>, UseBigfield::No>>::test_bn254_endo_wnaf_batch_mul();
+}
 
 /* The following tests are specific to SECP256k1 */
 HEAVY_TYPED_TEST(stdlib_biggroup, wnaf_secp256k1)
@@ -421,5 +421,112 @@ element<C, Fq, Fr, G> element<C, Fq, Fr, G>::bn254_endo_batch_mul(const std::vec
     // Return our scalar mul output
     return accumulator;
 }
+
+/**
+ * Straus multi-scalar multiplication over the BN254 curve, using a ROM table of odd multiples per point.
+ *
+ * Every big scalar k is split into 128-bit scalars (k1, k2) with k = k1 - k2 * \lambda, and is evaluated as
+ * k1 * [P] + k2 * [-\lambda * P]. The table of -\lambda * P is derived from the table of P, which costs one
+ * multiplication per entry instead of a new set of point additions. Together with the small scalars, every scalar is
+ * then written as a `wnaf_size`-bit wNAF, and each round of the main loop performs `wnaf_size` doublings plus one chain
+ * of additions over all table reads.
+ *
+ * Compared to `bn254_endo_batch_mul`, which adds one point per bit from multi-point tables, this adds one point per
+ * `wnaf_size` bits per scalar, so it wins when there are few points.
+ **/
+template <class C, class Fq, class Fr, class G>
+template <size_t wnaf_size, typename, typename>
+element<C, Fq, Fr, G> element<C, Fq, Fr, G>::bn254_endo_wnaf_batch_mul(const std::vector<element>& big_points,
+                                                                       const std::vector<Fr>& big_scalars,
+                                                                       const std::vector<element>& small_points,
+                                                                       const std::vector<Fr>& small_scalars)
+{
+    constexpr size_t num_bits = 128;
+    ASSERT(big_points.size() == big_scalars.size());
+    ASSERT(small_points.size() == small_scalars.size());
+    if constexpr (C::type != ComposerType::PLOOKUP) {
+        return bn254_endo_batch_mul(big_points, big_scalars, small_points, small_scalars, num_bits);
+    } else {
+        static_assert(wnaf_size >= 2);
+        C* ctx = nullptr;
+        for (const auto& point : big_points) {
+            if (point.get_context()) {
+                ctx = point.get_context();
+                break;
+            }
+        }
+        for (const auto& point : small_points) {
+            if (ctx == nullptr && point.get_context()) {
+                ctx = point.get_context();
+            }
+        }
+
+        std::vector<wnaf_table_plookup<wnaf_size>> tables;
+        std::vector<std::vector<field_t<C>>> wnaf_entries;
+        const barretenberg::fr lambda = barretenberg::fr::cube_root_of_unity();
+        for (size_t i = 0; i < big_points.size(); ++i) {
+            barretenberg::fr k = uint256_t(big_scalars[i].get_value());
+            barretenberg::fr k1(0);
+            barretenberg::fr k2(0);
+            barretenberg::fr::split_into_endomorphism_scalars(k.from_montgomery_form(), k1, k2);
+            Fr scalar_k1 = Fr::from_witness(ctx, k1.to_montgomery_form());
+            Fr scalar_k2 = Fr::from_witness(ctx, k2.to_montgomery_form());
+            big_scalars[i].assert_equal(scalar_k1 - scalar_k2 * lambda);
+
+            tables.emplace_back(wnaf_table_plookup<wnaf_size>(big_points[i]));
+            tables.emplace_back(tables.back().endomorphism_table());
+            wnaf_entries.emplace_back(compute_wnaf<num_bits, wnaf_size>(scalar_k1));
+            wnaf_entries.emplace_back(compute_wnaf<num_bits, wnaf_size>(scalar_k2));
+        }
+        for (size_t i = 0; i < small_points.size(); ++i) {
+            tables.emplace_back(wnaf_table_plookup<wnaf_size>(small_points[i]));
+            wnaf_entries.emplace_back(compute_wnaf<num_bits, wnaf_size>(small_scalars[i]));
+        }
+        const size_t num_tables = tables.size();
+        ASSERT(num_tables > 0);
+
+        // Sum the table entries of one round without computing the y-coordinates of intermediate sums
+        const auto get_round_accumulator = [&](const size_t round) {
+            if (num_tables == 1) {
+                element entry = tables[0][wnaf_entries[0][round]];
+                return chain_add_accumulator(entry);
+            }
+            chain_add_accumulator accumulator =
+                chain_add_start(tables[0][wnaf_entries[0][round]], tables[1][wnaf_entries[1][round]]);
+            for (size_t j = 2; j < num_tables; ++j) {
+                accumulator = chain_add(tables[j][wnaf_entries[j][round]], accumulator);
+            }
+            return accumulator;
+        };
+
+        constexpr size_t num_rounds = (num_bits + wnaf_size - 1) / wnaf_size;
+        const auto offset_generators = compute_offset_generators(num_rounds * wnaf_size - wnaf_size + 1);
+        element accumulator = chain_add_end(chain_add(offset_generators.first, get_round_accumulator(0)));
+
+        for (size_t i = 1; i < num_rounds; ++i) {
+            // accumulator = 2^{wnaf_size} * accumulator + round sum. The last doubling is merged into the ladder
+            for (size_t j = 0; j < wnaf_size - 1; ++j) {
+                accumulator = accumulator.dbl();
+            }
+            chain_add_accumulator to_add = get_round_accumulator(i);
+            if (to_add.is_element) {
+                accumulator = accumulator.montgomery_ladder(element(to_add.x3_prev, to_add.y3_prev));
+            } else {
+                accumulator = accumulator.montgomery_ladder(to_add);
+            }
+        }
+
+        // wNAFs can only represent odd integers, even scalars are represented as (k + 1) with a skew of 1
+        for (size_t i = 0; i < num_tables; ++i) {
+            element skew = accumulator - tables[i].base_point();
+            const bool_t<C> has_skew(wnaf_entries[i][num_rounds]);
+            Fq out_x = accumulator.x.conditional_select(skew.x, has_skew);
+            Fq out_y = accumulator.y.conditional_select(skew.y, has_skew);
+            accumulator = element(out_x, out_y);
+        }
+        accumulator = accumulator - offset_generators.second;
+        return accumulator;
+    }
+}
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
@@ -76,6 +76,63 @@ element<C, Fq, Fr, G> element<C, Fq, Fr, G>::four_bit_table_plookup<X>::operator
     return read_group_element_rom_tables<16>(coordinates, index);
 }
 
+template <typename C, class Fq, class Fr, class G>
+template <size_t wnaf_size, typename X>
+element<C, Fq, Fr, G>::wnaf_table_plookup<wnaf_size, X>::wnaf_table_plookup(const element& input)
+{
+    constexpr size_t half_size = table_size / 2;
+    element d2 = input.dbl();
+
+    element_table[half_size] = input;
+    for (size_t i = half_size + 1; i < table_size; ++i) {
+        element_table[i] = element_table[i - 1] + d2;
+    }
+    for (size_t i = 0; i < half_size; ++i) {
+        element_table[i] = (-element_table[table_size - 1 - i]).reduce();
+    }
+
+    coordinates = create_group_element_rom_tables<table_size>(element_table);
+}
+
+template <typename C, class Fq, class Fr, class G>
+template <size_t wnaf_size, typename X>
+element<C, Fq, Fr, G>::wnaf_table_plookup<wnaf_size, X>::wnaf_table_plookup(
+    const std::array<element, table_size>& entries)
+    : element_table(entries)
+{
+    coordinates = create_group_element_rom_tables<table_size>(element_table);
+}
+
+template <typename C, class Fq, class Fr, class G>
+template <size_t wnaf_size, typename X>
+typename element<C, Fq, Fr, G>::template wnaf_table_plookup<wnaf_size, X> element<C, Fq, Fr, G>::wnaf_table_plookup<
+    wnaf_size,
+    X>::endomorphism_table() const
+{
+    // Entry i holds k * P for k = 2i + 1 - table_size, so entry (table_size - 1 - i) holds -k * P and
+    // k * (-\lambda * P) = \lambda * (-k * P) = (\beta * x_i, y_{table_size - 1 - i}).
+    // Both halves share their x-coordinates, so only half of the table needs a multiplication by \beta
+    constexpr size_t half_size = table_size / 2;
+    const uint256_t beta_value = barretenberg::field<typename Fq::TParams>::cube_root_of_unity();
+    const Fq beta(element_table[half_size].get_context(), beta_value);
+
+    std::array<element, table_size> entries;
+    for (size_t i = half_size; i < table_size; ++i) {
+        const Fq endo_x = element_table[i].x * beta;
+        entries[i] = element(endo_x, element_table[table_size - 1 - i].y);
+        entries[table_size - 1 - i] = element(endo_x, element_table[i].y);
+    }
+    return wnaf_table_plookup(entries);
+}
+
+template <typename C, class Fq, class Fr, class G>
+template <size_t wnaf_size, typename X>
+element<C, Fq, Fr, G> element<C, Fq, Fr, G>::wnaf_table_plookup<wnaf_size, X>::operator[](
+    const field_t<C>& index) const
+{
+    return read_group_element_rom_tables<table_size>(coordinates, index);
+}
+
 template <class C, class Fq, class Fr, class G>
 template <typename X>
 element<C, Fq, Fr, G> element<C, Fq, Fr, G>::eight_bit_fixed_base_table<X>::operator[](const field_t<C>& index) const
@@ -1177,6 +1177,46 @@ std::vector<bool_t<ComposerContext>> field_t<ComposerContext>::decompose_into_bi
     return result;
 }
 
+/**
+ * @brief Constrain `hi * 2**lo_bits + lo` to be at most `r - 1`, i.e. `(lo, hi)` to be the canonical limbs of the field
+ * element they pack.
+ *
+ * @details The caller must already have range constrained `lo` to `lo_bits` bits and `hi` to at most `256 - lo_bits`
+ * bits. This is the schoolbook subtraction of `decompose_into_bits`, with `r - 1 = p_lo + 2**lo_bits * p_hi`:
+ *
+ *     y_lo := p_lo + b * 2**lo_bits - lo,    y_hi := p_hi - b - hi
+ *
+ * where `b` is the boolean "a borrow is necessary". Both are non-negative if and only if the limbs are canonical, which
+ * range constraints to the bit lengths of `2**lo_bits` and `p_hi` show.
+ */
+template <typename ComposerContext>
+void field_t<ComposerContext>::assert_canonical_limbs(const field_t& lo,
+                                                      const field_t& hi,
+                                                      const size_t lo_bits,
+                                                      std::string const& msg)
+{
+    constexpr uint256_t modulus_minus_one = fr::modulus - 1;
+    const size_t modulus_bits = modulus_minus_one.get_msb() + 1;
+    ASSERT(lo_bits < modulus_bits);
+    const uint256_t lo_value(lo.get_value());
+    const uint256_t hi_value(hi.get_value());
+    if (lo.is_constant() && hi.is_constant()) {
+        ASSERT((hi_value << lo_bits) + lo_value <= modulus_minus_one);
+        return;
+    }
+
+    ComposerContext* ctx = lo.get_context() ? lo.get_context() : hi.get_context();
+    const uint256_t p_lo = modulus_minus_one.slice(0, lo_bits);
+    const uint256_t p_hi = modulus_minus_one.slice(lo_bits, 256);
+    const field_t shift(ctx, fr(uint256_t(1) << lo_bits));
+
+    const bool_t<ComposerContext> borrow = witness_t<ComposerContext>(ctx, lo_value > p_lo);
+    const field_t y_lo = field_t(ctx, fr(p_lo)) - lo + field_t(borrow) * shift;
+    const field_t y_hi = field_t(ctx, fr(p_hi)) - hi - field_t(borrow);
+    y_lo.create_range_constraint(lo_bits, msg);
+    y_hi.create_range_constraint(modulus_bits - lo_bits, msg);
+}
+
 INSTANTIATE_STDLIB_TYPE(field_t);
 
 } // namespace stdlib
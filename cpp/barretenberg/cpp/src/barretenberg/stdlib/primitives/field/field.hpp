@@ -297,6 +297,11 @@ template <typename ComposerContext> class field_t {
                 return witness_t<ComposerContext>(ctx, val.get_bit(j));
             }) const;
 
+    static void assert_canonical_limbs(const field_t& lo,
+                                       const field_t& hi,
+                                       const size_t lo_bits,
+                                       std::string const& msg = "field_t::assert_canonical_limbs");
+
     mutable ComposerContext* context = nullptr;
 
     /**
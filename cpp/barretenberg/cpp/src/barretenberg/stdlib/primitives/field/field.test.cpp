@@ -762,6 +762,34 @@ template <typename Composer> class stdlib_field : public testing::Test {
         run_failure_test(supply_half_modulus_bits);
     }
 
+    /**
+     * @brief Test that assert_canonical_limbs accepts the limbs of r - 1 and rejects those of r, for two limb widths.
+     */
+    static void test_assert_canonical_limbs()
+    {
+        auto run_test = [](const uint256_t& value, const size_t lo_bits, const bool expect_verified) {
+            Composer composer = Composer();
+
+            field_ct lo = witness_ct(&composer, fr(value.slice(0, lo_bits)));
+            field_ct hi = witness_ct(&composer, fr(value.slice(lo_bits, 256)));
+            lo.create_range_constraint(lo_bits);
+            hi.create_range_constraint(256 - lo_bits);
+            field_ct::assert_canonical_limbs(lo, hi, lo_bits);
+
+            auto prover = composer.create_prover();
+            auto verifier = composer.create_verifier();
+            plonk::proof proof = prover.construct_proof();
+            bool verified = verifier.verify_proof(proof);
+            EXPECT_EQ(verified, expect_verified);
+        };
+
+        for (const size_t lo_bits : { size_t(126), size_t(128) }) {
+            run_test(fr::modulus - 1, lo_bits, true);
+            run_test(uint256_t(fr::random_element()), lo_bits, true);
+            run_test(fr::modulus, lo_bits, false);
+        }
+    }
+
     static void test_assert_is_in_set()
     {
         Composer composer = Composer();
@@ -1061,6 +1089,10 @@ TYPED_TEST(stdlib_field, decompose_into_bits)
 {
     TestFixture::decompose_into_bits();
 }
+TYPED_TEST(stdlib_field, test_assert_canonical_limbs)
+{
+    TestFixture::test_assert_canonical_limbs();
+}
 TYPED_TEST(stdlib_field, test_assert_is_in_set)
 {
     TestFixture::test_assert_is_in_set();
@@ -151,10 +151,39 @@ template <typename Curve> struct verification_key {
         return key;
     }
 
+    /**
+     * @brief Whether every circuit value of the key is a constant, i.e. the key was fixed when the circuit was built
+     * (see `from_constants`). Such a key needs no constraints to be hashed or checked for set membership.
+     */
+    bool is_constant() const
+    {
+        if (!n.is_constant() || !num_public_inputs.is_constant() || !domain.root.is_constant() ||
+            !domain.domain.is_constant() || !domain.generator.is_constant()) {
+            return false;
+        }
+        for (const auto& [tag, commitment] : commitments) {
+            if (!commitment.x.is_constant() || !commitment.y.is_constant()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     void validate_key_is_in_set(const std::vector<std::shared_ptr<plonk::verification_key>>& keys_in_set)
     {
         const auto circuit_key_compressed = compress();
         bool found = false;
+        // a constant key is checked when the circuit is built
+        if (is_constant()) {
+            for (const auto& key : keys_in_set) {
+                found = found || (compress_native(key) == circuit_key_compressed.get_value());
+            }
+            if (!found) {
+                context->failure(
+                    "verification_key::validate_key_is_in_set failed - input key is not in the provided set!");
+            }
+            return;
+        }
         // if we're using Plookup, use a ROM table to index the keys
         if constexpr (Composer::type == ComposerType::PLOOKUP) {
             field_t<Composer> key_index(witness_t<Composer>(context, 0));
@@ -189,6 +218,10 @@ template <typename Curve> struct verification_key {
   public:
     field_t<Composer> compress(size_t const hash_index = 0)
     {
+        if (is_constant()) {
+            return field_t<Composer>(context, compress_native(base_key, hash_index));
+        }
+
         field_t<Composer> compressed_domain = domain.compress();
 
         std::vector<field_t<Composer>> preimage_data;
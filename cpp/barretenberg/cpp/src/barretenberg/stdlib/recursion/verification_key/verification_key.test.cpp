@@ -88,3 +88,29 @@ TYPED_TEST(VerificationKeyFixture, compress_vs_compress_native)
     EXPECT_NE(recurs_vk->compress(0).get_value(), RecursVk::compress_native(native_vk, 15));
     EXPECT_NE(recurs_vk->compress(14).get_value(), RecursVk::compress_native(native_vk, 15));
 }
+
+TYPED_TEST(VerificationKeyFixture, compress_constant_key)
+{
+    using RecursVk = typename TestFixture::RecursVk;
+    auto composer = TestFixture::init_composer();
+
+    verification_key_data vk_data = TestFixture::rand_vk_data();
+
+    auto file_crs = std::make_unique<proof_system::FileReferenceStringFactory>("../srs_db/ignition");
+    auto file_verifier = file_crs->get_verifier_crs();
+
+    auto native_vk = std::make_shared<verification_key>(std::move(vk_data), file_verifier);
+    auto witness_vk = RecursVk::from_witness(&composer, native_vk);
+    auto constant_vk = RecursVk::from_constants(&composer, native_vk);
+    EXPECT_FALSE(witness_vk->is_constant());
+    EXPECT_TRUE(constant_vk->is_constant());
+
+    // a key baked into the circuit hashes to the same value as a witness key, without adding any gates
+    const size_t num_gates = composer.get_num_gates();
+    const auto compressed = constant_vk->compress(15);
+    constant_vk->validate_key_is_in_set({ native_vk });
+    EXPECT_TRUE(compressed.is_constant());
+    EXPECT_EQ(composer.get_num_gates(), num_gates);
+    EXPECT_EQ(compressed.get_value(), witness_vk->compress(15).get_value());
+    EXPECT_FALSE(composer.failed());
+}
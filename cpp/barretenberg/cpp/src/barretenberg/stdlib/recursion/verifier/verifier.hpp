@@ -8,6 +8,7 @@
 #include "../transcript/transcript.hpp"
 #include "../aggregation_state/aggregation_state.hpp"
 
+#include "barretenberg/plonk/composer/gate_profiler.hpp"
 #include "barretenberg/plonk/proof_system/utils/kate_verification.hpp"
 #include "barretenberg/plonk/proof_system/public_inputs/public_inputs.hpp"
 
@@ -187,6 +188,8 @@ aggregation_state<Curve> verify_proof(typename Curve::Composer* context,
     using fq_ct = typename Curve::fq_ct;
     using g1_ct = typename Curve::g1_ct;
     using Composer = typename Curve::Composer;
+    using Scope = typename GateProfiler<Composer>::Scope;
+    Scope verify_proof_scope(context, "verify_proof");
 
     key->program_width = program_settings::program_width;
 
@@ -221,7 +224,11 @@ aggregation_state<Curve> verify_proof(typename Curve::Composer* context,
     // reconstruct evaluation of quotient polynomial from prover messages
 
     fr_ct quotient_numerator_eval = fr_ct(0);
-    program_settings::compute_quotient_evaluation_contribution(key.get(), alpha, transcript, quotient_numerator_eval);
+    {
+        Scope scope(context, "quotient_evaluation");
+        program_settings::compute_quotient_evaluation_contribution(
+            key.get(), alpha, transcript, quotient_numerator_eval);
+    }
 
     fr_ct t_eval = quotient_numerator_eval / lagrange_evals.vanishing_poly;
     transcript.add_field_element("t", t_eval);
@@ -382,7 +389,15 @@ aggregation_state<Curve> verify_proof(typename Curve::Composer* context,
     }
     opening_result = opening_result.normalize();
 
-    g1_ct rhs = g1_ct::template wnaf_batch_mul<128>(rhs_elements, rhs_scalars);
+    // On Ultra the ROM-table Straus MSM is cheaper than `wnaf_batch_mul` for two or three points (29.7k vs 30.3k and
+    // 35.6k vs 37.2k gates), but not for PI_Z_OMEGA alone, when there is no previous output or inner recursive proof
+    // to aggregate (23.9k vs 23.5k)
+    g1_ct rhs;
+    if (Composer::type == ComposerType::PLOOKUP && rhs_elements.size() > 1) {
+        rhs = g1_ct::template bn254_endo_wnaf_batch_mul({}, {}, rhs_elements, rhs_scalars);
+    } else {
+        rhs = g1_ct::template wnaf_batch_mul<128>(rhs_elements, rhs_scalars);
+    }
     rhs = rhs + PI_Z;
     rhs = (-rhs).normalize();
 
@@ -0,0 +1,76 @@
+#include "testing_harness.hpp"
+
+#include <barretenberg/plonk/composer/gate_profiler.hpp>
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+namespace aztec3::circuits::kernel::private_kernel {
+
+namespace {
+
+using Profiler = plonk::GateProfiler<Composer>;
+
+constexpr auto CRS_PATH = "../barretenberg/cpp/srs_db/ignition";
+
+/**
+ * Report the gate profile of the kernel circuit as benchmark counters: the total, and the gates and lookup gates
+ * attributed to each profiled scope (e.g. `private_kernel/validate_this_private_call`).
+ */
+void report_gate_profile(State& state, const Composer& composer, const Profiler& profiler)
+{
+    state.counters["gates"] = static_cast<double>(composer.get_num_gates());
+    for (const auto& [path, scope] : profiler.breakdown()) {
+        state.counters[path + ":gates"] = static_cast<double>(scope.counts.gates);
+        state.counters[path + ":lookup_gates"] = static_cast<double>(scope.counts.lookup_gates);
+    }
+}
+
+PrivateInputs<NT> const& deposit_inputs()
+{
+    static const PrivateInputs<NT> inputs = do_private_call_get_kernel_inputs(false, deposit, { 5, 1, 999 });
+    return inputs;
+}
+
+PrivateInputs<NT> const& constructor_inputs()
+{
+    static const PrivateInputs<NT> inputs = do_private_call_get_kernel_inputs(true, constructor, { 5, 1, 999 });
+    return inputs;
+}
+
+template <PrivateInputs<NT> const& (*inputs)()> void private_kernel_circuit_bench(State& state) noexcept
+{
+    const auto& private_inputs = inputs();
+    for (auto _ : state) {
+        Composer composer(CRS_PATH);
+        Profiler profiler(composer);
+        private_kernel_circuit(composer, private_inputs);
+
+        state.PauseTiming();
+        report_gate_profile(state, composer, profiler);
+        state.ResumeTiming();
+    }
+}
+BENCHMARK_TEMPLATE(private_kernel_circuit_bench, deposit_inputs)->Iterations(1)->Unit(kMillisecond);
+BENCHMARK_TEMPLATE(private_kernel_circuit_bench, constructor_inputs)->Iterations(1)->Unit(kMillisecond);
+
+void private_kernel_prove_deposit(State& state) noexcept
+{
+    const auto& private_inputs = deposit_inputs();
+    for (auto _ : state) {
+        state.PauseTiming();
+        Composer composer(CRS_PATH);
+        private_kernel_circuit(composer, private_inputs);
+        state.ResumeTiming();
+
+        auto prover = composer.create_prover();
+        DoNotOptimize(prover.construct_proof());
+    }
+}
+BENCHMARK(private_kernel_prove_deposit)->Iterations(1)->Unit(kMillisecond);
+
+} // namespace
+
+} // namespace aztec3::circuits::kernel::private_kernel
+
+BENCHMARK_MAIN();
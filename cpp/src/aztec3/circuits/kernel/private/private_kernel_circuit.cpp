@@ -1,6 +1,7 @@
 #include "aztec3/constants.hpp"
 #include "init.hpp"
 
+#include <barretenberg/plonk/composer/gate_profiler.hpp>
 #include <barretenberg/stdlib/primitives/field/array.hpp>
 
 #include <aztec3/circuits/abis/private_kernel/private_inputs.hpp>
@@ -15,6 +16,8 @@ using aztec3::circuits::abis::private_kernel::NewContractData;
 using aztec3::circuits::abis::private_kernel::PrivateInputs;
 using aztec3::circuits::abis::private_kernel::PublicInputs;
 
+using GateProfileScope = plonk::GateProfiler<Composer>::Scope;
+
 using plonk::stdlib::array_length;
 using plonk::stdlib::array_pop;
 using plonk::stdlib::array_push;
@@ -323,6 +326,8 @@ void validate_inputs(PrivateInputs<CT> const& private_inputs)
 // ensure we're constraining everything.
 PublicInputs<NT> private_kernel_circuit(Composer& composer, PrivateInputs<NT> const& _private_inputs)
 {
+    GateProfileScope kernel_scope(&composer, "private_kernel");
+
     const PrivateInputs<CT> private_inputs = _private_inputs.to_circuit_type(composer);
 
     // We'll be pushing data to this during execution of this circuit.
@@ -331,15 +336,23 @@ PublicInputs<NT> private_kernel_circuit(Composer& composer, PrivateInputs<NT> co
     // Do this before any functions can modify the inputs.
     initialise_end_values(private_inputs, public_inputs);
 
-    validate_inputs(private_inputs);
-
-    validate_this_private_call_hash(private_inputs);
+    {
+        GateProfileScope scope(&composer, "validate_inputs");
+        validate_inputs(private_inputs);
+    }
 
-    validate_this_private_call_stack(private_inputs);
+    {
+        GateProfileScope scope(&composer, "validate_this_private_call");
+        validate_this_private_call_hash(private_inputs);
+        validate_this_private_call_stack(private_inputs);
+    }
 
     // TODO (later): do we need to validate this private_call_stack against end.private_call_stack?
 
-    update_end_values(private_inputs, public_inputs);
+    {
+        GateProfileScope scope(&composer, "update_end_values");
+        update_end_values(private_inputs, public_inputs);
+    }
 
     auto aggregation_object = verify_proofs(composer,
                                             private_inputs,
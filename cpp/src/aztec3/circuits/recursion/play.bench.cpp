@@ -0,0 +1,83 @@
+#include "index.hpp"
+
+#include <barretenberg/plonk/composer/gate_profiler.hpp>
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+namespace aztec3::circuits::recursion {
+
+namespace {
+
+using Profiler = plonk::GateProfiler<Composer>;
+
+constexpr auto CRS_PATH = "../barretenberg/cpp/srs_db/ignition";
+
+struct InnerProof {
+    std::shared_ptr<NT::VK> vk;
+    NT::Proof proof;
+};
+
+template <typename Circuit> InnerProof create_inner_proof(Circuit&& circuit)
+{
+    Composer composer = Composer(CRS_PATH);
+    circuit(composer, 1, 2);
+    auto prover = composer.create_prover();
+    NT::Proof proof = prover.construct_proof();
+    return { composer.compute_verification_key(), proof };
+}
+
+/**
+ * Report the gate profile of a circuit as benchmark counters: the total, and the gates and lookup gates attributed to
+ * each profiled scope (e.g. `verify_proof/quotient_evaluation`). Tracking these over time shows which gadget a gate
+ * count regression comes from.
+ */
+void report_gate_profile(State& state, const Composer& composer, const Profiler& profiler)
+{
+    const auto total = Profiler::count(composer);
+    state.counters["gates"] = static_cast<double>(composer.get_num_gates());
+    state.counters["lookup_gates"] = static_cast<double>(total.lookup_gates);
+    state.counters["range_list_entries"] = static_cast<double>(total.range_list_entries);
+    state.counters["rom_records"] = static_cast<double>(total.rom_records);
+    for (const auto& [path, scope] : profiler.breakdown()) {
+        state.counters[path + ":gates"] = static_cast<double>(scope.counts.gates);
+        state.counters[path + ":lookup_gates"] = static_cast<double>(scope.counts.lookup_gates);
+    }
+}
+
+void recursive_circuit_one_proof(State& state) noexcept
+{
+    static const InnerProof app = create_inner_proof(play_app_circuit);
+    for (auto _ : state) {
+        Composer composer = Composer(CRS_PATH);
+        Profiler profiler(composer);
+        play_recursive_circuit(composer, app.vk, app.proof);
+
+        state.PauseTiming();
+        report_gate_profile(state, composer, profiler);
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(recursive_circuit_one_proof)->Iterations(1)->Unit(kMillisecond);
+
+void recursive_circuit_two_proofs(State& state) noexcept
+{
+    static const InnerProof app = create_inner_proof(play_app_circuit);
+    static const InnerProof dummy = create_inner_proof(dummy_circuit);
+    for (auto _ : state) {
+        Composer composer = Composer(CRS_PATH);
+        Profiler profiler(composer);
+        play_recursive_circuit_2(composer, app.vk, app.proof, dummy.vk, dummy.proof);
+
+        state.PauseTiming();
+        report_gate_profile(state, composer, profiler);
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(recursive_circuit_two_proofs)->Iterations(1)->Unit(kMillisecond);
+
+} // namespace
+
+} // namespace aztec3::circuits::recursion
+
+BENCHMARK_MAIN();
@@ -176,11 +176,7 @@ std::array<NT::fr, 2> calculate_calldata_hash(BaseRollupInputs const& baseRollup
         auto offset = i * 32;
         std::copy(as_bytes.begin(), as_bytes.end(), calldata_hash_inputs_bytes.begin() + offset);
     }
-    // TODO: double check this gpt code
-    std::vector<uint8_t> calldata_hash_inputs_bytes_vec(calldata_hash_inputs_bytes.begin(),
-                                                        calldata_hash_inputs_bytes.end());
-
-    auto h = sha256::sha256(calldata_hash_inputs_bytes_vec);
+    auto h = sha256::sha256(std::span<const uint8_t>(calldata_hash_inputs_bytes));
 
     // Split the hash into two fields, a high and a low
     std::array<uint8_t, 32> buf_1, buf_2;
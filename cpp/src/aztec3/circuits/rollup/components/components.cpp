@@ -93,9 +93,7 @@ std::array<fr, 2> compute_calldata_hash(std::array<abis::PreviousRollupData<NT>,
     }
 
     // Compute the sha256
-    std::vector<uint8_t> calldata_hash_input_bytes_vec(calldata_hash_input_bytes.begin(),
-                                                       calldata_hash_input_bytes.end());
-    auto h = sha256::sha256(calldata_hash_input_bytes_vec);
+    auto h = sha256::sha256(std::span<const uint8_t>(calldata_hash_input_bytes));
 
     // Split the hash into two fields, a high and a low
     std::array<uint8_t, 32> buf_1, buf_2;